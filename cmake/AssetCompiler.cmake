@@ -0,0 +1,56 @@
+# MIT License
+# 
+# Copyright (c) 2024 Yan01h
+# 
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+# Compiles an asset into a compressed header in ${CMAKE_BINARY_DIR}/generated using tools/asset_compiler.
+# The generated header is appended to WS_GENERATED_ASSETS.
+#
+#   ws_compile_asset(<image|font|file> <input> <output> <namespace> <name>)
+function(ws_compile_asset TYPE INPUT OUTPUT NAMESPACE NAME)
+    set(OUTPUT_PATH "${CMAKE_BINARY_DIR}/generated/${OUTPUT}")
+    add_custom_command(
+            OUTPUT ${OUTPUT_PATH}
+            COMMAND asset_compiler ${TYPE} ${INPUT} ${OUTPUT_PATH} ${NAMESPACE} ${NAME}
+            DEPENDS asset_compiler ${INPUT}
+            COMMENT "Compiling asset ${OUTPUT}"
+            VERBATIM
+    )
+    set(WS_GENERATED_ASSETS ${WS_GENERATED_ASSETS} ${OUTPUT_PATH} PARENT_SCOPE)
+endfunction()
+
+# Builds a theme pack in ${CMAKE_BINARY_DIR}/themes from a theme description (see tools/asset_compiler.cpp).
+# The pack is appended to WS_THEME_PACKS.
+#
+#   ws_compile_theme_pack(<theme.txt> <output>)
+function(ws_compile_theme_pack INPUT OUTPUT)
+    set(OUTPUT_PATH "${CMAKE_BINARY_DIR}/themes/${OUTPUT}")
+    get_filename_component(INPUT_DIR ${INPUT} DIRECTORY)
+    file(GLOB THEME_FILES "${INPUT_DIR}/*.png" "${INPUT_DIR}/*.ttf")
+    add_custom_command(
+            OUTPUT ${OUTPUT_PATH}
+            COMMAND asset_compiler pack ${INPUT} ${OUTPUT_PATH}
+            DEPENDS asset_compiler ${INPUT} ${THEME_FILES}
+            COMMENT "Building theme pack ${OUTPUT}"
+            VERBATIM
+    )
+    set(WS_THEME_PACKS ${WS_THEME_PACKS} ${OUTPUT_PATH} PARENT_SCOPE)
+endfunction()
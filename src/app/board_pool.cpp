@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "board_pool.h"
+
+#include <algorithm>
+#include <raylib.h>
+
+#include "diagnostics/logger.h"
+
+constexpr std::size_t MEMORY_BUDGET   = 16 * 1024 * 1024; // Bytes of tiles kept ready at most
+constexpr std::size_t MAX_READY_COUNT = 2;
+constexpr std::size_t MAX_STORAGE     = 2; // Recycled fields kept for reuse
+
+BoardPool::BoardPool(JobSystem& jobs)
+    : _jobs(jobs)
+    , _width(0)
+    , _height(0)
+    , _bombCount(0)
+    , _capacity(0)
+    , _boards()
+    , _storage()
+    , _refillToken()
+    , _refilling(false)
+{}
+
+BoardPool::~BoardPool()
+{
+    clear();
+}
+
+auto BoardPool::take(const int width, const int height, const int bombCount) -> std::unique_ptr<MineField>
+{
+    if (width != _width || height != _height || bombCount != _bombCount)
+    {
+        clear();
+        _width     = width;
+        _height    = height;
+        _bombCount = bombCount;
+
+        const std::size_t boardSize = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * sizeof(Tile);
+        _capacity                   = std::min(MAX_READY_COUNT, MEMORY_BUDGET / std::max<std::size_t>(boardSize, 1));
+        Logger::log(LOG_INFO, "Board pool keeps %i %ix%i boards ready", static_cast<int>(_capacity), width, height);
+    }
+
+    std::unique_ptr<MineField> field;
+    if (!_boards.empty())
+    {
+        field = std::move(_boards.back());
+        _boards.pop_back();
+    }
+    refill();
+    return field;
+}
+
+void BoardPool::recycle(std::unique_ptr<MineField> field)
+{
+    if (field && _storage.size() < MAX_STORAGE)
+    {
+        _storage.push_back(std::move(field));
+        refill();
+    }
+}
+
+auto BoardPool::takeStorage() -> std::unique_ptr<MineField>
+{
+    if (_storage.empty())
+    {
+        return nullptr;
+    }
+
+    auto field = std::move(_storage.back());
+    _storage.pop_back();
+    return field;
+}
+
+void BoardPool::clear()
+{
+    _refillToken.cancel();
+    _refilling = false;
+    _boards.clear();
+}
+
+auto BoardPool::getReadyCount() const -> std::size_t
+{
+    return _boards.size();
+}
+
+void BoardPool::refill()
+{
+    if (_refilling || _boards.size() >= _capacity)
+    {
+        return;
+    }
+
+    // A fresh token per refill, so a cancelled one can not drop boards of the next dimensions
+    _refillToken = CancellationToken();
+    _refilling   = true;
+    _jobs.submit(
+        [width = _width, height = _height, bombCount = _bombCount, token = _refillToken,
+         storage = takeStorage()]() mutable {
+            return MineField::generate(
+                width, height, bombCount, [&token](float) { return !token.isCancelled(); }, std::move(storage));
+        },
+        [this, token = _refillToken](std::unique_ptr<MineField> field) {
+            // The pool cancels its refill when cleared or destroyed, so a cancelled refill must not touch it
+            if (!token.isCancelled())
+            {
+                onGenerated(std::move(field));
+            }
+        });
+}
+
+void BoardPool::onGenerated(std::unique_ptr<MineField> field)
+{
+    _refilling = false;
+    if (field)
+    {
+        _boards.push_back(std::move(field));
+    }
+    refill();
+}
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_BOARD_POOL_H
+#define WS_APP_BOARD_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "app/job_system.h"
+#include "components/mine_field.h"
+
+// Keeps a few boards of the last requested size ready, so Retry and picking the same difficulty again skip the
+// generation. Boards are refilled one at a time on a worker while the player plays, the number of boards is bounded by
+// a memory budget. Fields of finished games are recycled as storage for new boards, so restarting a big board costs
+// only the generation. Only used from the main thread.
+class BoardPool final
+{
+public:
+    BoardPool() = delete;
+    explicit BoardPool(JobSystem& jobs);
+    ~BoardPool();
+
+    BoardPool(const BoardPool&)                    = delete;
+    auto operator=(const BoardPool&) -> BoardPool& = delete;
+
+    // Takes a ready board, nullptr if there is none. Boards of other dimensions are dropped and the pool starts
+    // refilling for the requested ones.
+    [[nodiscard]] auto take(int width, int height, int bombCount) -> std::unique_ptr<MineField>;
+    // Hands back the field of a finished game so its tile storage can be reused
+    void recycle(std::unique_ptr<MineField> field);
+    // Recycled field to generate into, nullptr if there is none
+    [[nodiscard]] auto takeStorage() -> std::unique_ptr<MineField>;
+
+    // Drops all boards and stops the running refill, recycled storage is kept
+    void clear();
+
+    [[nodiscard]] auto getReadyCount() const -> std::size_t;
+private:
+    void refill();
+    void onGenerated(std::unique_ptr<MineField> field);
+private:
+    JobSystem& _jobs;
+
+    int         _width;
+    int         _height;
+    int         _bombCount;
+    std::size_t _capacity;
+
+    std::vector<std::unique_ptr<MineField>> _boards;
+    std::vector<std::unique_ptr<MineField>> _storage;
+    CancellationToken                       _refillToken;
+    bool                                    _refilling;
+};
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "frame_scheduler.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "app/game_clock.h"
+
+constexpr double DEFAULT_FRAME_TIME = 1.0 / 60.0;
+constexpr double VSYNC_MARGIN       = 0.002;  // Left for EndDrawing() and the driver
+constexpr double MIN_BUDGET         = 0.0005; // Work still makes progress when a frame is already late
+
+FrameSliceAwaiter::FrameSliceAwaiter(FrameScheduler& frames)
+    : _frames(&frames)
+{}
+
+auto FrameSliceAwaiter::await_ready() const noexcept -> bool
+{
+    return false;
+}
+
+void FrameSliceAwaiter::await_suspend(const Task::Handle handle) const
+{
+    _frames->_waiting.push_back(handle);
+}
+
+FrameScheduler::FrameScheduler(const GameClock& clock)
+    : _clock(clock)
+    , _frameStart(0.0)
+    , _deadline(0.0)
+    , _sliceDeadline(0.0)
+    , _flushing(false)
+    , _budget(0.0)
+    , _usedTime(0.0)
+    , _work()
+    , _waiting()
+    , _resuming()
+{}
+
+void FrameScheduler::add(std::function<bool()> step, CancellationToken token)
+{
+    _work.push_back({std::move(step), std::move(token)});
+}
+
+auto FrameScheduler::slice() -> FrameSliceAwaiter
+{
+    return FrameSliceAwaiter(*this);
+}
+
+void FrameScheduler::beginFrame()
+{
+    _frameStart = _clock.getTime();
+}
+
+void FrameScheduler::run(const int refreshRate)
+{
+    const double start = _clock.getTime();
+    const double frame = refreshRate > 0 ? 1.0 / refreshRate : DEFAULT_FRAME_TIME;
+
+    _budget   = std::max(frame - (start - _frameStart) - VSYNC_MARGIN, MIN_BUDGET);
+    _deadline = start + _budget;
+    runOnce();
+    _usedTime = _clock.getTime() - start;
+}
+
+void FrameScheduler::flush()
+{
+    _flushing = true;
+    while (hasWork())
+    {
+        runOnce();
+    }
+    _flushing = false;
+}
+
+auto FrameScheduler::hasWork() const -> bool
+{
+    return !_work.empty() || !_waiting.empty();
+}
+
+auto FrameScheduler::hasTimeLeft() const -> bool
+{
+    return _flushing || _clock.getTime() < _sliceDeadline;
+}
+
+auto FrameScheduler::getBudget() const -> double
+{
+    return _budget;
+}
+
+auto FrameScheduler::getUsedTime() const -> double
+{
+    return _usedTime;
+}
+
+void FrameScheduler::runOnce()
+{
+    _resuming.swap(_waiting);
+    int remaining = static_cast<int>(_resuming.size() + _work.size());
+
+    // Tasks that await slice() again go back to _waiting for the next frame
+    for (const Task::Handle handle : _resuming)
+    {
+        startSlice(remaining--);
+        if (handle.promise().token.isCancelled())
+        {
+            // The task scheduler destroys it
+            handle.promise().scheduler->schedule(handle);
+        } else
+        {
+            handle.resume();
+        }
+    }
+    _resuming.clear();
+
+    // Every piece of work gets at least one step per frame. Indices since steps may add new work.
+    for (std::size_t i = 0; i < _work.size();)
+    {
+        startSlice(remaining--);
+
+        bool running = !_work[i].token.isCancelled();
+        while (running)
+        {
+            running = _work[i].step();
+            if (!hasTimeLeft())
+            {
+                break;
+            }
+        }
+
+        if (running)
+        {
+            i++;
+        } else
+        {
+            _work.erase(_work.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+}
+
+void FrameScheduler::startSlice(const int remainingWork)
+{
+    // Fair share of what is left of the budget
+    const double now = _clock.getTime();
+    _sliceDeadline   = now + std::max(_deadline - now, 0.0) / std::max(remainingWork, 1);
+}
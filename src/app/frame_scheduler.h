@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_FRAME_SCHEDULER_H
+#define WS_APP_FRAME_SCHEDULER_H
+
+#include <functional>
+#include <vector>
+
+#include "app/task.h"
+
+class FrameScheduler;
+class GameClock;
+
+// Resumes the task in the spare time of a frame, it should keep working while FrameScheduler::hasTimeLeft()
+class FrameSliceAwaiter final
+{
+public:
+    explicit FrameSliceAwaiter(FrameScheduler& frames);
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool;
+    void               await_suspend(Task::Handle handle) const;
+    void               await_resume() const noexcept {}
+private:
+    FrameScheduler* _frames;
+};
+
+// Main thread work that has to run on the render thread, like texture uploads, but must not make a frame miss its
+// VSync. Once update and render are done the time left until the next VSync is split between all registered work.
+class FrameScheduler final
+{
+public:
+    FrameScheduler() = delete;
+    explicit FrameScheduler(const GameClock& clock);
+
+    // Calls step in the spare time of every frame until it returns false
+    void add(std::function<bool()> step, CancellationToken token = {});
+    [[nodiscard]] auto slice() -> FrameSliceAwaiter;
+
+    // Called by the main loop
+    void beginFrame();
+    // Runs the registered work until the frame budget is used up, called after rendering right before the frame ends.
+    // The budget is derived from the refresh rate, 0 if unknown.
+    void run(int refreshRate);
+    // Runs all work to completion regardless of the budget, used outside of the main loop
+    void flush();
+
+    [[nodiscard]] auto hasWork() const -> bool;
+    // Checked by work between its steps
+    [[nodiscard]] auto hasTimeLeft() const -> bool;
+
+    // Budget of the last frame in seconds
+    [[nodiscard]] auto getBudget() const -> double;
+    [[nodiscard]] auto getUsedTime() const -> double;
+private:
+    friend class FrameSliceAwaiter;
+
+    struct Work
+    {
+        std::function<bool()> step;
+        CancellationToken     token;
+    };
+
+    void runOnce();
+    void startSlice(int remainingWork);
+private:
+    const GameClock& _clock;
+
+    double _frameStart;
+    double _deadline;
+    double _sliceDeadline;
+    bool   _flushing;
+
+    double _budget;
+    double _usedTime;
+
+    std::vector<Work>         _work;
+    std::vector<Task::Handle> _waiting;
+    std::vector<Task::Handle> _resuming; // Swapped with _waiting so both keep their capacity
+};
+
+#endif
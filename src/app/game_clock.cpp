@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "game_clock.h"
+
+#include <algorithm>
+#include <raylib.h>
+
+GameClock::GameClock()
+    : _fixedStep(0.0)
+    , _frameTime(0.0)
+    , _frameStart(Clock::now())
+{}
+
+void GameClock::setFixedStep(const double step)
+{
+    // Continues from the current time, so nothing waiting on the clock jumps
+    _frameTime  = getTime();
+    _frameStart = Clock::now();
+    _fixedStep  = std::max(step, 0.0);
+}
+
+void GameClock::beginFrame()
+{
+    if (_fixedStep > 0.0)
+    {
+        // A frame slower than the step pushes the following ones back, time never runs backwards
+        _frameTime  = std::max(_frameTime + _fixedStep, getTime());
+        _frameStart = Clock::now();
+    }
+}
+
+auto GameClock::getTime() const -> double
+{
+    if (_fixedStep > 0.0)
+    {
+        return _frameTime + std::chrono::duration<double>(Clock::now() - _frameStart).count();
+    }
+    return GetTime();
+}
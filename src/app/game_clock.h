@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_GAME_CLOCK_H
+#define WS_APP_GAME_CLOCK_H
+
+#include <chrono>
+
+// Time of the main loop in seconds, everything that times the game reads it instead of raylib. Follows raylib's timer
+// unless a fixed step is set: then every frame starts one step after the last one, so headless runs see time pass
+// like the game at that frame rate no matter how fast they run. Real time still passes within a frame, so frame
+// budgets are measured the same either way.
+class GameClock final
+{
+public:
+    GameClock();
+
+    // 0 follows raylib's timer again
+    void setFixedStep(double step);
+
+    // Called by the main loop at the start of every frame
+    void               beginFrame();
+    [[nodiscard]] auto getTime() const -> double;
+private:
+    using Clock = std::chrono::steady_clock;
+
+    double            _fixedStep;
+    double            _frameTime; // Fixed step time of the current frame
+    Clock::time_point _frameStart;
+};
+
+#endif
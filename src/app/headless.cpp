@@ -0,0 +1,582 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "headless.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <random>
+#include <raylib.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "app/job_system.h"
+#include "components/frame_arena.h"
+#include "components/game_rules.h"
+#include "components/mine_field.h"
+#include "components/mine_solver.h"
+#include "diagnostics/flight_recorder.h"
+#include "diagnostics/logger.h"
+
+#ifdef WS_NULL_RENDER
+#    include "app/wyrmsweeper.h"
+#    include "input/scripted_input.h"
+#    include "render/null_render_backend.h"
+#    include "screens/game_screen.h"
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct RecordedAction
+{
+    double       time;
+    FlightAction action;
+    int          row;
+    int          column;
+    bool         autoChord;
+};
+
+struct RecordedBoard
+{
+    int          width;
+    int          height;
+    int          bombCount;
+    unsigned int seed;
+
+    std::vector<RecordedAction> actions;
+};
+
+auto getSeconds(const Clock::time_point start) -> double
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+auto isValidBoard(const int width, const int height, const int bombCount) -> bool
+{
+    // MineField limits
+    return width > 0 && width < 999 && height > 0 && height < 999 && bombCount > 0 && bombCount < width * height;
+}
+
+auto readLine(std::FILE* file, std::string& line) -> bool
+{
+    line.clear();
+    int character = 0;
+    while ((character = std::fgetc(file)) != EOF && character != '\n')
+    {
+        line += static_cast<char>(character);
+    }
+    return character != EOF || !line.empty();
+}
+
+auto readBoards(const std::string& path, std::vector<RecordedBoard>& boards) -> bool
+{
+    std::FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "Failed to open %s\n", path.c_str());
+        return false;
+    }
+
+    std::string line;
+    int         lineNumber = 0;
+    bool        valid      = true;
+    bool        autoChord  = false;
+    while (valid && readLine(file, line))
+    {
+        lineNumber++;
+
+        double         time = 0.0;
+        char           button[8]{};
+        int            flag = 0;
+        RecordedBoard  board{};
+        RecordedAction action{};
+        // The auto chord flag is optional, generated boards have none. It applies to the following actions until an
+        // auto-chord line changes it.
+        if (const int fields = std::sscanf(line.c_str(), "board %lf %i %i %i %u %i", &time, &board.width,
+                                           &board.height, &board.bombCount, &board.seed, &flag);
+            fields >= 5)
+        {
+            valid     = isValidBoard(board.width, board.height, board.bombCount);
+            autoChord = flag != 0;
+            boards.push_back(std::move(board));
+        } else if (std::sscanf(line.c_str(), "truncated %i", &flag) == 1)
+        {
+            // The recorder lost the first actions of the board, replaying the rest would diverge
+            std::fprintf(stderr, "%s:%i: %i actions of the board were not recorded\n", path.c_str(), lineNumber,
+                         flag);
+            std::fclose(file);
+            return false;
+        } else if (std::sscanf(line.c_str(), "auto-chord %lf %i", &time, &flag) == 2)
+        {
+            valid     = !boards.empty();
+            autoChord = flag != 0;
+        } else if (std::sscanf(line.c_str(), "action %lf %7s %i %i", &action.time, button, &action.row,
+                               &action.column) == 4)
+        {
+            action.action = std::string_view(button) == "right" ? FlightAction::RightClick : FlightAction::LeftClick;
+            valid         = !boards.empty() && action.row >= 0 && action.row < boards.back().height &&
+                    action.column >= 0 && action.column < boards.back().width;
+            if (valid)
+            {
+                action.autoChord = autoChord;
+                boards.back().actions.push_back(action);
+            }
+        }
+    }
+    std::fclose(file);
+
+    if (!valid)
+    {
+        std::fprintf(stderr, "%s:%i: invalid board or action\n", path.c_str(), lineNumber);
+    }
+    return valid;
+}
+
+// Boards of the options, numbered from the seed
+auto makeBoards(const LaunchOptions& options) -> std::vector<RecordedBoard>
+{
+    const unsigned int         seed = options.seed.value_or(std::random_device()());
+    std::vector<RecordedBoard> boards;
+    boards.reserve(static_cast<std::size_t>(std::max(options.boardCount, 0)));
+    for (int i = 0; i < options.boardCount; i++)
+    {
+        boards.push_back({options.boardWidth, options.boardHeight, options.boardBombCount,
+                          seed + static_cast<unsigned int>(i), {}});
+    }
+    return boards;
+}
+
+// Splits the boards into chunks for the workers, every chunk reuses one field and arena
+template <typename Function>
+void forEachBoard(JobSystem& jobs, const std::vector<RecordedBoard>& boards, Function function)
+{
+    const std::size_t chunkCount = std::clamp<std::size_t>(4 * jobs.getThreadCount(), 1, boards.size());
+
+    std::vector<std::future<void>> chunks;
+    for (std::size_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        chunks.push_back(jobs.submit([&boards, &function, chunk, chunkCount] {
+            FrameArena                 arena;
+            std::unique_ptr<MineField> field;
+            for (std::size_t i = chunk * boards.size() / chunkCount; i < (chunk + 1) * boards.size() / chunkCount;
+                 i++)
+            {
+                const RecordedBoard& board = boards[i];
+                if (!field)
+                {
+                    field = std::make_unique<MineField>(MineField::Uninitialized{}, board.width, board.height,
+                                                        board.bombCount);
+                }
+                field->reset(board.width, board.height, board.bombCount, board.seed);
+                arena.reset();
+                function(i, *field, arena);
+            }
+        }));
+    }
+    for (std::future<void>& chunk : chunks)
+    {
+        chunk.get();
+    }
+}
+
+auto generate(const LaunchOptions& options, JobSystem& jobs) -> int
+{
+    const std::vector<RecordedBoard> boards = makeBoards(options);
+    std::vector<std::string>         tiles(boards.size());
+
+    const Clock::time_point start = Clock::now();
+    forEachBoard(jobs, boards, [&tiles](const std::size_t i, const MineField& field, FrameArena& /*arena*/) {
+        tiles[i] = field.encodeTiles();
+    });
+    const double duration = getSeconds(start);
+
+    std::FILE* file = std::fopen(options.commandFile.c_str(), "w");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "Failed to write %s\n", options.commandFile.c_str());
+        return 1;
+    }
+    std::fputs("# Wyrmsweeper boards, tiles are run length encoded: a to i for 0 to 8, x for bombs, / ends a row\n",
+               file);
+    for (std::size_t i = 0; i < boards.size(); i++)
+    {
+        const RecordedBoard& board = boards[i];
+        std::fprintf(file, "board 0.000 %i %i %i %u\ntiles %s\n", board.width, board.height, board.bombCount,
+                     board.seed, tiles[i].c_str());
+    }
+    std::fclose(file);
+
+    std::printf("Generated %zu boards in %.3f s\n", boards.size(), duration);
+    return 0;
+}
+
+auto solve(const LaunchOptions& options, JobSystem& jobs) -> int
+{
+    std::vector<RecordedBoard> boards;
+    if (options.commandFile.empty())
+    {
+        boards = makeBoards(options);
+    } else if (!readBoards(options.commandFile, boards))
+    {
+        return 1;
+    }
+
+    std::vector<SolveResult> results(boards.size());
+
+    const Clock::time_point start = Clock::now();
+    forEachBoard(jobs, boards, [&results](const std::size_t i, MineField& field, FrameArena& arena) {
+        results[i] = MineSolver::solve(field, arena);
+    });
+    const double duration = getSeconds(start);
+
+    int wins    = 0;
+    int clicks  = 0;
+    int guesses = 0;
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        const SolveResult& result = results[i];
+        wins += result.state == GameState::Won ? 1 : 0;
+        clicks += result.clicks;
+        guesses += result.guesses;
+        if (results.size() == 1)
+        {
+            std::printf("Board %ix%i with %i bombs, seed %u: %s after %i clicks, %i flags and %i guesses\n",
+                        boards[i].width, boards[i].height, boards[i].bombCount, boards[i].seed,
+                        result.state == GameState::Won ? "won" : "lost", result.clicks, result.flags, result.guesses);
+        }
+    }
+
+    const auto count = static_cast<double>(std::max<std::size_t>(results.size(), 1));
+    std::printf("Solved %zu boards in %.3f s (%.0f boards/s)\n", results.size(), duration,
+                static_cast<double>(results.size()) / std::max(duration, 1e-9));
+    std::printf("%i won (%.1f%%), %.2f clicks and %.2f guesses per board\n", wins, 100.0 * wins / count,
+                clicks / count, guesses / count);
+    return 0;
+}
+
+auto replay(const LaunchOptions& options) -> int
+{
+    std::vector<RecordedBoard> boards;
+    if (!readBoards(options.commandFile, boards))
+    {
+        return 1;
+    }
+
+    FrameArena arena;
+    GameRules  rules(arena);
+    for (const RecordedBoard& board : boards)
+    {
+        MineField field(MineField::Uninitialized{}, board.width, board.height, board.bombCount);
+        field.reset(board.width, board.height, board.bombCount, board.seed);
+        arena.reset();
+        rules.start(field);
+
+        // Every action is timed on its own to find the one behind a hitch
+        double      total         = 0.0;
+        double      slowest       = 0.0;
+        std::size_t slowestAction = 0;
+        for (std::size_t i = 0; i < board.actions.size(); i++)
+        {
+            const RecordedAction& action = board.actions[i];
+            rules.setAutoChord(action.autoChord);
+
+            const Clock::time_point start = Clock::now();
+            if (action.action == FlightAction::LeftClick)
+            {
+                rules.leftClick(action.row, action.column);
+            } else
+            {
+                rules.rightClick(action.row, action.column);
+            }
+            const double duration = getSeconds(start);
+
+            total += duration;
+            if (duration > slowest)
+            {
+                slowest       = duration;
+                slowestAction = i;
+            }
+        }
+
+        const char* state = rules.getState() == GameState::Won        ? "won"
+                            : rules.getState() == GameState::Exploded ? "lost"
+                                                                      : "still playing";
+        std::printf("Board %ix%i with %i bombs, seed %u: %zu actions, %s\n", board.width, board.height, board.bombCount,
+                    board.seed, board.actions.size(), state);
+        if (!board.actions.empty())
+        {
+            const RecordedAction& action = board.actions[slowestAction];
+            std::printf("    %.3f us per action, slowest %.3f us: %s click at row %i, column %i (recorded at %.3f s)\n",
+                        total * 1e6 / static_cast<double>(board.actions.size()), slowest * 1e6,
+                        action.action == FlightAction::LeftClick ? "left" : "right", action.row, action.column,
+                        action.time);
+        }
+    }
+    return 0;
+}
+
+template <typename Function>
+void runBenchmark(const char* name, const int iterations, Function function)
+{
+    // One untimed run warms up caches and grows the arena
+    function(0);
+
+    const Clock::time_point start = Clock::now();
+    for (int i = 1; i <= iterations; i++)
+    {
+        function(i);
+    }
+    const double duration = getSeconds(start);
+
+    std::printf("%-32s %8i runs %10.3f ms %12.3f us/run\n", name, iterations, duration * 1000.0,
+                duration * 1e6 / iterations);
+}
+
+auto bench(const LaunchOptions& options) -> int
+{
+    const unsigned int seed = options.seed.value_or(0);
+
+    struct BoardSize
+    {
+        const char* name;
+        int         width;
+        int         height;
+        int         bombCount;
+        int         generateRuns;
+        int         solveRuns; // The solver rescans the whole field after every guess, too slow for huge fields
+    };
+    constexpr BoardSize SIZES[] = {
+        {"easy 9x9", 9, 9, 10, 20000, 5000},
+        {"hard 30x16", 30, 16, 99, 5000, 1000},
+        {"huge 998x998", 998, 998, 150000, 5, 0},
+    };
+
+    FrameArena arena;
+    for (const BoardSize& size : SIZES)
+    {
+        MineField field(MineField::Uninitialized{}, size.width, size.height, size.bombCount);
+
+        runBenchmark(TextFormat("generate %s", size.name), size.generateRuns, [&](const int i) {
+            field.reset(size.width, size.height, size.bombCount, seed + static_cast<unsigned int>(i));
+        });
+        if (size.solveRuns > 0)
+        {
+            runBenchmark(TextFormat("solve %s", size.name), size.solveRuns, [&](const int i) {
+                field.reset(size.width, size.height, size.bombCount, seed + static_cast<unsigned int>(i));
+                arena.reset();
+                (void)MineSolver::solve(field, arena);
+            });
+        }
+    }
+
+    // Worst case of the flood fill, a single click opens almost the whole field
+    MineField field(MineField::Uninitialized{}, 998, 998, 1);
+    GameRules rules(arena);
+    runBenchmark("flood fill 998x998", 10, [&](const int i) {
+        field.reset(998, 998, 1, seed + static_cast<unsigned int>(i));
+        arena.reset();
+        rules.start(field);
+        // A single bomb can not touch two opposite corners
+        const int corner = field.getTile(0, 0).number == 0 ? 0 : 997;
+        rules.leftClick(corner, corner);
+    });
+    return 0;
+}
+
+#ifdef WS_NULL_RENDER
+constexpr int    BENCH_SCREEN_WIDTH      = 1280;
+constexpr int    BENCH_SCREEN_HEIGHT     = 720;
+constexpr double BENCH_FRAME_TIME        = 1.0 / 60.0;
+constexpr int    BENCH_WARMUP_FRAMES     = 10;
+constexpr int    BENCH_MAX_SETTLE_FRAMES = 100000;
+
+// Runs frames until the work started by the last screen change is done, so the field generation is not measured
+void settle(Wyrmsweeper& game)
+{
+    for (int i = 0; i < BENCH_MAX_SETTLE_FRAMES; i++)
+    {
+        game.runFrame();
+        if (i >= BENCH_WARMUP_FRAMES && !game.getJobSystem().isBusy() && !game.getTaskScheduler().hasReadyTasks())
+        {
+            return;
+        }
+    }
+}
+
+template <typename Function>
+void benchFrames(const char* name, Wyrmsweeper& game, const NullRenderBackend& renderer, const int frameCount,
+                 Function beforeFrame)
+{
+    settle(game);
+
+    std::vector<double> durations;
+    durations.reserve(static_cast<std::size_t>(frameCount));
+    double update = 0.0;
+    double render = 0.0;
+    double field  = 0.0;
+    double gui    = 0.0;
+
+    const RenderCounters before = renderer.getCounters();
+    for (int i = 0; i < frameCount; i++)
+    {
+        beforeFrame(i);
+
+        const Clock::time_point start = Clock::now();
+        game.runFrame();
+        durations.push_back(getSeconds(start));
+
+        const FrameTimings& timings = game.getFrameStats().getLastFrame();
+        update += timings.phases[static_cast<std::size_t>(FramePhase::Update)];
+        render += timings.phases[static_cast<std::size_t>(FramePhase::Render)];
+        field += timings.phases[static_cast<std::size_t>(FramePhase::Field)];
+        gui += timings.phases[static_cast<std::size_t>(FramePhase::Gui)];
+    }
+    const RenderCounters& after = renderer.getCounters();
+
+    std::sort(durations.begin(), durations.end());
+    const auto frames     = static_cast<double>(frameCount);
+    const auto percentile = [&durations](const double rank) {
+        return durations[static_cast<std::size_t>(rank * static_cast<double>(durations.size() - 1))] * 1e6;
+    };
+    double total = 0.0;
+    for (const double duration : durations)
+    {
+        total += duration;
+    }
+
+    std::printf("%-24s %8i frames %10.3f us/frame   p50 %10.3f   p99 %10.3f   max %10.3f\n", name, frameCount,
+                total * 1e6 / frames, percentile(0.5), percentile(0.99), durations.back() * 1e6);
+    std::printf("%-24s update %.3f us   render %.3f us   field %.3f us   gui %.3f us\n", "", update * 1e6 / frames,
+                render * 1e6 / frames, field * 1e6 / frames, gui * 1e6 / frames);
+    std::printf("%-24s %.1f draw calls   %.1f quads   %.1f texture binds per frame\n", "",
+                static_cast<double>(after.drawCalls - before.drawCalls) / frames,
+                static_cast<double>(after.quads - before.quads) / frames,
+                static_cast<double>(after.textureBinds - before.textureBinds) / frames);
+}
+
+auto benchRender(const LaunchOptions& options) -> int
+{
+    if (options.frameCount < 1)
+    {
+        std::fprintf(stderr, "Invalid frame count %i\n", options.frameCount);
+        return 1;
+    }
+
+    auto               backend  = std::make_unique<NullRenderBackend>(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT);
+    NullRenderBackend& renderer = *backend;
+    auto               input    = std::make_unique<ScriptedInput>();
+    ScriptedInput&     script   = *input;
+
+    // Timers, delays and frame budgets see 60 frames per second of game time, like on a 60 Hz display
+    Wyrmsweeper game;
+    game.getClock().setFixedStep(BENCH_FRAME_TIME);
+    game.setInputProvider(std::move(input));
+    game.startHeadless(options, std::move(backend));
+
+    benchFrames("title screen", game, renderer, options.frameCount, [](int) {});
+
+    // Flags toggled all over the screen dirty the field every other frame. Left clicks would end the game early.
+    std::mt19937                          random(options.seed.value_or(0));
+    std::uniform_real_distribution<float> positionX(0.F, static_cast<float>(BENCH_SCREEN_WIDTH));
+    std::uniform_real_distribution<float> positionY(0.F, static_cast<float>(BENCH_SCREEN_HEIGHT));
+
+    const auto clickStorm = [&](const int frame) {
+        if (frame % 2 == 0)
+        {
+            script.click({positionX(random), positionY(random)}, MOUSE_BUTTON_RIGHT);
+        }
+    };
+
+    for (const bool shader : {true, false})
+    {
+        const std::string name = "game " + std::to_string(options.boardWidth) + "x" +
+                                 std::to_string(options.boardHeight) + (shader ? " shader" : " tiles");
+
+        game.getShaderRenderingSetting() = shader;
+        game.setScreen(
+            std::make_unique<GameScreen>(&game, options.boardWidth, options.boardHeight, options.boardBombCount));
+        benchFrames(name.c_str(), game, renderer, options.frameCount, clickStorm);
+    }
+
+    game.stopHeadless();
+    return 0;
+}
+#endif
+
+} // namespace
+
+auto runHeadlessCommand(const LaunchOptions& options) -> int
+{
+    // Only problems are worth printing between the results
+    SetTraceLogLevel(LOG_WARNING);
+    Logger::setLevel(LOG_WARNING);
+
+    if (!isValidBoard(options.boardWidth, options.boardHeight, options.boardBombCount) || options.boardCount < 1)
+    {
+        std::fprintf(stderr, "Invalid board %ix%i with %i bombs or count %i\n", options.boardWidth,
+                     options.boardHeight, options.boardBombCount, options.boardCount);
+        return 1;
+    }
+
+    if (options.command == HeadlessCommand::BenchRender)
+    {
+#ifdef WS_NULL_RENDER
+        return benchRender(options);
+#else
+        std::fprintf(stderr, "--bench-render needs a build configured with -DWS_NULL_RENDER=ON\n");
+        return 1;
+#endif
+    }
+
+    JobSystem jobs;
+    jobs.start(options.threadCount);
+
+    int result = 0;
+    switch (options.command)
+    {
+    case HeadlessCommand::Generate:
+        result = generate(options, jobs);
+        break;
+    case HeadlessCommand::Bench:
+        result = bench(options);
+        break;
+    case HeadlessCommand::Solve:
+        result = solve(options, jobs);
+        break;
+    case HeadlessCommand::Replay:
+        result = replay(options);
+        break;
+    case HeadlessCommand::BenchRender:
+    case HeadlessCommand::None:
+        break;
+    }
+
+    jobs.stop();
+    return result;
+}
@@ -0,0 +1,222 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "job_system.h"
+
+#include <algorithm>
+#include <cassert>
+#include <raylib.h>
+
+#include "diagnostics/metrics.h"
+#include "diagnostics/profiler.h"
+
+namespace {
+
+// Queue of the worker running on this thread, -1 on the main thread
+thread_local int t_workerIndex = -1;
+
+} // namespace
+
+CancellationToken::CancellationToken()
+    : _cancelled(std::make_shared<std::atomic<bool>>(false))
+{}
+
+void CancellationToken::cancel() const
+{
+    _cancelled->store(true, std::memory_order_relaxed);
+}
+
+auto CancellationToken::isCancelled() const -> bool
+{
+    return _cancelled->load(std::memory_order_relaxed);
+}
+
+JobSystem::JobSystem()
+    : _queues()
+    , _workers()
+    , _nextQueue(0)
+    , _activeJobs(0)
+    , _stopping(false)
+{}
+
+JobSystem::~JobSystem()
+{
+    stop();
+}
+
+void JobSystem::start(unsigned int threadCount)
+{
+    assert(_workers.empty());
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+    }
+
+    _stopping = false;
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        _queues.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        _workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+
+    TraceLog(LOG_INFO, "Started %u worker threads", threadCount);
+}
+
+void JobSystem::stop()
+{
+    {
+        const std::scoped_lock lock(_sleepMutex);
+        _stopping = true;
+    }
+    _wakeUp.notify_all();
+
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+    _workers.clear();
+    _queues.clear();
+
+    // Continuations of the last jobs are dropped, nothing drains them anymore
+    const std::scoped_lock lock(_mainThreadMutex);
+    _mainThreadJobs.clear();
+}
+
+void JobSystem::runMainThreadJobs()
+{
+    std::vector<Job> jobs;
+    {
+        const std::scoped_lock lock(_mainThreadMutex);
+        jobs.swap(_mainThreadJobs);
+    }
+
+    // Continuations may queue new ones, those run next frame
+    for (const Job& job : jobs)
+    {
+        job();
+    }
+}
+
+auto JobSystem::hasMainThreadJobs() const -> bool
+{
+    const std::scoped_lock lock(_mainThreadMutex);
+    return !_mainThreadJobs.empty();
+}
+
+auto JobSystem::isBusy() const -> bool
+{
+    return _activeJobs.load() > 0 || hasMainThreadJobs();
+}
+
+auto JobSystem::getThreadCount() const -> unsigned int
+{
+    return static_cast<unsigned int>(_workers.size());
+}
+
+void JobSystem::push(Job job)
+{
+    assert(!_queues.empty() && "JobSystem::start() has to be called first");
+
+    // Workers push to their own queue so nested jobs stay local, everyone else spreads them round robin
+    const auto queueCount = static_cast<unsigned int>(_queues.size());
+    const auto index      = t_workerIndex >= 0 ? static_cast<unsigned int>(t_workerIndex) : _nextQueue++ % queueCount;
+
+    _activeJobs++;
+    {
+        const std::scoped_lock lock(_queues[index]->mutex);
+        _queues[index]->jobs.push_back(std::move(job));
+    }
+    {
+        // Taking the lock makes sure a worker about to sleep does not miss the notification
+        const std::scoped_lock lock(_sleepMutex);
+    }
+    _wakeUp.notify_one();
+}
+
+auto JobSystem::pop(const unsigned int worker, Job& job) -> bool
+{
+    // Own queue first, newest job while it is still hot in the cache
+    {
+        Queue&                 queue = *_queues[worker];
+        const std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest job of another worker
+    const auto queueCount = static_cast<unsigned int>(_queues.size());
+    for (unsigned int i = 1; i < queueCount; i++)
+    {
+        Queue&                 queue = *_queues[(worker + i) % queueCount];
+        const std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::workerLoop(const unsigned int worker)
+{
+    t_workerIndex = static_cast<int>(worker);
+    WS_PROFILE_THREAD("Worker");
+
+    while (true)
+    {
+        Job job;
+        if (pop(worker, job))
+        {
+            {
+                WS_PROFILE_SCOPE("Job");
+                job();
+            }
+            Metrics::add(Metric::JobsRun);
+            _activeJobs--;
+            continue;
+        }
+
+        // All queues are empty, jobs still running elsewhere push their follow-ups to their own queue
+        std::unique_lock lock(_sleepMutex);
+        if (_stopping)
+        {
+            break;
+        }
+        _wakeUp.wait(lock, [this] {
+            return _stopping || std::any_of(_queues.begin(), _queues.end(), [](const std::unique_ptr<Queue>& queue) {
+                       const std::scoped_lock queueLock(queue->mutex);
+                       return !queue->jobs.empty();
+                   });
+        });
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_JOB_SYSTEM_H
+#define WS_APP_JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Move-only type erased callable, std::function requires copyable targets
+class Job final
+{
+public:
+    Job() = default;
+
+    template <typename Function>
+    Job(Function function) // NOLINT
+        : _callable(std::make_unique<Callable<Function>>(std::move(function)))
+    {}
+
+    void operator()() const
+    {
+        _callable->invoke();
+    }
+private:
+    struct CallableBase
+    {
+        virtual ~CallableBase() = default;
+        virtual void invoke()   = 0;
+    };
+
+    template <typename Function>
+    struct Callable final : CallableBase
+    {
+        explicit Callable(Function&& function)
+            : function(std::move(function))
+        {}
+
+        void invoke() override
+        {
+            function();
+        }
+
+        Function function;
+    };
+
+    std::unique_ptr<CallableBase> _callable;
+};
+
+// Shared flag that tells running jobs to stop early. Copies refer to the same flag.
+class CancellationToken final
+{
+public:
+    CancellationToken();
+
+    void               cancel() const;
+    [[nodiscard]] auto isCancelled() const -> bool;
+private:
+    std::shared_ptr<std::atomic<bool>> _cancelled;
+};
+
+// Work-stealing thread pool. Every worker owns a queue and steals from the others once it runs dry. Results can be
+// waited on through futures or handed to a continuation that runs on the main thread at the next frame boundary.
+class JobSystem final
+{
+public:
+     JobSystem();
+    ~JobSystem();
+
+    JobSystem(const JobSystem&)                    = delete;
+    auto operator=(const JobSystem&) -> JobSystem& = delete;
+
+    // 0 threads uses one worker per hardware thread besides the main thread
+    void start(unsigned int threadCount = 0);
+    // Finishes all queued jobs and joins the workers
+    void stop();
+
+    template <typename Function>
+    [[nodiscard]] auto submit(Function function) -> std::future<std::invoke_result_t<Function>>;
+
+    // Runs function on a worker and passes its result to continuation on the main thread
+    template <typename Function, typename Continuation>
+    void submit(Function function, Continuation continuation);
+
+    // Runs function on a worker without any way to wait for it
+    template <typename Function>
+    void dispatch(Function function);
+
+    template <typename Function>
+    void runOnMainThread(Function function);
+
+    // Runs the queued main thread continuations, called once per frame by the main loop
+    void runMainThreadJobs();
+
+    [[nodiscard]] auto hasMainThreadJobs() const -> bool;
+    // True while any job or continuation is unfinished
+    [[nodiscard]] auto isBusy() const -> bool;
+    [[nodiscard]] auto getThreadCount() const -> unsigned int;
+private:
+    void push(Job job);
+    [[nodiscard]] auto pop(unsigned int worker, Job& job) -> bool;
+
+    void workerLoop(unsigned int worker);
+private:
+    struct Queue
+    {
+        std::mutex      mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread>            _workers;
+    std::atomic<unsigned int>           _nextQueue;
+    std::atomic<int>                    _activeJobs; // Queued or running
+
+    std::mutex              _sleepMutex;
+    std::condition_variable _wakeUp;
+    bool                    _stopping;
+
+    mutable std::mutex _mainThreadMutex;
+    std::vector<Job>   _mainThreadJobs;
+};
+
+template <typename Function>
+auto JobSystem::submit(Function function) -> std::future<std::invoke_result_t<Function>>
+{
+    std::packaged_task<std::invoke_result_t<Function>()> task(std::move(function));
+    auto                                                 future = task.get_future();
+
+    push(std::move(task));
+    return future;
+}
+
+template <typename Function, typename Continuation>
+void JobSystem::submit(Function function, Continuation continuation)
+{
+    push([this, function = std::move(function), continuation = std::move(continuation)]() mutable {
+        if constexpr (std::is_void_v<std::invoke_result_t<Function>>)
+        {
+            function();
+            runOnMainThread(std::move(continuation));
+        } else
+        {
+            runOnMainThread([continuation = std::move(continuation), result = function()]() mutable {
+                continuation(std::move(result));
+            });
+        }
+    });
+}
+
+template <typename Function>
+void JobSystem::dispatch(Function function)
+{
+    push(std::move(function));
+}
+
+template <typename Function>
+void JobSystem::runOnMainThread(Function function)
+{
+    const std::scoped_lock lock(_mainThreadMutex);
+    _mainThreadJobs.emplace_back(std::move(function));
+}
+
+#endif
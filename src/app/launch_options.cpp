@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "launch_options.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+auto parseLaunchOptions(const int argc, char** argv) -> LaunchOptions
+{
+    LaunchOptions options{};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view argument(argv[i]);
+
+        if (argument == "--theme" && i + 1 < argc)
+        {
+            options.themePack = argv[++i];
+        } else if (argument == "--threads" && i + 1 < argc)
+        {
+            options.threadCount = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (argument == "--record" && i + 1 < argc)
+        {
+            options.recordDirectory = argv[++i];
+        } else if (argument == "--hitch-ms" && i + 1 < argc)
+        {
+            options.hitchThreshold = std::strtod(argv[++i], nullptr) / 1000.0;
+        } else if (argument == "--metrics" && i + 1 < argc)
+        {
+            options.metricsTarget = argv[++i];
+        } else if (argument == "--input-script" && i + 1 < argc)
+        {
+            options.inputScript = argv[++i];
+        } else if (argument == "--record-input" && i + 1 < argc)
+        {
+            options.inputRecording = argv[++i];
+        } else if (argument == "--generate" && i + 1 < argc)
+        {
+            options.command     = HeadlessCommand::Generate;
+            options.commandFile = argv[++i];
+        } else if (argument == "--bench")
+        {
+            options.command = HeadlessCommand::Bench;
+        } else if (argument == "--bench-render")
+        {
+            options.command = HeadlessCommand::BenchRender;
+        } else if (argument == "--solve")
+        {
+            // Without a file random boards are solved
+            options.command = HeadlessCommand::Solve;
+            if (i + 1 < argc && std::string_view(argv[i + 1]).substr(0, 2) != "--")
+            {
+                options.commandFile = argv[++i];
+            }
+        } else if (argument == "--replay" && i + 1 < argc)
+        {
+            options.command     = HeadlessCommand::Replay;
+            options.commandFile = argv[++i];
+        } else if (argument == "--board" && i + 1 < argc)
+        {
+            if (std::sscanf(argv[++i], "%ix%ix%i", &options.boardWidth, &options.boardHeight,
+                            &options.boardBombCount) != 3)
+            {
+                std::fprintf(stderr, "Expected <width>x<height>x<bombs> instead of '%s'\n", argv[i]);
+            }
+        } else if (argument == "--count" && i + 1 < argc)
+        {
+            options.boardCount = std::atoi(argv[++i]);
+        } else if (argument == "--frames" && i + 1 < argc)
+        {
+            options.frameCount = std::atoi(argv[++i]);
+        } else if (argument == "--seed" && i + 1 < argc)
+        {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else
+        {
+            std::fprintf(stderr, "Ignoring unknown argument '%s'\n", argv[i]);
+        }
+    }
+    return options;
+}
@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_LAUNCH_OPTIONS_H
+#define WS_APP_LAUNCH_OPTIONS_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+// Engine work without a window, see runHeadlessCommand()
+enum class HeadlessCommand : uint8_t
+{
+    None = 0,
+    Generate,   // --generate <file>
+    Bench,      // --bench
+    Solve,      // --solve [file]
+    Replay,     // --replay <file>
+    BenchRender // --bench-render, needs a build with WS_NULL_RENDER
+};
+
+struct LaunchOptions
+{
+    std::string  themePack;             // --theme <file>, empty for the built in classic theme
+    unsigned int threadCount    = 0;    // --threads <count>, 0 picks one per hardware thread
+    std::string  recordDirectory;       // --record <directory>, flight recordings of slow frames are written here
+    double       hitchThreshold = 0.05; // --hitch-ms <milliseconds>, frames slower than this are recorded
+    std::string  metricsTarget;         // --metrics <file|unix:socket>, OpenMetrics export once per second
+    std::string  inputScript;           // --input-script <file>, plays the script back instead of live input
+    std::string  inputRecording;        // --record-input <file>, records the live input as a script
+
+    // Headless commands, the window only opens without one
+    HeadlessCommand             command        = HeadlessCommand::None; // One of the flags above
+    std::string                 commandFile;                            // Board file written or read by the command
+    int                         boardWidth     = 30;                    // --board <width>x<height>x<bombs>
+    int                         boardHeight    = 16;
+    int                         boardBombCount = 99;
+    int                         boardCount     = 1;                     // --count <boards>
+    int                         frameCount     = 600;                   // --frames <count> per screen benchmark
+    std::optional<unsigned int> seed;                                   // --seed <seed> of the first board
+};
+
+[[nodiscard]] auto parseLaunchOptions(int argc, char** argv) -> LaunchOptions;
+
+#endif
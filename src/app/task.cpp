@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "task.h"
+
+#include <algorithm>
+#include <cassert>
+
+auto Task::promise_type::get_return_object() -> Task
+{
+    return Task(Handle::from_promise(*this));
+}
+
+Task::Task(const Handle handle)
+    : _handle(handle)
+{}
+
+Task::Task(Task&& other) noexcept
+    : _handle(std::exchange(other._handle, nullptr))
+{}
+
+Task::~Task()
+{
+    // Only tasks that were never spawned still own their coroutine
+    if (_handle)
+    {
+        _handle.destroy();
+    }
+}
+
+TaskScheduler::TaskScheduler(JobSystem& jobs)
+    : _jobs(jobs)
+    , _ready()
+    , _resuming()
+    , _tasks()
+{}
+
+TaskScheduler::~TaskScheduler()
+{
+    destroyAll();
+}
+
+void TaskScheduler::spawn(Task task, CancellationToken token)
+{
+    const Task::Handle handle = std::exchange(task._handle, nullptr);
+    assert(handle);
+
+    handle.promise().scheduler = this;
+    handle.promise().token     = std::move(token);
+
+    _tasks.push_back(handle);
+    schedule(handle);
+}
+
+void TaskScheduler::update()
+{
+    {
+        const std::scoped_lock lock(_readyMutex);
+        _resuming.swap(_ready);
+    }
+
+    for (const Task::Handle handle : _resuming)
+    {
+        if (handle.done() || handle.promise().token.isCancelled())
+        {
+            destroy(handle);
+        } else
+        {
+            handle.resume();
+        }
+    }
+    _resuming.clear();
+}
+
+void TaskScheduler::destroyAll()
+{
+    for (const Task::Handle handle : _tasks)
+    {
+        handle.destroy();
+    }
+    _tasks.clear();
+
+    const std::scoped_lock lock(_readyMutex);
+    _ready.clear();
+}
+
+auto TaskScheduler::hasReadyTasks() const -> bool
+{
+    const std::scoped_lock lock(_readyMutex);
+    return !_ready.empty();
+}
+
+auto TaskScheduler::getTaskCount() const -> int
+{
+    return static_cast<int>(_tasks.size());
+}
+
+auto TaskScheduler::getJobSystem() -> JobSystem&
+{
+    return _jobs;
+}
+
+void TaskScheduler::schedule(const Task::Handle handle)
+{
+    const std::scoped_lock lock(_readyMutex);
+    _ready.push_back(handle);
+}
+
+void TaskScheduler::destroy(const Task::Handle handle)
+{
+    const auto task = std::find(_tasks.begin(), _tasks.end(), handle);
+    assert(task != _tasks.end());
+
+    *task = _tasks.back();
+    _tasks.pop_back();
+    handle.destroy();
+}
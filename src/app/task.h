@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_TASK_H
+#define WS_APP_TASK_H
+
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "app/job_system.h"
+
+class TaskScheduler;
+
+// Coroutine that runs across several frames, e.g.
+//
+//     auto Screen::load(CancellationToken token) -> Task
+//     {
+//         auto board = co_await background([] { return generate(); });
+//         co_await nextFrame();
+//         ...
+//     }
+//
+// A task does nothing until it is handed to TaskScheduler::spawn().
+class Task final
+{
+public:
+    struct promise_type
+    {
+        TaskScheduler*    scheduler = nullptr;
+        CancellationToken token;
+
+        auto get_return_object() -> Task;
+
+        auto initial_suspend() noexcept -> std::suspend_always
+        {
+            return {};
+        }
+        // Finished tasks go back to the scheduler, which destroys them on the main thread
+        auto final_suspend() noexcept;
+
+        void return_void() {}
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+public:
+    Task(Task&& other) noexcept;
+    ~Task();
+
+    Task(const Task&)                    = delete;
+    auto operator=(const Task&) -> Task& = delete;
+    auto operator=(Task&&) -> Task&      = delete;
+private:
+    friend class TaskScheduler;
+
+    explicit Task(Handle handle);
+
+    Handle _handle;
+};
+
+// Resumes tasks at the frame boundary on the main thread. Suspending only moves the coroutine handle between
+// preallocated lists, so awaiting allocates nothing besides the job of background().
+class TaskScheduler final
+{
+public:
+             TaskScheduler() = delete;
+    explicit TaskScheduler(JobSystem& jobs);
+            ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&)                    = delete;
+    auto operator=(const TaskScheduler&) -> TaskScheduler& = delete;
+
+    // Starts the task at the next update(). Once token is cancelled the task is destroyed the next time it would be
+    // resumed.
+    void spawn(Task task, CancellationToken token = {});
+    // Resumes all tasks that are ready, called once per frame by the main loop
+    void update();
+    // Destroys all tasks, the job system has to be stopped before
+    void destroyAll();
+
+    // True if update() would resume a task
+    [[nodiscard]] auto hasReadyTasks() const -> bool;
+    [[nodiscard]] auto getTaskCount() const -> int;
+
+    [[nodiscard]] auto getJobSystem() -> JobSystem&;
+
+    // Queues a suspended task for the next update(), callable from any thread
+    void schedule(Task::Handle handle);
+private:
+    void destroy(Task::Handle handle);
+private:
+    JobSystem& _jobs;
+
+    mutable std::mutex        _readyMutex;
+    std::vector<Task::Handle> _ready;
+    std::vector<Task::Handle> _resuming; // Swapped with _ready so both keep their capacity
+
+    std::vector<Task::Handle> _tasks; // Every spawned task that is not destroyed yet
+};
+
+inline auto Task::promise_type::final_suspend() noexcept
+{
+    struct FinalAwaiter
+    {
+        [[nodiscard]] auto await_ready() const noexcept -> bool
+        {
+            return false;
+        }
+        void await_suspend(const Handle handle) const noexcept
+        {
+            handle.promise().scheduler->schedule(handle);
+        }
+        void await_resume() const noexcept {}
+    };
+    return FinalAwaiter{};
+}
+
+// Awaitables
+
+// Resumes the task at the next frame boundary on the main thread
+class NextFrameAwaiter final
+{
+public:
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+    void await_suspend(const Task::Handle handle) const
+    {
+        handle.promise().scheduler->schedule(handle);
+    }
+    void await_resume() const noexcept {}
+};
+
+// Runs function on a worker, then resumes the task with its result at the next frame boundary
+template <typename Function>
+class BackgroundAwaiter final
+{
+public:
+    using Result = std::invoke_result_t<Function>;
+public:
+    explicit BackgroundAwaiter(Function function)
+        : _function(std::move(function))
+        , _result()
+    {}
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+    void await_suspend(const Task::Handle handle)
+    {
+        // The awaiter lives in the suspended coroutine frame, so the worker can write the result into it
+        handle.promise().scheduler->getJobSystem().dispatch([this, handle] {
+            if constexpr (std::is_void_v<Result>)
+            {
+                _function();
+            } else
+            {
+                _result.emplace(_function());
+            }
+            handle.promise().scheduler->schedule(handle);
+        });
+    }
+    auto await_resume() -> Result
+    {
+        if constexpr (!std::is_void_v<Result>)
+        {
+            return std::move(*_result);
+        }
+    }
+private:
+    using Storage = std::conditional_t<std::is_void_v<Result>, std::monostate, std::optional<Result>>;
+
+    Function _function;
+    Storage  _result;
+};
+
+[[nodiscard]] inline auto nextFrame() -> NextFrameAwaiter
+{
+    return {};
+}
+
+template <typename Function>
+[[nodiscard]] auto background(Function function) -> BackgroundAwaiter<Function>
+{
+    return BackgroundAwaiter<Function>(std::move(function));
+}
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "theme_manager.h"
+
+#include <cassert>
+#include <thread>
+#include <raygui.h>
+#include <raylib.h>
+
+#include "diagnostics/profiler.h"
+
+ThemeManager::ThemeManager(TaskScheduler& tasks, FrameScheduler& frames)
+    : _tasks(tasks)
+    , _frames(frames)
+    , _currentTheme()
+    , _readyTheme()
+    , _pendingLoad()
+    , _loading(false)
+{}
+
+ThemeManager::~ThemeManager()
+{
+    unload();
+}
+
+void ThemeManager::load(std::unique_ptr<ITheme> theme)
+{
+    assert(theme);
+    if (_loading)
+    {
+        TraceLog(LOG_INFO, "Dropping unfinished theme");
+        _pendingLoad.cancel();
+        // Never drawn with, so it can go right away
+        _readyTheme.reset();
+    }
+
+    TraceLog(LOG_INFO, "Loading theme...");
+    _pendingLoad = CancellationToken();
+    _loading     = true;
+    _tasks.spawn(loadTheme(std::move(theme)), _pendingLoad);
+}
+
+void ThemeManager::update()
+{
+    if (!_readyTheme)
+    {
+        return;
+    }
+
+    // The old theme no longer touches raygui when destroyed, so applying first leaves no frame without a style
+    WS_PROFILE_SCOPE("ThemeManager::swap");
+    _readyTheme->apply();
+    _currentTheme = std::move(_readyTheme);
+    _loading      = false;
+
+    TraceLog(LOG_INFO, "Theme changed!");
+}
+
+void ThemeManager::finishLoading()
+{
+    while (_loading)
+    {
+        _tasks.update();
+        _frames.flush();
+        update();
+        std::this_thread::yield();
+    }
+}
+
+void ThemeManager::unload()
+{
+    // A pending theme is destroyed together with its task
+    _pendingLoad.cancel();
+    _readyTheme.reset();
+    _loading = false;
+
+    if (_currentTheme)
+    {
+        GuiSetFont(GetFontDefault());
+        _currentTheme.reset();
+    }
+}
+
+auto ThemeManager::isLoading() const -> bool
+{
+    return _loading;
+}
+
+auto ThemeManager::getTheme() const -> ITheme*
+{
+    return _currentTheme.get();
+}
+
+auto ThemeManager::loadTheme(std::unique_ptr<ITheme> theme) -> Task
+{
+    ITheme& pending = *theme;
+    if (!co_await background([&pending] {
+            WS_PROFILE_SCOPE("ITheme::decode");
+            return pending.decode();
+        }))
+    {
+        TraceLog(LOG_WARNING, "Failed to decode theme, keeping the current one");
+        _loading = false;
+        co_return;
+    }
+
+    // Uploads run in the spare time of each frame, at least one per frame so big assets still make progress
+    while (true)
+    {
+        co_await _frames.slice();
+        do
+        {
+            WS_PROFILE_SCOPE("ITheme::uploadNext");
+            if (!pending.uploadNext())
+            {
+                // Drawing of this frame might still use the current theme, so the swap waits for the next one
+                _readyTheme = std::move(theme);
+                co_return;
+            }
+        } while (_frames.hasTimeLeft());
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_APP_THEME_MANAGER_H
+#define WS_APP_THEME_MANAGER_H
+
+#include <memory>
+
+#include "app/frame_scheduler.h"
+#include "app/task.h"
+#include "components/theme.h"
+
+// Loads themes without stalling the main loop. A theme is decoded on a worker thread, uploaded in the spare time of
+// each frame and only replaces the current theme at the start of the frame after it is complete.
+class ThemeManager final
+{
+public:
+    ThemeManager() = delete;
+    ThemeManager(TaskScheduler& tasks, FrameScheduler& frames);
+    ~ThemeManager();
+
+    ThemeManager(const ThemeManager&)                    = delete;
+    auto operator=(const ThemeManager&) -> ThemeManager& = delete;
+
+    // Starts loading a theme, an unfinished previous request is dropped
+    void load(std::unique_ptr<ITheme> theme);
+    // Swaps in a completely uploaded theme, called at the start of each frame while nothing is drawn
+    void update();
+    // Blocks until the requested theme is current or has failed, used before the first frame
+    void finishLoading();
+    // Unloads the current theme and drops a pending one, has to happen before the window is closed
+    void unload();
+
+    [[nodiscard]] auto isLoading() const -> bool;
+    [[nodiscard]] auto getTheme() const -> ITheme*;
+private:
+    [[nodiscard]] auto loadTheme(std::unique_ptr<ITheme> theme) -> Task;
+private:
+    TaskScheduler&  _tasks;
+    FrameScheduler& _frames;
+
+    std::unique_ptr<ITheme> _currentTheme;
+    std::unique_ptr<ITheme> _readyTheme; // Uploaded, waiting for the next frame boundary
+    CancellationToken       _pendingLoad;
+    bool                    _loading;
+};
+
+#endif
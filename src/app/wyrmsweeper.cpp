@@ -24,53 +24,314 @@
 
 #include "wyrmsweeper.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <raylib.h>
+#include <thread>
 
+#include "diagnostics/logger.h"
+#include "diagnostics/profiler.h"
+#include "input/scripted_input.h"
 #include "screens/main_menu_screen.h"
 #include "themes/classic_theme.h"
+#include "themes/pack_theme.h"
 
 constexpr int DEFAULT_SCREEN_WIDHT  = 1280;
 constexpr int DEFAULT_SCREEN_HEIGHT = 720;
 
-void Wyrmsweeper::run()
+constexpr int    IDLE_FRAME_THRESHOLD = 2; // Frames without activity before the main loop stops redrawing
+constexpr double IDLE_POLL_INTERVAL   = 1.0 / 60.0;
+
+[[maybe_unused]] constexpr const char* TRACE_FILE = "wyrmsweeper_trace.json";
+
+void Wyrmsweeper::run(const LaunchOptions& options)
 {
 #ifndef WS_DEBUG_BUILD
     SetTraceLogLevel(LOG_NONE);
+    Logger::setLevel(LOG_NONE);
 #endif
+    Logger::start();
 
     TraceLog(LOG_INFO, "Starting Wyrmsweeper...");
+    startGame(options);
 
     /*    Init raylib    */
     SetConfigFlags(FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
 
     InitWindow(DEFAULT_SCREEN_WIDHT, DEFAULT_SCREEN_HEIGHT, "Wyrmsweeper");
     SetExitKey(KEY_NULL);
+    _startup.mark("Window");
 
-    /*    Init game    */
-    _currentTheme  = std::make_unique<ClassicTheme>();
-    _currentScreen = std::make_unique<MainMenuScreen>(this);
+    showTitleScreen();
 
     /*    Main loop    */
     while (!WindowShouldClose() && _running)
     {
-        _currentScreen->update();
+        if (_idleFrames >= IDLE_FRAME_THRESHOLD && !waitForActivity())
+        {
+            continue;
+        }
+        runFrame();
+    }
+
+    stopGame();
+
+    /*    Cleanup raylib    */
+    CloseWindow();
+    Logger::stop();
+}
 
-        BeginDrawing();
-        ClearBackground(BLACK);
+#ifdef WS_NULL_RENDER
+void Wyrmsweeper::startHeadless(const LaunchOptions& options, std::unique_ptr<IRenderBackend> renderer)
+{
+    assert(renderer);
+    _renderer = std::move(renderer);
+
+    startGame(options);
+    showTitleScreen();
+}
 
-        _currentScreen->render();
+void Wyrmsweeper::stopHeadless()
+{
+    stopGame();
+}
+#endif
 
-        EndDrawing();
+void Wyrmsweeper::runFrame()
+{
+    _clock.beginFrame();
+    _frames.beginFrame();
+    _frameArena.reset();
+    _frameStats.beginFrame();
+    // Nothing of the last frame is drawn anymore, so the old theme can be destroyed
+    _themes.update();
+    if (_nextInput)
+    {
+        _input = std::move(_nextInput);
+    }
+    _input->update();
 
-        if (_nextScreen)
+    if (_input->isKeyPressed(KEY_F3))
+    {
+        _frameStats.toggle();
+    }
+#ifdef WS_PROFILE
+    if (_input->isKeyPressed(KEY_F9))
+    {
+        WS_PROFILE_WRITE(TRACE_FILE);
+    }
+#endif
+
+#ifdef WS_DEBUG_BUILD
+    // Hot reload to test theme swapping
+    if (_input->isKeyPressed(KEY_F5))
+    {
+        setTheme(std::make_unique<ClassicTheme>(*_renderer));
+    }
+#endif
+    _frameStats.beginPhase(FramePhase::Update);
+    _jobs.runMainThreadJobs();
+    _tasks.update();
+
+    {
+        WS_PROFILE_SCOPE("Screen::update");
+        getCurrentScreen().update();
+    }
+    _frameStats.endPhase(FramePhase::Update);
+
+    _frameStats.beginPhase(FramePhase::Render);
+    _renderer->beginFrame(BLACK);
+
+    {
+        WS_PROFILE_SCOPE("Screen::render");
+        getCurrentScreen().render();
+    }
+    _frameStats.endPhase(FramePhase::Render);
+
+    // Counted before the overlay, so it does not include its own draws
+    _frameStats.setDrawCalls(_renderer->getDrawCount());
+    _frameStats.render(*_renderer);
+
+    // Incremental work fills the time until VSync
+    {
+        WS_PROFILE_SCOPE("FrameScheduler::run");
+        _frames.run(_renderer->getRefreshRate());
+    }
+
+    _frameStats.beginPhase(FramePhase::Present);
+    _renderer->endFrame();
+    _frameStats.endPhase(FramePhase::Present);
+    _frameStats.endFrame(_frames);
+
+    // Everything the title screen does not need waits until it is shown
+    if (!_startup.isFinished())
+    {
+        _startup.finish();
+        _fieldShader = std::make_unique<FieldShader>(*_renderer);
+        _flightRecorder.setOutput(_options.recordDirectory, _options.hitchThreshold);
+        _metrics.setOutput(_options.metricsTarget);
+    }
+    _flightRecorder.recordFrame(_frameStats.getLastFrame());
+    Metrics::add(Metric::FramesRendered);
+    _metrics.update();
+
+    const bool activity = hasActivity() || _transition != ScreenTransition::None || _tasks.hasReadyTasks() ||
+                          _frames.hasWork() || _jobs.hasMainThreadJobs() || _input->hasPendingInput();
+    _idleFrames         = activity ? 0 : _idleFrames + 1;
+
+    applyTransition();
+}
+
+void Wyrmsweeper::startGame(const LaunchOptions& options)
+{
+    WS_PROFILE_THREAD("Main thread");
+    _options = options;
+
+    _jobs.start(options.threadCount);
+    _startup.mark("Job system");
+
+    if (!options.inputScript.empty())
+    {
+        auto script = std::make_unique<ScriptedInput>();
+        if (script->loadScript(options.inputScript))
+        {
+            _input = std::move(script);
+        }
+    } else if (!options.inputRecording.empty())
+    {
+        auto live = std::make_unique<RaylibInput>();
+        if (live->startRecording(options.inputRecording))
         {
-            _currentScreen = std::move(_nextScreen);
+            _input = std::move(live);
         }
     }
 
-    /*    Cleanup raylib    */
-    CloseWindow();
+    // The theme decodes on a worker while the window is created, only its uploads need the GL context
+    if (!options.themePack.empty())
+    {
+        _themes.load(std::make_unique<PackTheme>(*_renderer, options.themePack));
+    } else
+    {
+        _themes.load(std::make_unique<ClassicTheme>(*_renderer));
+    }
+    _tasks.update();
+}
+
+void Wyrmsweeper::showTitleScreen()
+{
+    _themes.finishLoading();
+    if (_themes.getTheme() == nullptr)
+    {
+        _themes.load(std::make_unique<ClassicTheme>(*_renderer));
+        _themes.finishLoading();
+    }
+    _startup.mark("Theme");
+
+    _screens.push_back(std::make_unique<MainMenuScreen>(this));
+    _startup.mark("Title screen");
+}
+
+void Wyrmsweeper::stopGame()
+{
+    // Topmost screen first, like popping them one by one
+    while (!_screens.empty())
+    {
+        _screens.pop_back();
+    }
+    _nextScreen.reset();
+    _fieldShader.reset();
+    _themes.unload();
+    _boardPool.clear();
+    _jobs.stop();
+    _tasks.destroyAll();
+    WS_PROFILE_WRITE(TRACE_FILE);
+}
+
+auto Wyrmsweeper::hasActivity() -> bool
+{
+    bool activity = false;
+
+    if (const bool focused = _renderer->isWindowFocused(); focused != _windowFocused)
+    {
+        _windowFocused = focused;
+        activity       = true;
+    }
+
+    return activity || _input->hasInput() || _renderer->isWindowResized() ||
+           getCurrentScreen().getRedrawTimeout() == 0.0;
+}
+
+auto Wyrmsweeper::waitForActivity() -> bool
+{
+    const double timeout = getCurrentScreen().getRedrawTimeout();
+    if (timeout < 0.0 && !_jobs.isBusy() && !_metrics.isEnabled())
+    {
+        // Nothing changes on its own so sleep until the next event arrives
+        EnableEventWaiting();
+        PollInputEvents();
+        DisableEventWaiting();
+        return true;
+    }
+
+    // Only wake up for input, finished jobs or when the screen wants to be redrawn. Workers can not interrupt the
+    // event wait and it has no timeout, so it polls while jobs are running or metrics are exported. WaitTime() is not
+    // used since it busy waits.
+    const double sleepTime = timeout < 0.0 ? IDLE_POLL_INTERVAL : std::min(timeout, IDLE_POLL_INTERVAL);
+    std::this_thread::sleep_for(std::chrono::duration<double>(sleepTime));
+    PollInputEvents();
+    // Keeps the export cadence without drawing a frame
+    _metrics.update();
+
+    return (timeout >= 0.0 && timeout <= IDLE_POLL_INTERVAL) || hasActivity() || _tasks.hasReadyTasks() ||
+           _jobs.hasMainThreadJobs();
+}
+
+auto Wyrmsweeper::getCurrentScreen() const -> Screen&
+{
+    assert(!_screens.empty());
+    return *_screens.back();
+}
+
+void Wyrmsweeper::requestTransition(const ScreenTransition transition, std::unique_ptr<Screen> newScreen)
+{
+    assert(transition == ScreenTransition::Pop || newScreen);
+    _transition = transition;
+    _nextScreen = std::move(newScreen);
+}
+
+void Wyrmsweeper::applyTransition()
+{
+    switch (_transition)
+    {
+    case ScreenTransition::None:
+        return;
+    case ScreenTransition::Set:
+        while (!_screens.empty())
+        {
+            _screens.pop_back();
+        }
+        _screens.push_back(std::move(_nextScreen));
+        break;
+    case ScreenTransition::Push:
+        getCurrentScreen().pause();
+        _screens.push_back(std::move(_nextScreen));
+        break;
+    case ScreenTransition::Pop:
+        assert(_screens.size() > 1);
+        _screens.pop_back();
+        getCurrentScreen().resume();
+        break;
+    case ScreenTransition::Replace:
+        _screens.back() = std::move(_nextScreen);
+        break;
+    case ScreenTransition::PopReplace:
+        assert(_screens.size() > 1);
+        _screens.pop_back();
+        _screens.back() = std::move(_nextScreen);
+        break;
+    }
+    _transition = ScreenTransition::None;
 }
 
 void Wyrmsweeper::quit()
@@ -81,17 +342,114 @@ void Wyrmsweeper::quit()
 void Wyrmsweeper::setScreen(std::unique_ptr<Screen> newScreen)
 {
     TraceLog(LOG_INFO, "Changing screen...");
-    assert(newScreen);
-    _nextScreen = std::move(newScreen);
+    requestTransition(ScreenTransition::Set, std::move(newScreen));
+}
+
+void Wyrmsweeper::pushScreen(std::unique_ptr<Screen> newScreen)
+{
+    TraceLog(LOG_INFO, "Pushing screen...");
+    requestTransition(ScreenTransition::Push, std::move(newScreen));
+}
+
+void Wyrmsweeper::popScreen()
+{
+    TraceLog(LOG_INFO, "Popping screen...");
+    requestTransition(ScreenTransition::Pop, nullptr);
+}
+
+void Wyrmsweeper::replaceScreen(std::unique_ptr<Screen> newScreen)
+{
+    TraceLog(LOG_INFO, "Replacing screen...");
+    requestTransition(ScreenTransition::Replace, std::move(newScreen));
+}
+
+void Wyrmsweeper::popAndReplaceScreen(std::unique_ptr<Screen> newScreen)
+{
+    TraceLog(LOG_INFO, "Popping and replacing screen...");
+    requestTransition(ScreenTransition::PopReplace, std::move(newScreen));
+}
+
+void Wyrmsweeper::setTheme(std::unique_ptr<ITheme> newTheme)
+{
+    TraceLog(LOG_INFO, "Changing theme...");
+    _themes.load(std::move(newTheme));
+}
+
+void Wyrmsweeper::setInputProvider(std::unique_ptr<IInputProvider> input)
+{
+    // Screens might still hold on to the current one
+    assert(input);
+    _nextInput = std::move(input);
 }
 
 auto Wyrmsweeper::getTheme() const -> ITheme*
 {
-    assert(_currentTheme);
-    return _currentTheme.get();
+    assert(_themes.getTheme());
+    return _themes.getTheme();
+}
+
+auto Wyrmsweeper::getInput() const -> const IInputProvider&
+{
+    return *_input;
+}
+
+auto Wyrmsweeper::getRenderer() -> IRenderBackend&
+{
+    return *_renderer;
+}
+
+auto Wyrmsweeper::getClock() -> GameClock&
+{
+    return _clock;
+}
+
+auto Wyrmsweeper::getJobSystem() -> JobSystem&
+{
+    return _jobs;
+}
+
+auto Wyrmsweeper::getTaskScheduler() -> TaskScheduler&
+{
+    return _tasks;
+}
+
+auto Wyrmsweeper::getFrameScheduler() -> FrameScheduler&
+{
+    return _frames;
+}
+
+auto Wyrmsweeper::getFrameArena() -> FrameArena&
+{
+    return _frameArena;
+}
+
+auto Wyrmsweeper::getFieldShader() const -> const FieldShader&
+{
+    assert(_fieldShader);
+    return *_fieldShader;
+}
+
+auto Wyrmsweeper::getBoardPool() -> BoardPool&
+{
+    return _boardPool;
+}
+
+auto Wyrmsweeper::getFrameStats() -> FrameStats&
+{
+    return _frameStats;
+}
+
+auto Wyrmsweeper::getFlightRecorder() -> FlightRecorder&
+{
+    return _flightRecorder;
 }
 
 auto Wyrmsweeper::getAutoChordSetting() -> bool&
 {
     return _autoChord;
 }
+
+auto Wyrmsweeper::getShaderRenderingSetting() -> bool&
+{
+    return _shaderRendering;
+}
@@ -25,31 +25,134 @@
 #ifndef WS_APP_WYRMSWEEPER_H
 #define WS_APP_WYRMSWEEPER_H
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
+#include "app/board_pool.h"
+#include "app/frame_scheduler.h"
+#include "app/game_clock.h"
+#include "app/job_system.h"
+#include "app/launch_options.h"
+#include "app/task.h"
+#include "app/theme_manager.h"
 #include "components/screen.h"
+#include "components/field_shader.h"
+#include "components/frame_arena.h"
+#include "components/input_provider.h"
+#include "components/render_backend.h"
 #include "components/theme.h"
+#include "diagnostics/flight_recorder.h"
+#include "diagnostics/frame_stats.h"
+#include "diagnostics/metrics.h"
+#include "diagnostics/startup_timer.h"
+#include "input/raylib_input.h"
+#include "render/raylib_render_backend.h"
 
 class Wyrmsweeper final
 {
+    enum class ScreenTransition : uint8_t
+    {
+        None = 0,
+        Set,
+        Push,
+        Pop,
+        Replace,
+        PopReplace
+    };
 public:
     Wyrmsweeper() = default;
 
-    void run();
+    void run(const LaunchOptions& options);
     void quit();
 
+#ifdef WS_NULL_RENDER
+    // Sets the game up without a window, drawing with the given backend. The caller drives the frames with runFrame()
+    // until it calls stopHeadless(), used to benchmark the screens.
+    void startHeadless(const LaunchOptions& options, std::unique_ptr<IRenderBackend> renderer);
+    void stopHeadless();
+#endif
+    // Updates and renders the current screen once, run() calls it for every frame that is not skipped while idle
+    void runFrame();
+
+    // Screen changes are applied at the end of the frame, the last request of a frame wins
+    // Replaces the whole screen stack
     void setScreen(std::unique_ptr<Screen> newScreen);
+    // Covers the current screen, which is suspended until the new one is popped
+    void pushScreen(std::unique_ptr<Screen> newScreen);
+    // Destroys the current screen and resumes the one below
+    void popScreen();
+    // Replaces only the current screen, the screens below stay suspended
+    void replaceScreen(std::unique_ptr<Screen> newScreen);
+    // Destroys the current screen and replaces the one below, e.g. a new game picked from the pause menu
+    void popAndReplaceScreen(std::unique_ptr<Screen> newScreen);
+    // The current theme stays in use until the new one is loaded
+    void setTheme(std::unique_ptr<ITheme> newTheme);
+    // Takes effect at the next frame, screens read all their input from it
+    void setInputProvider(std::unique_ptr<IInputProvider> input);
 
     [[nodiscard]] auto getTheme() const -> ITheme*;
+    [[nodiscard]] auto getInput() const -> const IInputProvider&;
+    [[nodiscard]] auto getRenderer() -> IRenderBackend&;
+    [[nodiscard]] auto getClock() -> GameClock&;
+    [[nodiscard]] auto getJobSystem() -> JobSystem&;
+    [[nodiscard]] auto getTaskScheduler() -> TaskScheduler&;
+    [[nodiscard]] auto getFrameScheduler() -> FrameScheduler&;
+    [[nodiscard]] auto getFrameArena() -> FrameArena&;
+    // Compiled after the first frame, game screens only need it to render
+    [[nodiscard]] auto getFieldShader() const -> const FieldShader&;
+    [[nodiscard]] auto getBoardPool() -> BoardPool&;
+    [[nodiscard]] auto getFrameStats() -> FrameStats&;
+    [[nodiscard]] auto getFlightRecorder() -> FlightRecorder&;
     [[nodiscard]] auto getAutoChordSetting() -> bool&;
+    [[nodiscard]] auto getShaderRenderingSetting() -> bool&;
 private:
-    bool _running   = true;
-    bool _autoChord = false;
+    // Startup and shutdown around the window
+    void startGame(const LaunchOptions& options);
+    void showTitleScreen();
+    void stopGame();
+
+    // Idle handling
+    [[nodiscard]] auto hasActivity() -> bool;
+    [[nodiscard]] auto waitForActivity() -> bool;
+
+    // Screen stack
+    [[nodiscard]] auto getCurrentScreen() const -> Screen&;
+    void               requestTransition(ScreenTransition transition, std::unique_ptr<Screen> newScreen);
+    void               applyTransition();
+private:
+    StartupTimer _startup; // First, so it includes the construction of everything below
+
+    LaunchOptions _options;
+
+    bool _running         = true;
+    bool _autoChord       = false;
+    bool _shaderRendering = true;
+
+    int  _idleFrames    = 0;
+    bool _windowFocused = true;
+
+    // Before the screens and themes, which draw with it until they are destroyed
+    std::unique_ptr<IRenderBackend> _renderer = std::make_unique<RaylibRenderBackend>();
+    std::unique_ptr<FieldShader>    _fieldShader; // Shared by all game screens so new games skip the compile
+
+    std::vector<std::unique_ptr<Screen>> _screens; // The last screen is the current one
+    std::unique_ptr<Screen>              _nextScreen;
+    ScreenTransition                     _transition = ScreenTransition::None;
 
-    std::unique_ptr<Screen> _currentScreen;
-    std::unique_ptr<Screen> _nextScreen;
+    std::unique_ptr<IInputProvider> _input = std::make_unique<RaylibInput>();
+    std::unique_ptr<IInputProvider> _nextInput;
 
-    std::unique_ptr<ITheme> _currentTheme;
+    GameClock       _clock;
+    JobSystem       _jobs;
+    TaskScheduler   _tasks{_jobs};
+    FrameScheduler  _frames{_clock};
+    FrameArena      _frameArena;
+    ThemeManager    _themes{_tasks, _frames};
+    BoardPool       _boardPool{_jobs};
+    FrameStats      _frameStats;
+    FlightRecorder  _flightRecorder{_jobs, _clock};
+    MetricsExporter _metrics{_jobs, _clock};
 };
 
 #endif
\ No newline at end of file
@@ -1,6292 +0,0 @@
-/*
- * MIT License
- *
- * Copyright (c) 2024 Yan01h
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#ifndef WS_ASSETS_CLASSIC_THEME_FONT_H
-#define WS_ASSETS_CLASSIC_THEME_FONT_H
-
-namespace Assets::Classic {
-
-// NOLINTBEGIN
-constexpr unsigned char FONT_DATA[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x4f, 0x53, 0x2f, 0x32, 0x85, 0x48, 0x28,
-    0xa8, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x64, 0x53, 0x56, 0x47, 0x20, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01,
-    0xd0, 0x38, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x6d, 0x61, 0x70, 0xe8, 0xd8, 0xcd, 0xe0, 0x00, 0x00, 0x14, 0xa8, 0x00,
-    0x00, 0x32, 0x24, 0x67, 0x6c, 0x79, 0x66, 0x6a, 0xbc, 0xac, 0xae, 0x00, 0x00, 0x50, 0x58, 0x00, 0x01, 0x55, 0xc8,
-    0x68, 0x65, 0x61, 0x64, 0x23, 0x4f, 0xdf, 0x65, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65,
-    0x61, 0x08, 0x01, 0x08, 0xc2, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78, 0x00, 0x00,
-    0xa0, 0x80, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x00, 0x13, 0x0c, 0x6c, 0x6f, 0x63, 0x61, 0xae, 0x0a, 0x03, 0x44, 0x00,
-    0x00, 0x46, 0xcc, 0x00, 0x00, 0x09, 0x8c, 0x6d, 0x61, 0x78, 0x70, 0x04, 0xe6, 0x00, 0x81, 0x00, 0x00, 0x01, 0x18,
-    0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x1e, 0xa6, 0x4d, 0x07, 0x00, 0x01, 0xa6, 0x20, 0x00, 0x00, 0x01,
-    0xbc, 0x70, 0x6f, 0x73, 0x74, 0x23, 0x77, 0x54, 0x8f, 0x00, 0x01, 0xa7, 0xdc, 0x00, 0x00, 0x28, 0x5c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x5f, 0xac, 0x24, 0x69, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xdd, 0xed, 0xd7, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x44, 0x8f, 0x87, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0x00, 0x01, 0x00, 0x00, 0x04,
-    0xc5, 0x00, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05,
-    0x9a, 0x05, 0x33, 0x00, 0x00, 0x01, 0x33, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x66, 0x02, 0x12,
-    0x08, 0x0a, 0x02, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x0a, 0xbf, 0x02, 0x00, 0x10,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x4c, 0x20, 0x01, 0x40, 0x00, 0x20, 0xff, 0xff,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x80,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-    0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01,
-    0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00,
-    0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80,
-    0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x02, 0x80, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00,
-    0x01, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x31, 0x1e, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x2c, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x04, 0x0d, 0xc6, 0x00, 0x00, 0x01,
-    0xce, 0x01, 0x00, 0x00, 0x07, 0x00, 0xce, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x39, 0x00, 0x40, 0x00, 0x5a,
-    0x00, 0x60, 0x00, 0x7a, 0x00, 0x7e, 0x01, 0x81, 0x01, 0x86, 0x01, 0x8a, 0x01, 0x94, 0x01, 0x99, 0x01, 0x9e, 0x01,
-    0xa3, 0x01, 0xa9, 0x01, 0xb4, 0x01, 0xb9, 0x01, 0xc3, 0x01, 0xd4, 0x01, 0xdd, 0x01, 0xeb, 0x01, 0xf0, 0x01, 0xf5,
-    0x01, 0xf9, 0x02, 0x0d, 0x02, 0x1b, 0x02, 0x20, 0x02, 0x23, 0x02, 0x29, 0x02, 0x2f, 0x02, 0x33, 0x02, 0x45, 0x02,
-    0x54, 0x02, 0x59, 0x02, 0x5b, 0x02, 0x60, 0x02, 0x63, 0x02, 0x68, 0x02, 0x6a, 0x02, 0x72, 0x02, 0x78, 0x02, 0x83,
-    0x02, 0x89, 0x02, 0x8c, 0x02, 0x92, 0x02, 0x96, 0x02, 0xad, 0x02, 0xbd, 0x02, 0xc5, 0x02, 0xd1, 0x02, 0xdd, 0x02,
-    0xee, 0x02, 0xfd, 0x03, 0x08, 0x03, 0x0f, 0x03, 0x23, 0x03, 0x29, 0x03, 0x73, 0x03, 0x77, 0x03, 0x7f, 0x03, 0x8a,
-    0x03, 0x8c, 0x03, 0xa1, 0x04, 0x0f, 0x04, 0x4f, 0x04, 0x6d, 0x04, 0x75, 0x04, 0x82, 0x04, 0xa5, 0x04, 0xc2, 0x04,
-    0xcc, 0x04, 0xd9, 0x04, 0xdd, 0x04, 0xe9, 0x04, 0xf7, 0x05, 0x01, 0x05, 0x11, 0x05, 0x25, 0x05, 0x8f, 0x05, 0xc0,
-    0x05, 0xc3, 0x05, 0xc6, 0x05, 0xd9, 0x05, 0xea, 0x05, 0xf4, 0x0e, 0x3f, 0x17, 0xdb, 0x1e, 0x03, 0x1e, 0x0d, 0x1e,
-    0x11, 0x1e, 0x1f, 0x1e, 0x29, 0x1e, 0x31, 0x1e, 0x37, 0x1e, 0x3b, 0x1e, 0x41, 0x1e, 0x45, 0x1e, 0x49, 0x1e, 0x57,
-    0x1e, 0x5b, 0x1e, 0x63, 0x1e, 0x6d, 0x1e, 0x7d, 0x1e, 0x85, 0x1e, 0x93, 0x1e, 0x9e, 0x1e, 0xa1, 0x1e, 0xb9, 0x1e,
-    0xbd, 0x1e, 0xcd, 0x1e, 0xdd, 0x1e, 0xe1, 0x1e, 0xeb, 0x1e, 0xef, 0x1e, 0xfb, 0x1f, 0x00, 0x1f, 0x05, 0x1f, 0x08,
-    0x1f, 0x11, 0x1f, 0x15, 0x1f, 0x18, 0x1f, 0x24, 0x1f, 0x30, 0x1f, 0x35, 0x1f, 0x41, 0x1f, 0x44, 0x1f, 0x51, 0x1f,
-    0x70, 0x1f, 0x74, 0x1f, 0x76, 0x1f, 0x78, 0x1f, 0xc6, 0x1f, 0xd6, 0x1f, 0xe6, 0x1f, 0xf6, 0x20, 0x0f, 0x20, 0x27,
-    0x20, 0x30, 0x20, 0x33, 0x20, 0x3e, 0x20, 0x44, 0x20, 0x49, 0x20, 0x4b, 0x20, 0x4f, 0x20, 0x52, 0x20, 0xa0, 0x20,
-    0xa4, 0x20, 0xae, 0x20, 0xb1, 0x20, 0xb5, 0x20, 0xba, 0x20, 0xc0, 0x21, 0x03, 0x21, 0x05, 0x21, 0x09, 0x21, 0x13,
-    0x21, 0x17, 0x21, 0x20, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x39, 0x21, 0x4e, 0x21, 0x54, 0x21, 0x5e, 0x21,
-    0x84, 0x21, 0x95, 0x21, 0xa8, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x12, 0x22, 0x15, 0x22, 0x1a, 0x22, 0x20,
-    0x22, 0x29, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x61, 0x22, 0x65, 0x23, 0x02, 0x23, 0x10, 0x23, 0x18, 0x23, 0x27, 0x23,
-    0x2b, 0x23, 0xcf, 0x23, 0xea, 0x23, 0xef, 0x23, 0xf7, 0x23, 0xfc, 0x25, 0x81, 0x25, 0x84, 0x25, 0x88, 0x25, 0x8c,
-    0x25, 0x92, 0x25, 0xa1, 0x25, 0xc6, 0x25, 0xcf, 0x25, 0xe5, 0x25, 0xe6, 0x26, 0x01, 0x26, 0x04, 0x26, 0x09, 0x26,
-    0x13, 0x26, 0x15, 0x26, 0x21, 0x26, 0x2f, 0x26, 0x3c, 0x26, 0xd4, 0x26, 0xf6, 0x27, 0x08, 0x27, 0x13, 0x27, 0x4c,
-    0x27, 0xe9, 0x2c, 0x6d, 0x2c, 0x70, 0x2e, 0x2e, 0x30, 0x0b, 0x30, 0x12, 0x51, 0x43, 0x51, 0x86, 0xa6, 0x45, 0xa6,
-    0x55, 0xa6, 0x69, 0xa7, 0x8c, 0xfb, 0x02, 0xfb, 0x4f, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
-    0x00, 0x20, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x61, 0x00, 0x7b, 0x00, 0xa0, 0x01, 0x86, 0x01,
-    0x89, 0x01, 0x8e, 0x01, 0x97, 0x01, 0x9d, 0x01, 0xa0, 0x01, 0xa7, 0x01, 0xaf, 0x01, 0xb7, 0x01, 0xc0, 0x01, 0xc7,
-    0x01, 0xdd, 0x01, 0xe4, 0x01, 0xf0, 0x01, 0xf4, 0x01, 0xf8, 0x02, 0x0c, 0x02, 0x18, 0x02, 0x1e, 0x02, 0x22, 0x02,
-    0x26, 0x02, 0x2e, 0x02, 0x32, 0x02, 0x41, 0x02, 0x51, 0x02, 0x56, 0x02, 0x5b, 0x02, 0x60, 0x02, 0x63, 0x02, 0x68,
-    0x02, 0x6a, 0x02, 0x72, 0x02, 0x78, 0x02, 0x83, 0x02, 0x89, 0x02, 0x8b, 0x02, 0x92, 0x02, 0x94, 0x02, 0xac, 0x02,
-    0xb9, 0x02, 0xc2, 0x02, 0xc6, 0x02, 0xd8, 0x02, 0xed, 0x02, 0xfd, 0x03, 0x00, 0x03, 0x0a, 0x03, 0x23, 0x03, 0x27,
-    0x03, 0x70, 0x03, 0x74, 0x03, 0x7a, 0x03, 0x84, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0xa3, 0x04, 0x10, 0x04, 0x50, 0x04,
-    0x74, 0x04, 0x80, 0x04, 0x8c, 0x04, 0xa8, 0x04, 0xcb, 0x04, 0xcf, 0x04, 0xdc, 0x04, 0xe0, 0x04, 0xee, 0x05, 0x00,
-    0x05, 0x0e, 0x05, 0x24, 0x05, 0x8f, 0x05, 0xc0, 0x05, 0xc3, 0x05, 0xc6, 0x05, 0xd0, 0x05, 0xda, 0x05, 0xf0, 0x0e,
-    0x3f, 0x17, 0xdb, 0x1e, 0x02, 0x1e, 0x0a, 0x1e, 0x10, 0x1e, 0x1e, 0x1e, 0x24, 0x1e, 0x30, 0x1e, 0x36, 0x1e, 0x3a,
-    0x1e, 0x3e, 0x1e, 0x44, 0x1e, 0x48, 0x1e, 0x54, 0x1e, 0x5a, 0x1e, 0x60, 0x1e, 0x6a, 0x1e, 0x7c, 0x1e, 0x80, 0x1e,
-    0x90, 0x1e, 0x9b, 0x1e, 0xa0, 0x1e, 0xb8, 0x1e, 0xbc, 0x1e, 0xc8, 0x1e, 0xda, 0x1e, 0xe0, 0x1e, 0xe4, 0x1e, 0xee,
-    0x1e, 0xf2, 0x1f, 0x00, 0x1f, 0x04, 0x1f, 0x08, 0x1f, 0x10, 0x1f, 0x14, 0x1f, 0x18, 0x1f, 0x20, 0x1f, 0x30, 0x1f,
-    0x35, 0x1f, 0x40, 0x1f, 0x44, 0x1f, 0x50, 0x1f, 0x6f, 0x1f, 0x74, 0x1f, 0x76, 0x1f, 0x78, 0x1f, 0xc6, 0x1f, 0xd6,
-    0x1f, 0xe6, 0x1f, 0xf6, 0x20, 0x0b, 0x20, 0x10, 0x20, 0x30, 0x20, 0x32, 0x20, 0x39, 0x20, 0x43, 0x20, 0x47, 0x20,
-    0x4b, 0x20, 0x4f, 0x20, 0x52, 0x20, 0xa0, 0x20, 0xa2, 0x20, 0xa8, 0x20, 0xb1, 0x20, 0xb3, 0x20, 0xb8, 0x20, 0xbc,
-    0x21, 0x03, 0x21, 0x05, 0x21, 0x09, 0x21, 0x13, 0x21, 0x16, 0x21, 0x20, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21,
-    0x39, 0x21, 0x4d, 0x21, 0x53, 0x21, 0x5b, 0x21, 0x84, 0x21, 0x90, 0x21, 0xa8, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x11, 0x22, 0x15, 0x22, 0x19, 0x22, 0x1e, 0x22, 0x29, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x63, 0x23,
-    0x02, 0x23, 0x10, 0x23, 0x18, 0x23, 0x26, 0x23, 0x2b, 0x23, 0xcf, 0x23, 0xe9, 0x23, 0xef, 0x23, 0xf4, 0x23, 0xf8,
-    0x25, 0x80, 0x25, 0x84, 0x25, 0x88, 0x25, 0x8c, 0x25, 0x8f, 0x25, 0x94, 0x25, 0xc6, 0x25, 0xcf, 0x25, 0xe2, 0x25,
-    0xe6, 0x26, 0x01, 0x26, 0x04, 0x26, 0x09, 0x26, 0x10, 0x26, 0x15, 0x26, 0x21, 0x26, 0x2e, 0x26, 0x3a, 0x26, 0xd4,
-    0x26, 0xf6, 0x27, 0x08, 0x27, 0x13, 0x27, 0x4c, 0x27, 0xe8, 0x2c, 0x6d, 0x2c, 0x70, 0x2e, 0x2e, 0x30, 0x0a, 0x30,
-    0x12, 0x51, 0x43, 0x51, 0x86, 0xa6, 0x44, 0xa6, 0x54, 0xa6, 0x68, 0xa7, 0x8b, 0xfb, 0x01, 0xfb, 0x4f, 0xff, 0xfc,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0xff, 0xa1, 0x00,
-    0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x02, 0x73, 0xff, 0x2c, 0xff, 0x09, 0x02, 0x0b, 0xff,
-    0x57, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x01, 0x0a, 0xfe, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6e,
-    0xff, 0x99, 0xfe, 0x61, 0xff, 0x35, 0x01, 0xfc, 0xff, 0x83, 0x01, 0x15, 0x02, 0x15, 0xff, 0x16, 0x00, 0x00, 0xff,
-    0x48, 0xfe, 0xf6, 0x00, 0xf1, 0xfd, 0xe5, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x01, 0x74,
-    0x01, 0x73, 0x01, 0x63, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x00, 0x00, 0x00,
-    0x00, 0xfd, 0xfa, 0x00, 0x00, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0x00, 0xff, 0x3f,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x37, 0x00, 0x00, 0xff, 0x0b, 0xfe, 0x77, 0xfd, 0x59, 0xfd, 0x8d, 0xfd, 0x48, 0xfd,
-    0x28, 0x00, 0x00, 0xfd, 0x24, 0xf6, 0x52, 0xec, 0x2c, 0xe3, 0xfa, 0x00, 0x00, 0xe3, 0x5b, 0xe3, 0xe2, 0x00, 0x00,
-    0xe2, 0xf2, 0xe3, 0x95, 0xe3, 0x97, 0x00, 0x00, 0xe3, 0x89, 0xe3, 0x8b, 0x00, 0x00, 0xe3, 0x63, 0x00, 0x00, 0x00,
-    0x00, 0xe2, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x11, 0xe2, 0xfd, 0xe2, 0x98, 0x00, 0x00, 0xe4, 0x62,
-    0xe4, 0x60, 0x00, 0x00, 0xe4, 0x5a, 0x00, 0x00, 0xe4, 0x6c, 0x00, 0x00, 0xe4, 0x61, 0x00, 0x00, 0x00, 0x00, 0xe4,
-    0x69, 0x00, 0x00, 0xe4, 0x3e, 0xe4, 0x67, 0x00, 0x00, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x3d, 0xe3, 0xf5,
-    0xe3, 0x3c, 0xe2, 0xec, 0xe3, 0xb1, 0xe3, 0x84, 0xe2, 0xbd, 0xe4, 0xb5, 0x00, 0x00, 0xe1, 0xbe, 0xe2, 0xad, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xc6, 0xe4, 0x38, 0xe4, 0x39, 0xdf, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xa6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe8, 0xe2, 0x2a, 0xe2, 0xe3, 0xe1, 0xe4, 0x00, 0x00, 0xe2, 0xe1, 0xe0,
-    0xcb, 0xe1, 0x93, 0xdf, 0xa0, 0xe2, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x37, 0xe0, 0x4e, 0xe0, 0x3c,
-    0xe1, 0x2e, 0xe0, 0xe5, 0xde, 0xc1, 0x00, 0x00, 0xe0, 0xcd, 0x00, 0x00, 0x00, 0x00, 0xde, 0xa9, 0xe1, 0x03, 0xde,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x57, 0xdd, 0x67, 0xe1, 0xa1, 0xe1, 0x90, 0xe1, 0x8d, 0xdf, 0xfc, 0x00, 0x00,
-    0xdf, 0xd9, 0xdf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x18, 0xdc, 0x5d, 0xdf, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xde,
-    0x36, 0xdc, 0x19, 0xde, 0x05, 0xdc, 0x03, 0xdd, 0xce, 0xdd, 0xed, 0xdd, 0xc3, 0xdd, 0xfc, 0xdd, 0xd1, 0xdc, 0x94,
-    0x00, 0x00, 0xdb, 0xb0, 0xdc, 0xf9, 0xdd, 0x1a, 0xdc, 0xc6, 0xdc, 0xcf, 0xdc, 0x97, 0xda, 0xfe, 0xd8, 0x26, 0xd8,
-    0x25, 0xd6, 0x64, 0xd2, 0xde, 0xd4, 0x7e, 0xb2, 0xc2, 0xb2, 0x7e, 0x5e, 0x76, 0x5e, 0x68, 0x5e, 0x56, 0x5a, 0x4a,
-    0x08, 0x1f, 0x08, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xca, 0x00, 0x00, 0x01, 0xe8, 0x00,
-    0x00, 0x01, 0xf2, 0x00, 0x00, 0x01, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc2, 0x03, 0xce, 0x03, 0xd2,
-    0x03, 0xd4, 0x03, 0xda, 0x03, 0xde, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xea, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a,
-    0x04, 0x12, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x1a,
-    0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x00, 0x00, 0x04, 0x20, 0x04, 0x26, 0x04,
-    0x30, 0x00, 0x00, 0x04, 0x3a, 0x04, 0x60, 0x00, 0x00, 0x05, 0x36, 0x00, 0x00, 0x05, 0x6e, 0x05, 0x72, 0x05, 0xa4,
-    0x00, 0x00, 0x05, 0xd6, 0x00, 0x00, 0x05, 0xe8, 0x05, 0xfa, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x24, 0x00, 0x00, 0x06, 0x28, 0x06, 0x2e, 0x00, 0x00, 0x06, 0x32, 0x06, 0x3c, 0x06, 0x42, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x42, 0x00, 0x00, 0x00, 0x00, 0x06, 0x48, 0x00, 0x00, 0x06, 0x54, 0x00, 0x00, 0x06, 0x64, 0x00,
-    0x00, 0x06, 0x64, 0x06, 0x66, 0x00, 0x00, 0x06, 0x66, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6a, 0x00, 0x00, 0x06, 0x6a,
-    0x06, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x5e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0x06, 0x92, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x06, 0x94, 0x00, 0x00, 0x06, 0x9e, 0x06, 0xa2, 0x06, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9e, 0x06, 0xa0, 0x06, 0xa2,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9c, 0x00, 0x00, 0x06, 0x9c, 0x06,
-    0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9c, 0x06, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x96, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x06, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x98, 0x06, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00,
-    0x45, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x44, 0x00, 0x46, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x4a,
-    0x00, 0x42, 0x00, 0x4b, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x43, 0x00, 0x5a, 0x00, 0x4e, 0x00,
-    0x5b, 0x00, 0x48, 0x00, 0x5d, 0x00, 0x51, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x50, 0x00, 0xf6, 0x00, 0x53,
-    0x00, 0x55, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x01, 0x00, 0x5f, 0x00, 0x66, 0x00, 0x69, 0x00, 0xd3, 0x00, 0xb2, 0x00,
-    0xb3, 0x00, 0xb1, 0x00, 0x85, 0x00, 0x64, 0x02, 0xbc, 0x00, 0x61, 0x00, 0x76, 0x00, 0xb0, 0x00, 0xd4, 0x00, 0x78,
-    0x00, 0x63, 0x00, 0x74, 0x02, 0xbf, 0x02, 0xc0, 0x01, 0x07, 0x00, 0x75, 0x00, 0x65, 0x00, 0xca, 0x01, 0x58, 0x02,
-    0xbe, 0x02, 0xbd, 0x00, 0x62, 0x03, 0x23, 0x03, 0x22, 0x03, 0x24, 0x00, 0x60, 0x00, 0xf7, 0x01, 0x08, 0x01, 0x2d,
-    0x01, 0x48, 0x00, 0x86, 0x00, 0xc1, 0x00, 0x96, 0x01, 0x59, 0x00, 0xf9, 0x01, 0x0a, 0x01, 0x2f, 0x00, 0x88, 0x00,
-    0xfb, 0x01, 0x0c, 0x01, 0x31, 0x00, 0x8a, 0x01, 0x98, 0x01, 0x4a, 0x00, 0xfd, 0x01, 0x0e, 0x01, 0x33, 0x01, 0x4c,
-    0x00, 0x8c, 0x00, 0x67, 0x00, 0x9c, 0x00, 0xff, 0x01, 0x10, 0x01, 0x35, 0x00, 0x8e, 0x01, 0x12, 0x00, 0xb4, 0x00,
-    0x9b, 0x00, 0xf8, 0x01, 0x09, 0x01, 0x2e, 0x01, 0x49, 0x00, 0x87, 0x00, 0xc2, 0x00, 0x97, 0x01, 0x5a, 0x00, 0xfa,
-    0x01, 0x0b, 0x01, 0x30, 0x00, 0x89, 0x00, 0xfc, 0x01, 0x0d, 0x01, 0x32, 0x00, 0x8b, 0x01, 0x99, 0x01, 0x4b, 0x00,
-    0xfe, 0x01, 0x0f, 0x01, 0x34, 0x01, 0x4d, 0x00, 0x8d, 0x00, 0x68, 0x00, 0x9d, 0x01, 0x00, 0x01, 0x11, 0x01, 0x36,
-    0x00, 0x8f, 0x01, 0x13, 0x00, 0xb5, 0x00, 0x91, 0x00, 0x79, 0x00, 0x7a, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0x74, 0x01,
-    0x75, 0x01, 0x14, 0x01, 0x15, 0x01, 0x37, 0x01, 0x38, 0x01, 0xc7, 0x01, 0xc8, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8,
-    0x00, 0xd9, 0x01, 0x96, 0x01, 0x97, 0x00, 0x7b, 0x00, 0x7c, 0x01, 0xa3, 0x01, 0xa4, 0x00, 0xb8, 0x00, 0xb9, 0x01,
-    0x76, 0x01, 0x77, 0x00, 0xda, 0x00, 0xdb, 0x01, 0x39, 0x01, 0x3a, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xc9, 0x01, 0xca,
-    0x01, 0x5b, 0x01, 0x5c, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x92, 0x01, 0x93, 0x01, 0x4e, 0x01, 0x4f, 0x00, 0x7d, 0x00,
-    0x7e, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0x78, 0x01, 0x79, 0x01, 0x84, 0x01, 0x85, 0x03, 0x25, 0x03, 0x26, 0x01, 0x3d,
-    0x01, 0x3e, 0x01, 0x5d, 0x01, 0x5e, 0x00, 0xc7, 0x01, 0x16, 0x01, 0x17, 0x01, 0x5f, 0x01, 0x60, 0x00, 0xdc, 0x00,
-    0xdd, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0x82, 0x01, 0x83, 0x01, 0x18, 0x01, 0x19, 0x01, 0x61, 0x01, 0x62, 0x00, 0xde,
-    0x00, 0xdf, 0x01, 0xf3, 0x01, 0x90, 0x01, 0x91, 0x00, 0x7f, 0x00, 0x80, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0x7e, 0x01,
-    0x7f, 0x00, 0x98, 0x00, 0x99, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x63, 0x01, 0x64, 0x00, 0xe0, 0x00, 0xe1, 0x01, 0x1c,
-    0x01, 0x1d, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x65, 0x01, 0x66, 0x00, 0xe2, 0x00, 0xe3, 0x01, 0x67, 0x01, 0x68, 0x00,
-    0xe4, 0x00, 0xe5, 0x01, 0x94, 0x01, 0x95, 0x01, 0x50, 0x01, 0x51, 0x00, 0x81, 0x00, 0x82, 0x01, 0xab, 0x01, 0xac,
-    0x01, 0x86, 0x01, 0x87, 0x01, 0x80, 0x01, 0x81, 0x01, 0x7a, 0x01, 0x7b, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
-    0x44, 0x00, 0x90, 0x01, 0x1e, 0x01, 0x1f, 0x00, 0xba, 0x00, 0xbb, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xb6, 0x04, 0x0a,
-    0x01, 0xef, 0x01, 0x9a, 0x01, 0xf1, 0x01, 0x8f, 0x01, 0x88, 0x00, 0xc8, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xf8, 0x00,
-    0xc3, 0x01, 0x9c, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xf4, 0x04, 0xb0, 0x03, 0x3a, 0x03, 0x3b, 0x04, 0x72, 0x04, 0x73,
-    0x04, 0x61, 0x04, 0x62, 0x04, 0x97, 0x03, 0x42, 0x03, 0x43, 0x04, 0x5d, 0x01, 0xad, 0x01, 0xf6, 0x01, 0xf7, 0x01,
-    0xd9, 0x01, 0xdb, 0x01, 0xdc, 0x04, 0x5e, 0x04, 0x5f, 0x04, 0x60, 0x04, 0x5a, 0x04, 0x5b, 0x04, 0x5c, 0x00, 0xe8,
-    0x00, 0xe9, 0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x03, 0x5d, 0x03, 0x5e, 0x00,
-    0xf0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3, 0x01, 0x7c, 0x01, 0x7d, 0x00, 0xf4, 0x00, 0xf5, 0x04, 0xaf, 0x04, 0x15,
-    0x04, 0x16, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x8d, 0x01, 0x8e, 0x04, 0x09, 0x01, 0x9e, 0x04, 0xab, 0x04, 0x94, 0x04,
-    0x96, 0x01, 0xf0, 0x00, 0xc6, 0x01, 0x9b, 0x01, 0xf2, 0x04, 0x65, 0x01, 0x89, 0x01, 0xae, 0x04, 0xac, 0x01, 0x2c,
-    0x00, 0xd5, 0x04, 0x6f, 0x04, 0x67, 0x04, 0x68, 0x04, 0x69, 0x04, 0x70, 0x04, 0x6a, 0x04, 0x6b, 0x04, 0x6c, 0x03,
-    0x32, 0x03, 0x9f, 0x01, 0xa0, 0x00, 0xb7, 0x00, 0xc0, 0x01, 0x73, 0x01, 0x47, 0x03, 0x33, 0x04, 0x6e, 0x04, 0x6d,
-    0x04, 0x83, 0x04, 0x85, 0x04, 0x84, 0x03, 0x62, 0x03, 0x63, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0x64, 0x03, 0x7a, 0x03,
-    0x7b, 0x03, 0x7c, 0x03, 0x61, 0x03, 0xb7, 0x02, 0xdc, 0x02, 0xdd, 0x02, 0xa1, 0x02, 0xde, 0x02, 0xa3, 0x02, 0xa5,
-    0x02, 0xa7, 0x02, 0xab, 0x02, 0xad, 0x02, 0xaf, 0x02, 0x6c, 0x02, 0x6e, 0x02, 0x70, 0x02, 0x72, 0x02, 0x74, 0x02,
-    0x76, 0x02, 0x78, 0x02, 0x7a, 0x02, 0x7c, 0x02, 0x7e, 0x02, 0x80, 0x02, 0x82, 0x02, 0x84, 0x02, 0x86, 0x02, 0x88,
-    0x02, 0x8a, 0x02, 0x8c, 0x02, 0x8e, 0x02, 0x91, 0x02, 0x93, 0x02, 0x95, 0x02, 0x97, 0x02, 0x99, 0x02, 0x9b, 0x02,
-    0x9d, 0x02, 0x9f, 0x02, 0xa2, 0x02, 0xa4, 0x02, 0xa6, 0x02, 0xa8, 0x02, 0xb0, 0x02, 0x6d, 0x02, 0x6f, 0x02, 0x71,
-    0x02, 0x73, 0x02, 0x75, 0x02, 0x77, 0x02, 0x79, 0x02, 0x7b, 0x02, 0x7d, 0x02, 0x7f, 0x02, 0x81, 0x02, 0x83, 0x02,
-    0x85, 0x02, 0x87, 0x02, 0x89, 0x02, 0x8b, 0x02, 0x8d, 0x02, 0x90, 0x02, 0x8f, 0x02, 0x92, 0x02, 0x94, 0x02, 0x96,
-    0x02, 0x98, 0x02, 0x9a, 0x02, 0x9c, 0x02, 0x9e, 0x02, 0xa0, 0x02, 0xaa, 0x02, 0xac, 0x02, 0xae, 0x03, 0xbe, 0x03,
-    0xb2, 0x03, 0xb3, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0xa2, 0x03, 0x96, 0x03, 0x97,
-    0x03, 0x65, 0x03, 0x66, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0x8f, 0x03,
-    0x90, 0x03, 0x93, 0x03, 0x94, 0x03, 0x95, 0x03, 0xaa, 0x03, 0x98, 0x03, 0x99, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa8,
-    0x03, 0xa9, 0x03, 0xab, 0x03, 0xac, 0x03, 0x9a, 0x03, 0xad, 0x03, 0x79, 0x03, 0xa3, 0x03, 0xb6, 0x03, 0x91, 0x03,
-    0x92, 0x03, 0x88, 0x03, 0x89, 0x03, 0x78, 0x03, 0x8a, 0x03, 0x8b, 0x03, 0xae, 0x03, 0x7d, 0x03, 0x7e, 0x03, 0x7f,
-    0x02, 0x6a, 0x02, 0x4a, 0x02, 0x4c, 0x02, 0x66, 0x02, 0x60, 0x02, 0x64, 0x02, 0x58, 0x02, 0x62, 0x02, 0x4e, 0x02,
-    0x50, 0x02, 0x52, 0x02, 0x54, 0x02, 0x68, 0x02, 0x5c, 0x02, 0x5a, 0x02, 0x56, 0x02, 0x6b, 0x02, 0x4b, 0x02, 0x4d,
-    0x02, 0x67, 0x02, 0x61, 0x02, 0x65, 0x02, 0x59, 0x02, 0x63, 0x02, 0x4f, 0x02, 0x51, 0x02, 0x53, 0x02, 0x55, 0x02,
-    0x69, 0x02, 0x5d, 0x02, 0x5b, 0x02, 0x57, 0x04, 0x41, 0x04, 0x42, 0x04, 0x35, 0x04, 0x36, 0x04, 0x39, 0x04, 0x3a,
-    0x04, 0x3b, 0x04, 0x3c, 0x04, 0x3d, 0x04, 0x3e, 0x04, 0x46, 0x04, 0x47, 0x04, 0x48, 0x04, 0x49, 0x04, 0x02, 0x04,
-    0x03, 0x04, 0x43, 0x04, 0x3f, 0x04, 0x40, 0x04, 0x4a, 0x04, 0x4b, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0xce, 0x02, 0xcf,
-    0x03, 0xfd, 0x03, 0xfe, 0x02, 0xd8, 0x02, 0xd9, 0x03, 0x1c, 0x03, 0x1d, 0x02, 0xd2, 0x02, 0xd3, 0x03, 0xf4, 0x03,
-    0xf5, 0x03, 0xf8, 0x03, 0xf9, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xd4, 0x02, 0xd5, 0x03, 0xff, 0x04, 0x00, 0x04, 0x31,
-    0x04, 0x32, 0x03, 0x1a, 0x03, 0x1b, 0x04, 0x29, 0x04, 0x2a, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xd0, 0x02, 0xd1, 0x02,
-    0xd6, 0x02, 0xd7, 0x04, 0x33, 0x04, 0x34, 0x04, 0x27, 0x04, 0x28, 0x03, 0xf6, 0x03, 0xf7, 0x02, 0xcc, 0x02, 0xcd,
-    0x04, 0x4c, 0x04, 0x4d, 0x04, 0x50, 0x04, 0x51, 0x04, 0x25, 0x03, 0x5f, 0x03, 0x60, 0x04, 0x26, 0x02, 0xc5, 0x02,
-    0xc6, 0x04, 0x19, 0x04, 0x1a, 0x04, 0x54, 0x04, 0x55, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc1, 0x02, 0xc2, 0x04, 0x4e,
-    0x04, 0x4f, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x21, 0x04, 0x22, 0x04, 0x1d, 0x04, 0x1e, 0x02, 0xc8, 0x02, 0xc9, 0x04,
-    0x58, 0x04, 0x59, 0x04, 0x56, 0x04, 0x57, 0x03, 0x1e, 0x03, 0x1f, 0x04, 0x23, 0x04, 0x24, 0x04, 0x2d, 0x04, 0x2e,
-    0x04, 0x52, 0x04, 0x53, 0x04, 0xb1, 0x04, 0xb2, 0x03, 0x0f, 0x03, 0x02, 0x03, 0x03, 0x03, 0x10, 0x03, 0x04, 0x03,
-    0x11, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x12, 0x03, 0x08, 0x03, 0x13, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b,
-    0x03, 0x0c, 0x03, 0x0d, 0x01, 0xfe, 0x01, 0xff, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb7, 0x01, 0xb8, 0x00, 0x92, 0x00,
-    0x93, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x24, 0x01, 0x25, 0x02, 0x02, 0x02, 0x03, 0x01, 0x26, 0x01, 0x27, 0x02, 0x04,
-    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x01, 0xbf, 0x01, 0xc0, 0x02, 0x08, 0x02, 0x09, 0x01, 0xcf, 0x01, 0xd0, 0x01,
-    0x03, 0x01, 0x04, 0x01, 0x28, 0x01, 0x29, 0x00, 0x94, 0x00, 0x95, 0x01, 0x45, 0x01, 0x46, 0x01, 0xc5, 0x01, 0xc6,
-    0x03, 0x5a, 0x03, 0x5b, 0x03, 0x5c, 0x00, 0x9a, 0x03, 0x4e, 0x03, 0x4f, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01,
-    0xbc, 0x01, 0xc1, 0x01, 0xc2, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x03, 0x47, 0x01, 0x05,
-    0x01, 0x06, 0x01, 0xc3, 0x01, 0xc4, 0x03, 0x4c, 0x03, 0x4d, 0x01, 0x56, 0x01, 0x57, 0x04, 0xb3, 0x04, 0xb4, 0x03,
-    0x86, 0x03, 0x82, 0x03, 0x76, 0x03, 0x67, 0x03, 0x70, 0x03, 0x68, 0x03, 0x85, 0x03, 0x75, 0x03, 0x6d, 0x03, 0x83,
-    0x03, 0x80, 0x03, 0x72, 0x03, 0x6f, 0x03, 0x73, 0x03, 0x84, 0x03, 0x74, 0x03, 0x77, 0x03, 0xfa, 0x03, 0xfb, 0x00,
-    0xac, 0x00, 0xad, 0x00, 0xae, 0x00, 0xaf, 0x00, 0xcb, 0x02, 0xc7, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa6,
-    0x00, 0xa7, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xcd, 0x04, 0x08, 0x04, 0x8a, 0x04,
-    0x89, 0x00, 0xbc, 0x04, 0x88, 0x02, 0xe4, 0x02, 0xe5, 0x03, 0xee, 0x00, 0xbd, 0x03, 0xed, 0x02, 0xea, 0x04, 0x8c,
-    0x02, 0xe1, 0x04, 0x14, 0x04, 0x13, 0x04, 0x12, 0x00, 0xcc, 0x01, 0x2b, 0x02, 0xf1, 0x02, 0xee, 0x04, 0x8e, 0x00,
-    0x6e, 0x01, 0x2a, 0x00, 0x6d, 0x02, 0xf2, 0x04, 0x8f, 0x03, 0x55, 0x04, 0x8d, 0x00, 0x6c, 0x00, 0x6b, 0x03, 0x56,
-    0x02, 0xe3, 0x02, 0xef, 0x00, 0x6a, 0x02, 0xf0, 0x01, 0xdd, 0x03, 0x54, 0x02, 0xb8, 0x03, 0x31, 0x03, 0x2d, 0x02,
-    0xba, 0x03, 0x27, 0x03, 0x29, 0x03, 0x28, 0x03, 0x2a, 0x03, 0x2b, 0x03, 0x2c, 0x00, 0xcf, 0x00, 0xab, 0x00, 0xd1,
-    0x02, 0xb6, 0x02, 0xb7, 0x02, 0xec, 0x02, 0xed, 0x03, 0x58, 0x00, 0x71, 0x04, 0xb5, 0x00, 0x72, 0x00, 0x73, 0x03,
-    0xca, 0x03, 0xc9, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc3, 0x03, 0xbf, 0x03, 0xc0, 0x04, 0x9b, 0x04, 0xa9, 0x04, 0xa7,
-    0x04, 0x9a, 0x03, 0x51, 0x03, 0x52, 0x04, 0xaa, 0x04, 0xa8, 0x04, 0x9f, 0x04, 0xa0, 0x04, 0xa1, 0x04, 0xa6, 0x04,
-    0x9d, 0x04, 0xa4, 0x04, 0xa3, 0x04, 0xa2, 0x04, 0x9e, 0x04, 0xa5, 0x01, 0xe6, 0x01, 0xe7, 0x03, 0x53, 0x04, 0x0b,
-    0x03, 0xf3, 0x03, 0xf2, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
-    0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22,
-    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
-    0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x46, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x2a, 0x00,
-    0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4a,
-    0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
-    0x2d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3a,
-    0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-    0x43, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00,
-    0x00, 0x3d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00,
-    0x00, 0x4f, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x5e, 0x00,
-    0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x7a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x7d, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00,
-    0x00, 0xa3, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xd3, 0x00,
-    0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa7,
-    0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
-    0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00,
-    0x02, 0xbc, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xac, 0x00,
-    0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0,
-    0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
-    0xaf, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00,
-    0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb3, 0x00,
-    0x00, 0x02, 0xbf, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0xb5,
-    0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
-    0x65, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00,
-    0x00, 0xb8, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x02, 0xbe, 0x00,
-    0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x02, 0xbd, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbb,
-    0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x03, 0x23, 0x00, 0x00, 0x00,
-    0xbd, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x03, 0x22, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00,
-    0x03, 0x24, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc0, 0x00,
-    0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x01, 0x08,
-    0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x01, 0x2d, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
-    0xc3, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00,
-    0x00, 0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00,
-    0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x01, 0x59, 0x00, 0x00, 0x00, 0xc8,
-    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x01,
-    0x0a, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00,
-    0x00, 0xcb, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xfb, 0x00,
-    0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xce,
-    0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
-    0xd0, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00,
-    0x01, 0x4a, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xd3, 0x00,
-    0x00, 0x00, 0xd3, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x01, 0x33,
-    0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
-    0xd6, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00,
-    0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0xdb,
-    0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
-    0x8e, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00,
-    0x00, 0xde, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x9b, 0x00,
-    0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe1,
-    0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00,
-    0xe3, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x01, 0x49, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00,
-    0x00, 0x87, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xe6, 0x00,
-    0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x5a,
-    0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
-    0xe9, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00,
-    0x00, 0xeb, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec, 0x00,
-    0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0xee,
-    0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
-    0x8b, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00,
-    0x00, 0xf1, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xfe, 0x00,
-    0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf4,
-    0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x01, 0x4d, 0x00, 0x00, 0x00,
-    0xf6, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xf9, 0x00,
-    0x00, 0x00, 0xf9, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x01, 0x11,
-    0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-    0xfc, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00,
-    0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
-    0x00, 0x00, 0x91, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01,
-    0x74, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00,
-    0x01, 0x09, 0x00, 0x00, 0x01, 0x37, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x01, 0xc7, 0x00,
-    0x00, 0x01, 0x0c, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x11,
-    0x00, 0x00, 0x01, 0x96, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x01,
-    0x14, 0x00, 0x00, 0x01, 0x15, 0x00, 0x00, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x01, 0x17, 0x00, 0x00,
-    0x00, 0xb8, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x76, 0x00, 0x00, 0x01, 0x1a, 0x00,
-    0x00, 0x01, 0x1b, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x01, 0x39,
-    0x00, 0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01,
-    0x21, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x01, 0x23, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x00,
-    0x01, 0x24, 0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x27, 0x00,
-    0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x01, 0x4e, 0x00, 0x00, 0x01, 0x2a,
-    0x00, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2d, 0x00, 0x00, 0x01,
-    0xa7, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00,
-    0x01, 0x31, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x03, 0x25, 0x00,
-    0x00, 0x01, 0x34, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x01, 0x3d, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x37,
-    0x00, 0x00, 0x01, 0x5d, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x01,
-    0x39, 0x00, 0x00, 0x01, 0x3a, 0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x01, 0x3c, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x00, 0x01, 0x3d, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x01, 0x3f, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xd7, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x01, 0x82,
-    0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x45, 0x00, 0x00, 0x01,
-    0x46, 0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x01, 0x47, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00,
-    0x01, 0x49, 0x00, 0x00, 0x01, 0x49, 0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x4b, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x4d, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x01, 0x4e,
-    0x00, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x01, 0xa9, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x51, 0x00, 0x00, 0x01,
-    0x7e, 0x00, 0x00, 0x01, 0x52, 0x00, 0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x01, 0x56, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x63, 0x00,
-    0x00, 0x01, 0x58, 0x00, 0x00, 0x01, 0x59, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x00, 0x01, 0x5b,
-    0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x00, 0x01, 0x3f, 0x00, 0x00, 0x01,
-    0x5e, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01, 0x61, 0x00, 0x00,
-    0x00, 0xe2, 0x00, 0x00, 0x01, 0x62, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x01, 0x67, 0x00, 0x00, 0x01, 0x64, 0x00,
-    0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x01, 0x66, 0x00, 0x00, 0x01, 0x67, 0x00, 0x00, 0x01, 0x94,
-    0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x01,
-    0x6b, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x6c, 0x00, 0x00, 0x01, 0x6d, 0x00, 0x00, 0x01, 0xab, 0x00, 0x00,
-    0x01, 0x6e, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x01, 0x71, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x01, 0x7a, 0x00, 0x00, 0x01, 0x74,
-    0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x01, 0x79, 0x00, 0x00, 0x01, 0x7a, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x7b, 0x00, 0x00,
-    0x01, 0x7c, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x01, 0x7d, 0x00, 0x00, 0x01, 0x7e, 0x00, 0x00, 0x00, 0xe6, 0x00,
-    0x00, 0x01, 0x7f, 0x00, 0x00, 0x01, 0x7f, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0xef, 0x00, 0x00, 0x01,
-    0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00,
-    0x01, 0x9a, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x01, 0x8e, 0x00,
-    0x00, 0x01, 0x8e, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x01, 0x88,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00, 0x01,
-    0x92, 0x00, 0x00, 0x01, 0xaf, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00,
-    0x01, 0x94, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x01, 0x97, 0x00, 0x00, 0x01, 0x97, 0x00,
-    0x00, 0x01, 0x9c, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x01, 0xfa, 0x00, 0x00, 0x01, 0x9d,
-    0x00, 0x00, 0x01, 0x9d, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x00, 0x04,
-    0xb0, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x00, 0x03, 0x3a, 0x00, 0x00, 0x01, 0xa2, 0x00, 0x00,
-    0x01, 0xa3, 0x00, 0x00, 0x04, 0x72, 0x00, 0x00, 0x01, 0xa7, 0x00, 0x00, 0x01, 0xa8, 0x00, 0x00, 0x04, 0x61, 0x00,
-    0x00, 0x01, 0xa9, 0x00, 0x00, 0x01, 0xa9, 0x00, 0x00, 0x04, 0x97, 0x00, 0x00, 0x01, 0xaf, 0x00, 0x00, 0x01, 0xb0,
-    0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x01, 0xb1, 0x00, 0x00, 0x01, 0xb1, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x00, 0x01,
-    0xb2, 0x00, 0x00, 0x01, 0xb2, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x00,
-    0x01, 0xf6, 0x00, 0x00, 0x01, 0xb7, 0x00, 0x00, 0x01, 0xb7, 0x00, 0x00, 0x01, 0xd9, 0x00, 0x00, 0x01, 0xb8, 0x00,
-    0x00, 0x01, 0xb9, 0x00, 0x00, 0x01, 0xdb, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x02, 0xf3,
-    0x00, 0x00, 0x01, 0xc7, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x00, 0x04, 0x5e, 0x00, 0x00, 0x01, 0xca, 0x00, 0x00, 0x01,
-    0xcc, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x00, 0x01, 0xcd, 0x00, 0x00, 0x01, 0xd4, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00,
-    0x01, 0xdd, 0x00, 0x00, 0x01, 0xdd, 0x00, 0x00, 0x04, 0x64, 0x00, 0x00, 0x01, 0xe4, 0x00, 0x00, 0x01, 0xe5, 0x00,
-    0x00, 0x03, 0x5d, 0x00, 0x00, 0x01, 0xe6, 0x00, 0x00, 0x01, 0xe9, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0xea,
-    0x00, 0x00, 0x01, 0xeb, 0x00, 0x00, 0x01, 0x7c, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x04,
-    0x63, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00,
-    0x01, 0xf9, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x04, 0x17, 0x00,
-    0x00, 0x02, 0x18, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x00, 0x02, 0x1e, 0x00, 0x00, 0x02, 0x1f,
-    0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x04, 0xaf, 0x00, 0x00, 0x02,
-    0x22, 0x00, 0x00, 0x02, 0x23, 0x00, 0x00, 0x04, 0xad, 0x00, 0x00, 0x02, 0x26, 0x00, 0x00, 0x02, 0x27, 0x00, 0x00,
-    0x04, 0x15, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x02, 0x29, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x02, 0x2e, 0x00,
-    0x00, 0x02, 0x2f, 0x00, 0x00, 0x03, 0x38, 0x00, 0x00, 0x02, 0x32, 0x00, 0x00, 0x02, 0x33, 0x00, 0x00, 0x00, 0x83,
-    0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x02,
-    0x43, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x00,
-    0x02, 0x45, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x04, 0xab, 0x00, 0x00, 0x02, 0x51, 0x00, 0x00, 0x02, 0x51, 0x00,
-    0x00, 0x04, 0x94, 0x00, 0x00, 0x02, 0x52, 0x00, 0x00, 0x02, 0x52, 0x00, 0x00, 0x04, 0x96, 0x00, 0x00, 0x02, 0x53,
-    0x00, 0x00, 0x02, 0x53, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x00,
-    0xc6, 0x00, 0x00, 0x02, 0x56, 0x00, 0x00, 0x02, 0x56, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x00, 0x02, 0x57, 0x00, 0x00,
-    0x02, 0x57, 0x00, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x04, 0x65, 0x00,
-    0x00, 0x02, 0x59, 0x00, 0x00, 0x02, 0x59, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x00, 0x02, 0x5b,
-    0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x01, 0xf9, 0x00, 0x00, 0x02,
-    0x63, 0x00, 0x00, 0x02, 0x63, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00,
-    0x01, 0x9d, 0x00, 0x00, 0x02, 0x6a, 0x00, 0x00, 0x02, 0x6a, 0x00, 0x00, 0x04, 0x66, 0x00, 0x00, 0x02, 0x72, 0x00,
-    0x00, 0x02, 0x72, 0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x02, 0x78, 0x00, 0x00, 0x02, 0x78, 0x00, 0x00, 0x03, 0x8d,
-    0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x04, 0x98, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02,
-    0x89, 0x00, 0x00, 0x01, 0x9f, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x01, 0xae, 0x00, 0x00,
-    0x02, 0x8c, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x04, 0xac, 0x00, 0x00, 0x02, 0x92, 0x00, 0x00, 0x02, 0x92, 0x00,
-    0x00, 0x01, 0xda, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x02, 0xac,
-    0x00, 0x00, 0x02, 0xad, 0x00, 0x00, 0x03, 0x9d, 0x00, 0x00, 0x02, 0xb9, 0x00, 0x00, 0x02, 0xbd, 0x00, 0x00, 0x00,
-    0x9e, 0x00, 0x00, 0x02, 0xc2, 0x00, 0x00, 0x02, 0xc5, 0x00, 0x00, 0x03, 0x34, 0x00, 0x00, 0x02, 0xc6, 0x00, 0x00,
-    0x02, 0xc6, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x02, 0xc7, 0x00, 0x00, 0x02, 0xc7, 0x00, 0x00, 0x00, 0xd5, 0x00,
-    0x00, 0x02, 0xc8, 0x00, 0x00, 0x02, 0xc8, 0x00, 0x00, 0x04, 0x6f, 0x00, 0x00, 0x02, 0xc9, 0x00, 0x00, 0x02, 0xcb,
-    0x00, 0x00, 0x04, 0x67, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x02,
-    0xcd, 0x00, 0x00, 0x02, 0xcf, 0x00, 0x00, 0x04, 0x6a, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00,
-    0x03, 0x32, 0x00, 0x00, 0x02, 0xd1, 0x00, 0x00, 0x02, 0xd1, 0x00, 0x00, 0x03, 0x9f, 0x00, 0x00, 0x02, 0xd8, 0x00,
-    0x00, 0x02, 0xd8, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x02, 0xd9, 0x00, 0x00, 0x02, 0xd9, 0x00, 0x00, 0x00, 0xb7,
-    0x00, 0x00, 0x02, 0xda, 0x00, 0x00, 0x02, 0xda, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x02,
-    0xdb, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x02, 0xdc, 0x00, 0x00, 0x02, 0xdc, 0x00, 0x00, 0x01, 0x47, 0x00, 0x00,
-    0x02, 0xdd, 0x00, 0x00, 0x02, 0xdd, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x02, 0xed, 0x00, 0x00, 0x02, 0xed, 0x00,
-    0x00, 0x04, 0x6e, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x04, 0x6d, 0x00, 0x00, 0x02, 0xfd,
-    0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x04,
-    0x74, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x04, 0x7d, 0x00, 0x00, 0x03, 0x23, 0x00, 0x00,
-    0x03, 0x23, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x04, 0x83, 0x00,
-    0x00, 0x03, 0x28, 0x00, 0x00, 0x03, 0x28, 0x00, 0x00, 0x04, 0x85, 0x00, 0x00, 0x03, 0x29, 0x00, 0x00, 0x03, 0x29,
-    0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x03, 0xb8, 0x00, 0x00, 0x03,
-    0x74, 0x00, 0x00, 0x03, 0x75, 0x00, 0x00, 0x03, 0x62, 0x00, 0x00, 0x03, 0x76, 0x00, 0x00, 0x03, 0x77, 0x00, 0x00,
-    0x03, 0xbc, 0x00, 0x00, 0x03, 0x7a, 0x00, 0x00, 0x03, 0x7a, 0x00, 0x00, 0x03, 0x64, 0x00, 0x00, 0x03, 0x7b, 0x00,
-    0x00, 0x03, 0x7d, 0x00, 0x00, 0x03, 0x7a, 0x00, 0x00, 0x03, 0x7e, 0x00, 0x00, 0x03, 0x7e, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x00, 0x03, 0x7f, 0x00, 0x00, 0x03, 0x7f, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x03,
-    0x85, 0x00, 0x00, 0x02, 0xdc, 0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x02, 0xa1, 0x00, 0x00,
-    0x03, 0x87, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x03, 0x88, 0x00, 0x00, 0x03, 0x88, 0x00,
-    0x00, 0x02, 0xa3, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x02, 0xa5, 0x00, 0x00, 0x03, 0x8a,
-    0x00, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x02, 0xa7, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x02,
-    0xa9, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x03, 0x8f, 0x00, 0x00,
-    0x03, 0x8f, 0x00, 0x00, 0x02, 0xad, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x02, 0xaf, 0x00,
-    0x00, 0x03, 0x91, 0x00, 0x00, 0x03, 0x91, 0x00, 0x00, 0x02, 0x6c, 0x00, 0x00, 0x03, 0x92, 0x00, 0x00, 0x03, 0x92,
-    0x00, 0x00, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x03,
-    0x94, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x02, 0x72, 0x00, 0x00, 0x03, 0x95, 0x00, 0x00, 0x03, 0x95, 0x00, 0x00,
-    0x02, 0x74, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x02, 0x76, 0x00, 0x00, 0x03, 0x97, 0x00,
-    0x00, 0x03, 0x97, 0x00, 0x00, 0x02, 0x78, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x02, 0x7a,
-    0x00, 0x00, 0x03, 0x99, 0x00, 0x00, 0x03, 0x99, 0x00, 0x00, 0x02, 0x7c, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x03,
-    0x9a, 0x00, 0x00, 0x02, 0x7e, 0x00, 0x00, 0x03, 0x9b, 0x00, 0x00, 0x03, 0x9b, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x03, 0x9c, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x03, 0x9d, 0x00, 0x00, 0x03, 0x9d, 0x00,
-    0x00, 0x02, 0x84, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x03, 0x9f,
-    0x00, 0x00, 0x03, 0x9f, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x02,
-    0x8a, 0x00, 0x00, 0x03, 0xa1, 0x00, 0x00, 0x03, 0xa1, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x03, 0xa3, 0x00, 0x00,
-    0x03, 0xa3, 0x00, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x02, 0x91, 0x00,
-    0x00, 0x03, 0xa5, 0x00, 0x00, 0x03, 0xa5, 0x00, 0x00, 0x02, 0x93, 0x00, 0x00, 0x03, 0xa6, 0x00, 0x00, 0x03, 0xa6,
-    0x00, 0x00, 0x02, 0x95, 0x00, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x02, 0x97, 0x00, 0x00, 0x03,
-    0xa8, 0x00, 0x00, 0x03, 0xa8, 0x00, 0x00, 0x02, 0x99, 0x00, 0x00, 0x03, 0xa9, 0x00, 0x00, 0x03, 0xa9, 0x00, 0x00,
-    0x02, 0x9b, 0x00, 0x00, 0x03, 0xaa, 0x00, 0x00, 0x03, 0xaa, 0x00, 0x00, 0x02, 0x9d, 0x00, 0x00, 0x03, 0xab, 0x00,
-    0x00, 0x03, 0xab, 0x00, 0x00, 0x02, 0x9f, 0x00, 0x00, 0x03, 0xac, 0x00, 0x00, 0x03, 0xac, 0x00, 0x00, 0x02, 0xa2,
-    0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x02, 0xa4, 0x00, 0x00, 0x03, 0xae, 0x00, 0x00, 0x03,
-    0xae, 0x00, 0x00, 0x02, 0xa6, 0x00, 0x00, 0x03, 0xaf, 0x00, 0x00, 0x03, 0xaf, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00,
-    0x03, 0xb0, 0x00, 0x00, 0x03, 0xb0, 0x00, 0x00, 0x02, 0xb0, 0x00, 0x00, 0x03, 0xb1, 0x00, 0x00, 0x03, 0xb1, 0x00,
-    0x00, 0x02, 0x6d, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x02, 0x6f, 0x00, 0x00, 0x03, 0xb3,
-    0x00, 0x00, 0x03, 0xb3, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x02,
-    0x73, 0x00, 0x00, 0x03, 0xb5, 0x00, 0x00, 0x03, 0xb5, 0x00, 0x00, 0x02, 0x75, 0x00, 0x00, 0x03, 0xb6, 0x00, 0x00,
-    0x03, 0xb6, 0x00, 0x00, 0x02, 0x77, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x02, 0x79, 0x00,
-    0x00, 0x03, 0xb8, 0x00, 0x00, 0x03, 0xb8, 0x00, 0x00, 0x02, 0x7b, 0x00, 0x00, 0x03, 0xb9, 0x00, 0x00, 0x03, 0xb9,
-    0x00, 0x00, 0x02, 0x7d, 0x00, 0x00, 0x03, 0xba, 0x00, 0x00, 0x03, 0xba, 0x00, 0x00, 0x02, 0x7f, 0x00, 0x00, 0x03,
-    0xbb, 0x00, 0x00, 0x03, 0xbb, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x03, 0xbc, 0x00, 0x00, 0x03, 0xbc, 0x00, 0x00,
-    0x02, 0x83, 0x00, 0x00, 0x03, 0xbd, 0x00, 0x00, 0x03, 0xbd, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x03, 0xbe, 0x00,
-    0x00, 0x03, 0xbe, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x03, 0xbf, 0x00, 0x00, 0x03, 0xbf, 0x00, 0x00, 0x02, 0x89,
-    0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x03,
-    0xc1, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x03, 0xc2, 0x00, 0x00, 0x03, 0xc2, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x03, 0xc3, 0x00, 0x00, 0x03, 0xc3, 0x00, 0x00, 0x02, 0x8f, 0x00, 0x00, 0x03, 0xc4, 0x00, 0x00, 0x03, 0xc4, 0x00,
-    0x00, 0x02, 0x92, 0x00, 0x00, 0x03, 0xc5, 0x00, 0x00, 0x03, 0xc5, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x03, 0xc6,
-    0x00, 0x00, 0x03, 0xc6, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x03, 0xc7, 0x00, 0x00, 0x03, 0xc7, 0x00, 0x00, 0x02,
-    0x98, 0x00, 0x00, 0x03, 0xc8, 0x00, 0x00, 0x03, 0xc8, 0x00, 0x00, 0x02, 0x9a, 0x00, 0x00, 0x03, 0xc9, 0x00, 0x00,
-    0x03, 0xc9, 0x00, 0x00, 0x02, 0x9c, 0x00, 0x00, 0x03, 0xca, 0x00, 0x00, 0x03, 0xca, 0x00, 0x00, 0x02, 0x9e, 0x00,
-    0x00, 0x03, 0xcb, 0x00, 0x00, 0x03, 0xcb, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x03, 0xcc, 0x00, 0x00, 0x03, 0xcc,
-    0x00, 0x00, 0x02, 0xaa, 0x00, 0x00, 0x03, 0xcd, 0x00, 0x00, 0x03, 0xcd, 0x00, 0x00, 0x02, 0xac, 0x00, 0x00, 0x03,
-    0xce, 0x00, 0x00, 0x03, 0xce, 0x00, 0x00, 0x02, 0xae, 0x00, 0x00, 0x03, 0xcf, 0x00, 0x00, 0x03, 0xcf, 0x00, 0x00,
-    0x03, 0xbe, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x03, 0xd2, 0x00,
-    0x00, 0x03, 0xd4, 0x00, 0x00, 0x03, 0xaf, 0x00, 0x00, 0x03, 0xd5, 0x00, 0x00, 0x03, 0xd5, 0x00, 0x00, 0x03, 0x8c,
-    0x00, 0x00, 0x03, 0xd6, 0x00, 0x00, 0x03, 0xd6, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x03, 0xd7, 0x00, 0x00, 0x03,
-    0xd7, 0x00, 0x00, 0x03, 0xa2, 0x00, 0x00, 0x03, 0xd8, 0x00, 0x00, 0x03, 0xd9, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00,
-    0x03, 0xda, 0x00, 0x00, 0x03, 0xdb, 0x00, 0x00, 0x03, 0x65, 0x00, 0x00, 0x03, 0xdc, 0x00, 0x00, 0x03, 0xdd, 0x00,
-    0x00, 0x03, 0xa0, 0x00, 0x00, 0x03, 0xde, 0x00, 0x00, 0x03, 0xdf, 0x00, 0x00, 0x03, 0xa6, 0x00, 0x00, 0x03, 0xe0,
-    0x00, 0x00, 0x03, 0xe1, 0x00, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe3, 0x00, 0x00, 0x03,
-    0x8f, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x00, 0x03, 0xe6, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00,
-    0x03, 0xe7, 0x00, 0x00, 0x03, 0xaa, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xe9, 0x00, 0x00, 0x03, 0x98, 0x00,
-    0x00, 0x03, 0xea, 0x00, 0x00, 0x03, 0xeb, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x03, 0xed,
-    0x00, 0x00, 0x03, 0xa8, 0x00, 0x00, 0x03, 0xee, 0x00, 0x00, 0x03, 0xef, 0x00, 0x00, 0x03, 0xab, 0x00, 0x00, 0x03,
-    0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x03, 0xf1, 0x00, 0x00, 0x03, 0xf1, 0x00, 0x00,
-    0x03, 0xad, 0x00, 0x00, 0x03, 0xf2, 0x00, 0x00, 0x03, 0xf2, 0x00, 0x00, 0x03, 0x79, 0x00, 0x00, 0x03, 0xf3, 0x00,
-    0x00, 0x03, 0xf3, 0x00, 0x00, 0x03, 0xa3, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x03, 0xb6,
-    0x00, 0x00, 0x03, 0xf5, 0x00, 0x00, 0x03, 0xf6, 0x00, 0x00, 0x03, 0x91, 0x00, 0x00, 0x03, 0xf7, 0x00, 0x00, 0x03,
-    0xf8, 0x00, 0x00, 0x03, 0x88, 0x00, 0x00, 0x03, 0xf9, 0x00, 0x00, 0x03, 0xf9, 0x00, 0x00, 0x03, 0x78, 0x00, 0x00,
-    0x03, 0xfa, 0x00, 0x00, 0x03, 0xfb, 0x00, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x03, 0xfc, 0x00,
-    0x00, 0x03, 0xae, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03, 0x7d, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02,
-    0x4a, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00,
-    0x04, 0x03, 0x00, 0x00, 0x02, 0x66, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x60, 0x00,
-    0x00, 0x04, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x02, 0x64, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x04, 0x06,
-    0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x02, 0x62, 0x00, 0x00, 0x04,
-    0x08, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x4e, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00,
-    0x02, 0x50, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x02, 0x52, 0x00, 0x00, 0x04, 0x0b, 0x00,
-    0x00, 0x04, 0x0b, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x02, 0x68,
-    0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x04,
-    0x0e, 0x00, 0x00, 0x02, 0x5a, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x02, 0x56, 0x00, 0x00,
-    0x04, 0x10, 0x00, 0x00, 0x04, 0x4f, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x04, 0x50, 0x00,
-    0x00, 0x02, 0x6b, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x02, 0x4b, 0x00, 0x00, 0x04, 0x52,
-    0x00, 0x00, 0x04, 0x52, 0x00, 0x00, 0x02, 0x4d, 0x00, 0x00, 0x04, 0x53, 0x00, 0x00, 0x04, 0x53, 0x00, 0x00, 0x02,
-    0x67, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x02, 0x61, 0x00, 0x00, 0x04, 0x55, 0x00, 0x00,
-    0x04, 0x55, 0x00, 0x00, 0x02, 0x65, 0x00, 0x00, 0x04, 0x56, 0x00, 0x00, 0x04, 0x56, 0x00, 0x00, 0x02, 0x59, 0x00,
-    0x00, 0x04, 0x57, 0x00, 0x00, 0x04, 0x57, 0x00, 0x00, 0x02, 0x63, 0x00, 0x00, 0x04, 0x58, 0x00, 0x00, 0x04, 0x58,
-    0x00, 0x00, 0x02, 0x4f, 0x00, 0x00, 0x04, 0x59, 0x00, 0x00, 0x04, 0x59, 0x00, 0x00, 0x02, 0x51, 0x00, 0x00, 0x04,
-    0x5a, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x00, 0x02, 0x53, 0x00, 0x00, 0x04, 0x5b, 0x00, 0x00, 0x04, 0x5b, 0x00, 0x00,
-    0x02, 0x55, 0x00, 0x00, 0x04, 0x5c, 0x00, 0x00, 0x04, 0x5c, 0x00, 0x00, 0x02, 0x69, 0x00, 0x00, 0x04, 0x5d, 0x00,
-    0x00, 0x04, 0x5d, 0x00, 0x00, 0x02, 0x5d, 0x00, 0x00, 0x04, 0x5e, 0x00, 0x00, 0x04, 0x5e, 0x00, 0x00, 0x02, 0x5b,
-    0x00, 0x00, 0x04, 0x5f, 0x00, 0x00, 0x04, 0x5f, 0x00, 0x00, 0x02, 0x57, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x04,
-    0x61, 0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 0x04, 0x62, 0x00, 0x00, 0x04, 0x63, 0x00, 0x00, 0x04, 0x35, 0x00, 0x00,
-    0x04, 0x64, 0x00, 0x00, 0x04, 0x69, 0x00, 0x00, 0x04, 0x39, 0x00, 0x00, 0x04, 0x6a, 0x00, 0x00, 0x04, 0x6d, 0x00,
-    0x00, 0x04, 0x46, 0x00, 0x00, 0x04, 0x74, 0x00, 0x00, 0x04, 0x75, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x04, 0x80,
-    0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x04,
-    0x43, 0x00, 0x00, 0x04, 0x8c, 0x00, 0x00, 0x04, 0x8d, 0x00, 0x00, 0x04, 0x3f, 0x00, 0x00, 0x04, 0x8e, 0x00, 0x00,
-    0x04, 0x8f, 0x00, 0x00, 0x04, 0x4a, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x04, 0x91, 0x00, 0x00, 0x02, 0x5e, 0x00,
-    0x00, 0x04, 0x92, 0x00, 0x00, 0x04, 0x93, 0x00, 0x00, 0x02, 0xce, 0x00, 0x00, 0x04, 0x94, 0x00, 0x00, 0x04, 0x95,
-    0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x04, 0x96, 0x00, 0x00, 0x04, 0x97, 0x00, 0x00, 0x02, 0xd8, 0x00, 0x00, 0x04,
-    0x98, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x03, 0x1c, 0x00, 0x00, 0x04, 0x9a, 0x00, 0x00, 0x04, 0x9b, 0x00, 0x00,
-    0x02, 0xd2, 0x00, 0x00, 0x04, 0x9c, 0x00, 0x00, 0x04, 0x9d, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x04, 0x9e, 0x00,
-    0x00, 0x04, 0x9f, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00, 0x04, 0xa1, 0x00, 0x00, 0x02, 0xda,
-    0x00, 0x00, 0x04, 0xa2, 0x00, 0x00, 0x04, 0xa3, 0x00, 0x00, 0x02, 0xd4, 0x00, 0x00, 0x04, 0xa4, 0x00, 0x00, 0x04,
-    0xa5, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x04, 0xa8, 0x00, 0x00, 0x04, 0xa9, 0x00, 0x00, 0x04, 0x31, 0x00, 0x00,
-    0x04, 0xaa, 0x00, 0x00, 0x04, 0xab, 0x00, 0x00, 0x03, 0x1a, 0x00, 0x00, 0x04, 0xac, 0x00, 0x00, 0x04, 0xad, 0x00,
-    0x00, 0x04, 0x29, 0x00, 0x00, 0x04, 0xae, 0x00, 0x00, 0x04, 0xaf, 0x00, 0x00, 0x02, 0xca, 0x00, 0x00, 0x04, 0xb0,
-    0x00, 0x00, 0x04, 0xb1, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb3, 0x00, 0x00, 0x02,
-    0xd6, 0x00, 0x00, 0x04, 0xb4, 0x00, 0x00, 0x04, 0xb5, 0x00, 0x00, 0x04, 0x33, 0x00, 0x00, 0x04, 0xb6, 0x00, 0x00,
-    0x04, 0xb7, 0x00, 0x00, 0x04, 0x27, 0x00, 0x00, 0x04, 0xb8, 0x00, 0x00, 0x04, 0xb9, 0x00, 0x00, 0x03, 0xf6, 0x00,
-    0x00, 0x04, 0xba, 0x00, 0x00, 0x04, 0xbb, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x00, 0x04, 0xbc, 0x00, 0x00, 0x04, 0xbd,
-    0x00, 0x00, 0x04, 0x4c, 0x00, 0x00, 0x04, 0xbe, 0x00, 0x00, 0x04, 0xbf, 0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x04,
-    0xc0, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0xc1, 0x00, 0x00, 0x04, 0xc2, 0x00, 0x00,
-    0x03, 0x5f, 0x00, 0x00, 0x04, 0xcb, 0x00, 0x00, 0x04, 0xcc, 0x00, 0x00, 0x04, 0x2b, 0x00, 0x00, 0x04, 0xcf, 0x00,
-    0x00, 0x04, 0xcf, 0x00, 0x00, 0x04, 0x26, 0x00, 0x00, 0x04, 0xd0, 0x00, 0x00, 0x04, 0xd1, 0x00, 0x00, 0x02, 0xc5,
-    0x00, 0x00, 0x04, 0xd2, 0x00, 0x00, 0x04, 0xd3, 0x00, 0x00, 0x04, 0x19, 0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x04,
-    0xd5, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x04, 0xd6, 0x00, 0x00, 0x04, 0xd7, 0x00, 0x00, 0x02, 0xc3, 0x00, 0x00,
-    0x04, 0xd8, 0x00, 0x00, 0x04, 0xd9, 0x00, 0x00, 0x02, 0xc1, 0x00, 0x00, 0x04, 0xdc, 0x00, 0x00, 0x04, 0xdd, 0x00,
-    0x00, 0x04, 0x1b, 0x00, 0x00, 0x04, 0xe0, 0x00, 0x00, 0x04, 0xe1, 0x00, 0x00, 0x04, 0x4e, 0x00, 0x00, 0x04, 0xe2,
-    0x00, 0x00, 0x04, 0xe5, 0x00, 0x00, 0x04, 0x1f, 0x00, 0x00, 0x04, 0xe6, 0x00, 0x00, 0x04, 0xe7, 0x00, 0x00, 0x04,
-    0x1d, 0x00, 0x00, 0x04, 0xe8, 0x00, 0x00, 0x04, 0xe9, 0x00, 0x00, 0x02, 0xc8, 0x00, 0x00, 0x04, 0xee, 0x00, 0x00,
-    0x04, 0xef, 0x00, 0x00, 0x04, 0x58, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00, 0x04, 0x56, 0x00,
-    0x00, 0x04, 0xf2, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x03, 0x1e, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x04, 0xf5,
-    0x00, 0x00, 0x04, 0x23, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x04, 0x2d, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x04, 0x37, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00, 0x05, 0x0f, 0x00, 0x00,
-    0x04, 0x52, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x05, 0x11, 0x00, 0x00, 0x04, 0xb1, 0x00, 0x00, 0x05, 0x24, 0x00,
-    0x00, 0x05, 0x25, 0x00, 0x00, 0x04, 0x2f, 0x00, 0x00, 0x05, 0x8f, 0x00, 0x00, 0x05, 0x8f, 0x00, 0x00, 0x04, 0x06,
-    0x00, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x03, 0x19, 0x00, 0x00, 0x05, 0xc3, 0x00, 0x00, 0x05,
-    0xc3, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x05, 0xc6, 0x00, 0x00, 0x05, 0xc6, 0x00, 0x00, 0x03, 0x0e, 0x00, 0x00,
-    0x05, 0xd0, 0x00, 0x00, 0x05, 0xd9, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x05, 0xda, 0x00, 0x00, 0x05, 0xda, 0x00,
-    0x00, 0x03, 0x0f, 0x00, 0x00, 0x05, 0xdb, 0x00, 0x00, 0x05, 0xdc, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0xdd,
-    0x00, 0x00, 0x05, 0xdd, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x05, 0xde, 0x00, 0x00, 0x05, 0xde, 0x00, 0x00, 0x03,
-    0x04, 0x00, 0x00, 0x05, 0xdf, 0x00, 0x00, 0x05, 0xdf, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x05, 0xe0, 0x00, 0x00,
-    0x05, 0xe2, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x05, 0xe3, 0x00, 0x00, 0x05, 0xe3, 0x00, 0x00, 0x03, 0x12, 0x00,
-    0x00, 0x05, 0xe4, 0x00, 0x00, 0x05, 0xe4, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x05, 0xe5, 0x00, 0x00, 0x05, 0xe5,
-    0x00, 0x00, 0x03, 0x13, 0x00, 0x00, 0x05, 0xe6, 0x00, 0x00, 0x05, 0xea, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x05,
-    0xf0, 0x00, 0x00, 0x05, 0xf4, 0x00, 0x00, 0x03, 0x14, 0x00, 0x00, 0x0e, 0x3f, 0x00, 0x00, 0x0e, 0x3f, 0x00, 0x00,
-    0x04, 0x91, 0x00, 0x00, 0x17, 0xdb, 0x00, 0x00, 0x17, 0xdb, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x1e, 0x02, 0x00,
-    0x00, 0x1e, 0x03, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x1e, 0x0a, 0x00, 0x00, 0x1e, 0x0b, 0x00, 0x00, 0x01, 0xfe,
-    0x00, 0x00, 0x1e, 0x0c, 0x00, 0x00, 0x1e, 0x0d, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x00, 0x1e, 0x10, 0x00, 0x00, 0x1e,
-    0x11, 0x00, 0x00, 0x01, 0x6b, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x1e, 0x24, 0x00, 0x00, 0x1e, 0x25, 0x00, 0x00, 0x01, 0xb7, 0x00, 0x00, 0x1e, 0x26, 0x00, 0x00, 0x1e, 0x27, 0x00,
-    0x00, 0x00, 0x92, 0x00, 0x00, 0x1e, 0x28, 0x00, 0x00, 0x1e, 0x29, 0x00, 0x00, 0x01, 0x6d, 0x00, 0x00, 0x1e, 0x30,
-    0x00, 0x00, 0x1e, 0x31, 0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x1e, 0x36, 0x00, 0x00, 0x1e, 0x37, 0x00, 0x00, 0x01,
-    0xcb, 0x00, 0x00, 0x1e, 0x3a, 0x00, 0x00, 0x1e, 0x3b, 0x00, 0x00, 0x01, 0xd1, 0x00, 0x00, 0x1e, 0x3e, 0x00, 0x00,
-    0x1e, 0x3f, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x1e, 0x40, 0x00, 0x00, 0x1e, 0x41, 0x00, 0x00, 0x02, 0x02, 0x00,
-    0x00, 0x1e, 0x44, 0x00, 0x00, 0x1e, 0x45, 0x00, 0x00, 0x01, 0xcd, 0x00, 0x00, 0x1e, 0x48, 0x00, 0x00, 0x1e, 0x49,
-    0x00, 0x00, 0x01, 0xd3, 0x00, 0x00, 0x1e, 0x54, 0x00, 0x00, 0x1e, 0x55, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x1e,
-    0x56, 0x00, 0x00, 0x1e, 0x57, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x1e, 0x5a, 0x00, 0x00, 0x1e, 0x5b, 0x00, 0x00,
-    0x01, 0xbd, 0x00, 0x00, 0x1e, 0x60, 0x00, 0x00, 0x1e, 0x61, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x1e, 0x62, 0x00,
-    0x00, 0x1e, 0x63, 0x00, 0x00, 0x01, 0xbf, 0x00, 0x00, 0x1e, 0x6a, 0x00, 0x00, 0x1e, 0x6b, 0x00, 0x00, 0x02, 0x08,
-    0x00, 0x00, 0x1e, 0x6c, 0x00, 0x00, 0x1e, 0x6d, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x00, 0x1e, 0x7c, 0x00, 0x00, 0x1e,
-    0x7d, 0x00, 0x00, 0x01, 0x52, 0x00, 0x00, 0x1e, 0x80, 0x00, 0x00, 0x1e, 0x81, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
-    0x1e, 0x82, 0x00, 0x00, 0x1e, 0x83, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x1e, 0x84, 0x00, 0x00, 0x1e, 0x85, 0x00,
-    0x00, 0x00, 0x94, 0x00, 0x00, 0x1e, 0x90, 0x00, 0x00, 0x1e, 0x91, 0x00, 0x00, 0x01, 0x45, 0x00, 0x00, 0x1e, 0x92,
-    0x00, 0x00, 0x1e, 0x93, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x00, 0x1e, 0x9b, 0x00, 0x00, 0x1e, 0x9d, 0x00, 0x00, 0x03,
-    0x5a, 0x00, 0x00, 0x1e, 0x9e, 0x00, 0x00, 0x1e, 0x9e, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x1e, 0xa0, 0x00, 0x00,
-    0x1e, 0xa1, 0x00, 0x00, 0x01, 0xb1, 0x00, 0x00, 0x1e, 0xb8, 0x00, 0x00, 0x1e, 0xb9, 0x00, 0x00, 0x01, 0xb5, 0x00,
-    0x00, 0x1e, 0xbc, 0x00, 0x00, 0x1e, 0xbd, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x1e, 0xc8, 0x00, 0x00, 0x1e, 0xc9,
-    0x00, 0x00, 0x03, 0x4e, 0x00, 0x00, 0x1e, 0xca, 0x00, 0x00, 0x1e, 0xcd, 0x00, 0x00, 0x01, 0xb9, 0x00, 0x00, 0x1e,
-    0xda, 0x00, 0x00, 0x1e, 0xdd, 0x00, 0x00, 0x03, 0x3c, 0x00, 0x00, 0x1e, 0xe0, 0x00, 0x00, 0x1e, 0xe1, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x1e, 0xe4, 0x00, 0x00, 0x1e, 0xe5, 0x00, 0x00, 0x01, 0xc1, 0x00, 0x00, 0x1e, 0xe6, 0x00,
-    0x00, 0x1e, 0xe7, 0x00, 0x00, 0x03, 0x4a, 0x00, 0x00, 0x1e, 0xe8, 0x00, 0x00, 0x1e, 0xeb, 0x00, 0x00, 0x03, 0x44,
-    0x00, 0x00, 0x1e, 0xee, 0x00, 0x00, 0x1e, 0xef, 0x00, 0x00, 0x03, 0x48, 0x00, 0x00, 0x1e, 0xf2, 0x00, 0x00, 0x1e,
-    0xf3, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x1e, 0xf4, 0x00, 0x00, 0x1e, 0xf5, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00,
-    0x1e, 0xf6, 0x00, 0x00, 0x1e, 0xf7, 0x00, 0x00, 0x03, 0x4c, 0x00, 0x00, 0x1e, 0xf8, 0x00, 0x00, 0x1e, 0xf9, 0x00,
-    0x00, 0x01, 0x56, 0x00, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0x1e, 0xfb, 0x00, 0x00, 0x04, 0xb3, 0x00, 0x00, 0x1f, 0x00,
-    0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x6c, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00, 0x03,
-    0x86, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x1f, 0x08, 0x00, 0x00,
-    0x1f, 0x08, 0x00, 0x00, 0x03, 0x69, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x03, 0x76, 0x00,
-    0x00, 0x1f, 0x11, 0x00, 0x00, 0x1f, 0x11, 0x00, 0x00, 0x03, 0x67, 0x00, 0x00, 0x1f, 0x14, 0x00, 0x00, 0x1f, 0x14,
-    0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x1f, 0x15, 0x00, 0x00, 0x1f, 0x15, 0x00, 0x00, 0x03, 0x68, 0x00, 0x00, 0x1f,
-    0x18, 0x00, 0x00, 0x1f, 0x18, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x00,
-    0x03, 0x85, 0x00, 0x00, 0x1f, 0x21, 0x00, 0x00, 0x1f, 0x21, 0x00, 0x00, 0x03, 0x75, 0x00, 0x00, 0x1f, 0x22, 0x00,
-    0x00, 0x1f, 0x22, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x1f, 0x23, 0x00, 0x00, 0x1f, 0x23, 0x00, 0x00, 0x03, 0x83,
-    0x00, 0x00, 0x1f, 0x24, 0x00, 0x00, 0x1f, 0x24, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x1f,
-    0x30, 0x00, 0x00, 0x03, 0x6e, 0x00, 0x00, 0x1f, 0x35, 0x00, 0x00, 0x1f, 0x35, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00,
-    0x1f, 0x40, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x03, 0x72, 0x00, 0x00, 0x1f, 0x41, 0x00, 0x00, 0x1f, 0x41, 0x00,
-    0x00, 0x03, 0x6f, 0x00, 0x00, 0x1f, 0x44, 0x00, 0x00, 0x1f, 0x44, 0x00, 0x00, 0x03, 0x71, 0x00, 0x00, 0x1f, 0x50,
-    0x00, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x03, 0x73, 0x00, 0x00, 0x1f, 0x51, 0x00, 0x00, 0x1f, 0x51, 0x00, 0x00, 0x03,
-    0x84, 0x00, 0x00, 0x1f, 0x6f, 0x00, 0x00, 0x1f, 0x6f, 0x00, 0x00, 0x03, 0x74, 0x00, 0x00, 0x1f, 0x70, 0x00, 0x00,
-    0x1f, 0x70, 0x00, 0x00, 0x03, 0x77, 0x00, 0x00, 0x1f, 0x74, 0x00, 0x00, 0x1f, 0x74, 0x00, 0x00, 0x02, 0xb1, 0x00,
-    0x00, 0x1f, 0x76, 0x00, 0x00, 0x1f, 0x76, 0x00, 0x00, 0x03, 0x6b, 0x00, 0x00, 0x1f, 0x78, 0x00, 0x00, 0x1f, 0x78,
-    0x00, 0x00, 0x02, 0xb4, 0x00, 0x00, 0x1f, 0xc6, 0x00, 0x00, 0x1f, 0xc6, 0x00, 0x00, 0x02, 0xb2, 0x00, 0x00, 0x1f,
-    0xd6, 0x00, 0x00, 0x1f, 0xd6, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x1f, 0xe6, 0x00, 0x00, 0x1f, 0xe6, 0x00, 0x00,
-    0x03, 0x6a, 0x00, 0x00, 0x1f, 0xf6, 0x00, 0x00, 0x1f, 0xf6, 0x00, 0x00, 0x02, 0xb3, 0x00, 0x00, 0x20, 0x0b, 0x00,
-    0x00, 0x20, 0x0f, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x03, 0xfa,
-    0x00, 0x00, 0x20, 0x12, 0x00, 0x00, 0x20, 0x15, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x20, 0x16, 0x00, 0x00, 0x20,
-    0x16, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0x02, 0xc7, 0x00, 0x00,
-    0x20, 0x18, 0x00, 0x00, 0x20, 0x1f, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x21, 0x00,
-    0x00, 0x00, 0xbe, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x20, 0x23,
-    0x00, 0x00, 0x20, 0x23, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00, 0x04,
-    0x8a, 0x00, 0x00, 0x20, 0x25, 0x00, 0x00, 0x20, 0x25, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00,
-    0x20, 0x26, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x20, 0x27, 0x00, 0x00, 0x20, 0x27, 0x00, 0x00, 0x04, 0x88, 0x00,
-    0x00, 0x20, 0x30, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x01, 0xee, 0x00, 0x00, 0x20, 0x32, 0x00, 0x00, 0x20, 0x33,
-    0x00, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x20, 0x39, 0x00, 0x00, 0x20, 0x3a, 0x00, 0x00, 0x02, 0xe4, 0x00, 0x00, 0x20,
-    0x3b, 0x00, 0x00, 0x20, 0x3b, 0x00, 0x00, 0x03, 0xee, 0x00, 0x00, 0x20, 0x3c, 0x00, 0x00, 0x20, 0x3c, 0x00, 0x00,
-    0x00, 0xbd, 0x00, 0x00, 0x20, 0x3d, 0x00, 0x00, 0x20, 0x3d, 0x00, 0x00, 0x03, 0xed, 0x00, 0x00, 0x20, 0x3e, 0x00,
-    0x00, 0x20, 0x3e, 0x00, 0x00, 0x02, 0xea, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x04, 0x8c,
-    0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x02, 0xe1, 0x00, 0x00, 0x20, 0x47, 0x00, 0x00, 0x20,
-    0x47, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x04, 0x13, 0x00, 0x00,
-    0x20, 0x49, 0x00, 0x00, 0x20, 0x49, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x20, 0x4b, 0x00, 0x00, 0x20, 0x4b, 0x00,
-    0x00, 0x04, 0x11, 0x00, 0x00, 0x20, 0x4f, 0x00, 0x00, 0x20, 0x4f, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x20, 0x52,
-    0x00, 0x00, 0x20, 0x52, 0x00, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x20, 0xa0, 0x00, 0x00, 0x20, 0xa0, 0x00, 0x00, 0x00,
-    0x6f, 0x00, 0x00, 0x20, 0xa2, 0x00, 0x00, 0x20, 0xa2, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x20, 0xa3, 0x00, 0x00,
-    0x20, 0xa3, 0x00, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x20, 0xa4, 0x00, 0x00, 0x20, 0xa4, 0x00, 0x00, 0x02, 0xf1, 0x00,
-    0x00, 0x20, 0xa8, 0x00, 0x00, 0x20, 0xa8, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x20, 0xa9, 0x00, 0x00, 0x20, 0xa9,
-    0x00, 0x00, 0x04, 0x8e, 0x00, 0x00, 0x20, 0xaa, 0x00, 0x00, 0x20, 0xaa, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x20,
-    0xab, 0x00, 0x00, 0x20, 0xab, 0x00, 0x00, 0x01, 0x2a, 0x00, 0x00, 0x20, 0xac, 0x00, 0x00, 0x20, 0xac, 0x00, 0x00,
-    0x00, 0x6d, 0x00, 0x00, 0x20, 0xad, 0x00, 0x00, 0x20, 0xad, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x20, 0xae, 0x00,
-    0x00, 0x20, 0xae, 0x00, 0x00, 0x04, 0x8f, 0x00, 0x00, 0x20, 0xb1, 0x00, 0x00, 0x20, 0xb1, 0x00, 0x00, 0x03, 0x57,
-    0x00, 0x00, 0x20, 0xb3, 0x00, 0x00, 0x20, 0xb3, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x20, 0xb4, 0x00, 0x00, 0x20,
-    0xb4, 0x00, 0x00, 0x04, 0x8d, 0x00, 0x00, 0x20, 0xb5, 0x00, 0x00, 0x20, 0xb5, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00,
-    0x20, 0xb8, 0x00, 0x00, 0x20, 0xb8, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x20, 0xb9, 0x00, 0x00, 0x20, 0xb9, 0x00,
-    0x00, 0x03, 0x56, 0x00, 0x00, 0x20, 0xba, 0x00, 0x00, 0x20, 0xba, 0x00, 0x00, 0x02, 0xe3, 0x00, 0x00, 0x20, 0xbc,
-    0x00, 0x00, 0x20, 0xbc, 0x00, 0x00, 0x02, 0xef, 0x00, 0x00, 0x20, 0xbd, 0x00, 0x00, 0x20, 0xbd, 0x00, 0x00, 0x00,
-    0x6a, 0x00, 0x00, 0x20, 0xbe, 0x00, 0x00, 0x20, 0xbe, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x20, 0xbf, 0x00, 0x00,
-    0x20, 0xbf, 0x00, 0x00, 0x01, 0xdd, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x00, 0x03, 0x54, 0x00,
-    0x00, 0x21, 0x03, 0x00, 0x00, 0x21, 0x03, 0x00, 0x00, 0x03, 0xeb, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x21, 0x05,
-    0x00, 0x00, 0x03, 0x2f, 0x00, 0x00, 0x21, 0x09, 0x00, 0x00, 0x21, 0x09, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x21,
-    0x13, 0x00, 0x00, 0x21, 0x13, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00, 0x21, 0x16, 0x00, 0x00, 0x21, 0x16, 0x00, 0x00,
-    0x02, 0xb8, 0x00, 0x00, 0x21, 0x17, 0x00, 0x00, 0x21, 0x17, 0x00, 0x00, 0x03, 0x31, 0x00, 0x00, 0x21, 0x20, 0x00,
-    0x00, 0x21, 0x20, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x01, 0xed,
-    0x00, 0x00, 0x21, 0x26, 0x00, 0x00, 0x21, 0x26, 0x00, 0x00, 0x02, 0xb9, 0x00, 0x00, 0x21, 0x2e, 0x00, 0x00, 0x21,
-    0x2e, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x21, 0x39, 0x00, 0x00, 0x21, 0x39, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x00,
-    0x21, 0x4d, 0x00, 0x00, 0x21, 0x4d, 0x00, 0x00, 0x03, 0x2d, 0x00, 0x00, 0x21, 0x4e, 0x00, 0x00, 0x21, 0x4e, 0x00,
-    0x00, 0x02, 0xba, 0x00, 0x00, 0x21, 0x53, 0x00, 0x00, 0x21, 0x53, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x21, 0x54,
-    0x00, 0x00, 0x21, 0x54, 0x00, 0x00, 0x03, 0x29, 0x00, 0x00, 0x21, 0x5b, 0x00, 0x00, 0x21, 0x5b, 0x00, 0x00, 0x03,
-    0x28, 0x00, 0x00, 0x21, 0x5c, 0x00, 0x00, 0x21, 0x5e, 0x00, 0x00, 0x03, 0x2a, 0x00, 0x00, 0x21, 0x84, 0x00, 0x00,
-    0x21, 0x84, 0x00, 0x00, 0x02, 0xbb, 0x00, 0x00, 0x21, 0x90, 0x00, 0x00, 0x21, 0x95, 0x00, 0x00, 0x01, 0xde, 0x00,
-    0x00, 0x21, 0xa8, 0x00, 0x00, 0x21, 0xa8, 0x00, 0x00, 0x01, 0xe4, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x22, 0x02,
-    0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x02, 0xeb, 0x00, 0x00, 0x22,
-    0x0f, 0x00, 0x00, 0x22, 0x0f, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x22, 0x11, 0x00, 0x00, 0x22, 0x11, 0x00, 0x00,
-    0x00, 0xcf, 0x00, 0x00, 0x22, 0x12, 0x00, 0x00, 0x22, 0x12, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x22, 0x15, 0x00,
-    0x00, 0x22, 0x15, 0x00, 0x00, 0x02, 0xe2, 0x00, 0x00, 0x22, 0x19, 0x00, 0x00, 0x22, 0x19, 0x00, 0x00, 0x00, 0xd1,
-    0x00, 0x00, 0x22, 0x1a, 0x00, 0x00, 0x22, 0x1a, 0x00, 0x00, 0x02, 0xb6, 0x00, 0x00, 0x22, 0x1e, 0x00, 0x00, 0x22,
-    0x1e, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x22, 0x1f, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x02, 0xec, 0x00, 0x00,
-    0x22, 0x29, 0x00, 0x00, 0x22, 0x29, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x22, 0x2b, 0x00, 0x00, 0x22, 0x2b, 0x00,
-    0x00, 0x03, 0x2e, 0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x22, 0x60,
-    0x00, 0x00, 0x22, 0x60, 0x00, 0x00, 0x03, 0x58, 0x00, 0x00, 0x22, 0x61, 0x00, 0x00, 0x22, 0x61, 0x00, 0x00, 0x00,
-    0x71, 0x00, 0x00, 0x22, 0x63, 0x00, 0x00, 0x22, 0x63, 0x00, 0x00, 0x04, 0xb5, 0x00, 0x00, 0x22, 0x64, 0x00, 0x00,
-    0x22, 0x65, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x03, 0x59, 0x00,
-    0x00, 0x23, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x23, 0x18, 0x00, 0x00, 0x23, 0x18,
-    0x00, 0x00, 0x04, 0xb9, 0x00, 0x00, 0x23, 0x26, 0x00, 0x00, 0x23, 0x27, 0x00, 0x00, 0x04, 0xb6, 0x00, 0x00, 0x23,
-    0x2b, 0x00, 0x00, 0x23, 0x2b, 0x00, 0x00, 0x04, 0xb8, 0x00, 0x00, 0x23, 0xcf, 0x00, 0x00, 0x23, 0xcf, 0x00, 0x00,
-    0x03, 0xcb, 0x00, 0x00, 0x23, 0xe9, 0x00, 0x00, 0x23, 0xe9, 0x00, 0x00, 0x03, 0xca, 0x00, 0x00, 0x23, 0xea, 0x00,
-    0x00, 0x23, 0xea, 0x00, 0x00, 0x03, 0xc9, 0x00, 0x00, 0x23, 0xef, 0x00, 0x00, 0x23, 0xef, 0x00, 0x00, 0x03, 0xc8,
-    0x00, 0x00, 0x23, 0xf4, 0x00, 0x00, 0x23, 0xf7, 0x00, 0x00, 0x03, 0xc4, 0x00, 0x00, 0x23, 0xf8, 0x00, 0x00, 0x23,
-    0xfa, 0x00, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x23, 0xfb, 0x00, 0x00, 0x23, 0xfc, 0x00, 0x00, 0x03, 0xbf, 0x00, 0x00,
-    0x25, 0x80, 0x00, 0x00, 0x25, 0x80, 0x00, 0x00, 0x04, 0x9b, 0x00, 0x00, 0x25, 0x81, 0x00, 0x00, 0x25, 0x81, 0x00,
-    0x00, 0x04, 0xa9, 0x00, 0x00, 0x25, 0x84, 0x00, 0x00, 0x25, 0x84, 0x00, 0x00, 0x04, 0x9c, 0x00, 0x00, 0x25, 0x88,
-    0x00, 0x00, 0x25, 0x88, 0x00, 0x00, 0x01, 0xe5, 0x00, 0x00, 0x25, 0x8c, 0x00, 0x00, 0x25, 0x8c, 0x00, 0x00, 0x04,
-    0x99, 0x00, 0x00, 0x25, 0x8f, 0x00, 0x00, 0x25, 0x8f, 0x00, 0x00, 0x04, 0xa7, 0x00, 0x00, 0x25, 0x90, 0x00, 0x00,
-    0x25, 0x90, 0x00, 0x00, 0x04, 0x9a, 0x00, 0x00, 0x25, 0x91, 0x00, 0x00, 0x25, 0x92, 0x00, 0x00, 0x03, 0x51, 0x00,
-    0x00, 0x25, 0x94, 0x00, 0x00, 0x25, 0x94, 0x00, 0x00, 0x04, 0xaa, 0x00, 0x00, 0x25, 0x95, 0x00, 0x00, 0x25, 0x95,
-    0x00, 0x00, 0x04, 0xa8, 0x00, 0x00, 0x25, 0x96, 0x00, 0x00, 0x25, 0x98, 0x00, 0x00, 0x04, 0x9f, 0x00, 0x00, 0x25,
-    0x99, 0x00, 0x00, 0x25, 0x99, 0x00, 0x00, 0x04, 0xa6, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x00,
-    0x04, 0x9d, 0x00, 0x00, 0x25, 0x9b, 0x00, 0x00, 0x25, 0x9b, 0x00, 0x00, 0x04, 0xa4, 0x00, 0x00, 0x25, 0x9c, 0x00,
-    0x00, 0x25, 0x9c, 0x00, 0x00, 0x04, 0xa3, 0x00, 0x00, 0x25, 0x9d, 0x00, 0x00, 0x25, 0x9d, 0x00, 0x00, 0x04, 0xa2,
-    0x00, 0x00, 0x25, 0x9e, 0x00, 0x00, 0x25, 0x9e, 0x00, 0x00, 0x04, 0x9e, 0x00, 0x00, 0x25, 0x9f, 0x00, 0x00, 0x25,
-    0x9f, 0x00, 0x00, 0x04, 0xa5, 0x00, 0x00, 0x25, 0xa0, 0x00, 0x00, 0x25, 0xa1, 0x00, 0x00, 0x01, 0xe6, 0x00, 0x00,
-    0x25, 0xc6, 0x00, 0x00, 0x25, 0xc6, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x25, 0xcf, 0x00, 0x00, 0x25, 0xcf, 0x00,
-    0x00, 0x01, 0xe8, 0x00, 0x00, 0x25, 0xe2, 0x00, 0x00, 0x25, 0xe5, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x25, 0xe6,
-    0x00, 0x00, 0x25, 0xe6, 0x00, 0x00, 0x01, 0xe9, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x03,
-    0xcf, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x03, 0xf1, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00,
-    0x26, 0x09, 0x00, 0x00, 0x03, 0xcc, 0x00, 0x00, 0x26, 0x10, 0x00, 0x00, 0x26, 0x13, 0x00, 0x00, 0x04, 0x0c, 0x00,
-    0x00, 0x26, 0x15, 0x00, 0x00, 0x26, 0x15, 0x00, 0x00, 0x03, 0xe6, 0x00, 0x00, 0x26, 0x21, 0x00, 0x00, 0x26, 0x21,
-    0x00, 0x00, 0x02, 0xb5, 0x00, 0x00, 0x26, 0x2e, 0x00, 0x00, 0x26, 0x2e, 0x00, 0x00, 0x03, 0x53, 0x00, 0x00, 0x26,
-    0x2f, 0x00, 0x00, 0x26, 0x2f, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x26, 0x3a, 0x00, 0x00, 0x26, 0x3c, 0x00, 0x00,
-    0x01, 0xea, 0x00, 0x00, 0x26, 0xd4, 0x00, 0x00, 0x26, 0xd4, 0x00, 0x00, 0x03, 0xcd, 0x00, 0x00, 0x26, 0xf6, 0x00,
-    0x00, 0x26, 0xf6, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x27, 0x08, 0x00, 0x00, 0x27, 0x08, 0x00, 0x00, 0x03, 0xce,
-    0x00, 0x00, 0x27, 0x13, 0x00, 0x00, 0x27, 0x13, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x27, 0x4c, 0x00, 0x00, 0x27,
-    0x4c, 0x00, 0x00, 0x03, 0xe3, 0x00, 0x00, 0x27, 0xe8, 0x00, 0x00, 0x27, 0xe9, 0x00, 0x00, 0x02, 0xe6, 0x00, 0x00,
-    0x2c, 0x6d, 0x00, 0x00, 0x2c, 0x6d, 0x00, 0x00, 0x04, 0x93, 0x00, 0x00, 0x2c, 0x70, 0x00, 0x00, 0x2c, 0x70, 0x00,
-    0x00, 0x04, 0x95, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x00, 0x04, 0x92, 0x00, 0x00, 0x30, 0x0a,
-    0x00, 0x00, 0x30, 0x0b, 0x00, 0x00, 0x02, 0xe8, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x04,
-    0x90, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x51, 0x86, 0x00, 0x00,
-    0x51, 0x86, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0xa6, 0x44, 0x00, 0x00, 0xa6, 0x45, 0x00, 0x00, 0x04, 0xba, 0x00,
-    0x00, 0xa6, 0x54, 0x00, 0x00, 0xa6, 0x55, 0x00, 0x00, 0x04, 0xbc, 0x00, 0x00, 0xa6, 0x68, 0x00, 0x00, 0xa6, 0x69,
-    0x00, 0x00, 0x04, 0xbe, 0x00, 0x00, 0xa7, 0x8b, 0x00, 0x00, 0xa7, 0x8c, 0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0xfb,
-    0x01, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0xfb, 0x4f, 0x00, 0x00, 0xfb, 0x4f, 0x00, 0x00,
-    0x03, 0x9b, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xf3, 0x00, 0x00, 0xff, 0xfd, 0x00,
-    0x00, 0xff, 0xfd, 0x00, 0x00, 0x03, 0xf2, 0x00, 0x01, 0xf3, 0x0d, 0x00, 0x01, 0xf3, 0x0d, 0x00, 0x00, 0x03, 0xdf,
-    0x00, 0x01, 0xf3, 0x34, 0x00, 0x01, 0xf3, 0x34, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x01, 0xf3, 0xa7, 0x00, 0x01, 0xf3,
-    0xa7, 0x00, 0x00, 0x03, 0xef, 0x00, 0x01, 0xf3, 0xc6, 0x00, 0x01, 0xf3, 0xc6, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x01,
-    0xf4, 0x7d, 0x00, 0x01, 0xf4, 0x7d, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x01, 0xf4, 0xc1, 0x00, 0x01, 0xf4, 0xc2, 0x00,
-    0x00, 0x03, 0xdb, 0x00, 0x01, 0xf4, 0xc4, 0x00, 0x01, 0xf4, 0xc4, 0x00, 0x00, 0x03, 0xda, 0x00, 0x01, 0xf4, 0xde,
-    0x00, 0x01, 0xf4, 0xde, 0x00, 0x00, 0x03, 0xdd, 0x00, 0x01, 0xf4, 0xe4, 0x00, 0x01, 0xf4, 0xe5, 0x00, 0x00, 0x03,
-    0xd8, 0x00, 0x01, 0xf4, 0xe7, 0x00, 0x01, 0xf4, 0xe7, 0x00, 0x00, 0x03, 0xde, 0x00, 0x01, 0xf5, 0x17, 0x00, 0x01,
-    0xf5, 0x17, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x01, 0xf5, 0xa4, 0x00, 0x01, 0xf5, 0xa4, 0x00, 0x00, 0x03, 0xd2, 0x00,
-    0x01, 0xf5, 0xa8, 0x00, 0x01, 0xf5, 0xa8, 0x00, 0x00, 0x03, 0xe5, 0x00, 0x01, 0xf5, 0xe8, 0x00, 0x01, 0xf5, 0xe9,
-    0x00, 0x00, 0x03, 0xd6, 0x00, 0x01, 0xf6, 0xac, 0x00, 0x01, 0xf6, 0xac, 0x00, 0x00, 0x03, 0xd3, 0x00, 0x01, 0xf6,
-    0xb9, 0x00, 0x01, 0xf6, 0xba, 0x00, 0x00, 0x03, 0xd4, 0x00, 0x01, 0xf9, 0x65, 0x00, 0x01, 0xf9, 0x65, 0x00, 0x00,
-    0x03, 0xe0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x47, 0x45, 0x56, 0x57, 0x58, 0x59, 0x44, 0x46, 0x49, 0x4c, 0x4a, 0x42, 0x4b, 0x40, 0x4d, 0x3f,
-    0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x41, 0x43, 0x5a, 0x4e, 0x5b, 0x48, 0x5d, 0x1c, 0x1d, 0x1e,
-    0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31,
-    0x32, 0x33, 0x34, 0x35, 0x51, 0x4f, 0x52, 0x5c, 0x50, 0xf6, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
-    0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x53, 0x55,
-    0x54, 0x5e, 0x00, 0x86, 0xc1, 0x00, 0x00, 0x00, 0x8c, 0x8e, 0x00, 0xf8, 0x00, 0x87, 0x00, 0xc2, 0x00, 0x00, 0xfa,
-    0x00, 0x89, 0x00, 0xfc, 0x00, 0x8b, 0x00, 0x00, 0xfe, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xbe, 0x63, 0x66,
-    0x69, 0xb1, 0xcd, 0x65, 0x9b, 0xd4, 0x64, 0x00, 0x00, 0x85, 0x00, 0x96, 0x9c, 0x00, 0x74, 0x72, 0x73, 0xb2, 0x75,
-    0x00, 0xcf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x9d, 0x60, 0x5f, 0x76, 0x00, 0x00, 0x70, 0x00, 0x61, 0x62,
-    0xbc, 0x01, 0xf7, 0x00, 0x00, 0x98, 0x99, 0xad, 0xae, 0xa7, 0xa8, 0xa3, 0xa4, 0x68, 0x00, 0x91, 0x90, 0x00, 0xd3,
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xd1, 0xa5, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf9, 0x00, 0x00, 0x8a, 0xfb, 0x00,
-    0x00, 0x00, 0xfd, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x78, 0x00, 0xb7, 0xc0, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00,
-    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x5e, 0x00, 0x7a, 0x00, 0x9a, 0x00, 0xb8, 0x00, 0xd8, 0x00, 0xf2, 0x01, 0x12, 0x01,
-    0x2a, 0x01, 0x46, 0x01, 0x64, 0x01, 0x88, 0x01, 0xa0, 0x01, 0xbc, 0x01, 0xd0, 0x01, 0xee, 0x02, 0x0a, 0x02, 0x26,
-    0x02, 0x42, 0x02, 0x5c, 0x02, 0x78, 0x02, 0x90, 0x02, 0xb4, 0x02, 0xd6, 0x02, 0xfa, 0x03, 0x1c, 0x03, 0x38, 0x03,
-    0x60, 0x03, 0x88, 0x03, 0xa8, 0x03, 0xca, 0x03, 0xe2, 0x03, 0xf6, 0x04, 0x14, 0x04, 0x2c, 0x04, 0x44, 0x04, 0x5e,
-    0x04, 0x88, 0x04, 0x98, 0x04, 0xb6, 0x04, 0xd6, 0x04, 0xf4, 0x05, 0x12, 0x05, 0x3e, 0x05, 0x64, 0x05, 0x8e, 0x05,
-    0xa2, 0x05, 0xba, 0x05, 0xde, 0x06, 0x00, 0x06, 0x2e, 0x06, 0x4c, 0x06, 0x6e, 0x06, 0x82, 0x06, 0xaa, 0x06, 0xd4,
-    0x06, 0xf6, 0x07, 0x18, 0x07, 0x40, 0x07, 0x68, 0x07, 0x98, 0x07, 0xc2, 0x07, 0xe4, 0x07, 0xf2, 0x08, 0x08, 0x08,
-    0x1c, 0x08, 0x32, 0x08, 0x48, 0x08, 0x6e, 0x08, 0x8e, 0x08, 0xaa, 0x08, 0xd0, 0x08, 0xf0, 0x09, 0x08, 0x09, 0x16,
-    0x09, 0x34, 0x09, 0x56, 0x09, 0x6a, 0x09, 0x8c, 0x09, 0x98, 0x09, 0xaa, 0x09, 0xbc, 0x09, 0xd8, 0x09, 0xf4, 0x0a,
-    0x02, 0x0a, 0x30, 0x0a, 0x64, 0x0a, 0xb4, 0x0a, 0xe8, 0x0b, 0x04, 0x0b, 0x22, 0x0b, 0x42, 0x0b, 0x66, 0x0b, 0x82,
-    0x0b, 0xa0, 0x0b, 0xc6, 0x0b, 0xfa, 0x0c, 0x2e, 0x0c, 0x52, 0x0c, 0x80, 0x0c, 0xa0, 0x0c, 0xce, 0x0d, 0x0a, 0x0d,
-    0x24, 0x0d, 0x4a, 0x0d, 0x74, 0x0d, 0x8e, 0x0d, 0xbc, 0x0d, 0xf0, 0x0e, 0x18, 0x0e, 0x3e, 0x0e, 0x70, 0x0e, 0x8c,
-    0x0e, 0xb0, 0x0e, 0xd6, 0x0e, 0xf4, 0x0f, 0x0e, 0x0f, 0x1e, 0x0f, 0x2e, 0x0f, 0x3c, 0x0f, 0x6a, 0x0f, 0x90, 0x0f,
-    0xac, 0x0f, 0xd4, 0x0f, 0xf2, 0x10, 0x0c, 0x10, 0x30, 0x10, 0x54, 0x10, 0x74, 0x10, 0x94, 0x10, 0xb8, 0x10, 0xe2,
-    0x10, 0xf4, 0x11, 0x26, 0x11, 0x52, 0x11, 0x74, 0x11, 0xa0, 0x11, 0xc4, 0x11, 0xe4, 0x12, 0x0e, 0x12, 0x38, 0x12,
-    0x5c, 0x12, 0x80, 0x12, 0xaa, 0x12, 0xda, 0x12, 0xfe, 0x13, 0x22, 0x13, 0x4e, 0x13, 0x7c, 0x13, 0xa6, 0x13, 0xcc,
-    0x13, 0xf0, 0x14, 0x16, 0x14, 0x40, 0x14, 0x68, 0x14, 0x94, 0x14, 0xbc, 0x14, 0xd2, 0x14, 0xf8, 0x15, 0x0e, 0x15,
-    0x24, 0x15, 0x3a, 0x15, 0x50, 0x15, 0x66, 0x15, 0x7a, 0x15, 0x90, 0x15, 0xb6, 0x15, 0xdc, 0x16, 0x00, 0x16, 0x28,
-    0x16, 0x36, 0x16, 0x44, 0x16, 0x52, 0x16, 0x60, 0x16, 0x6e, 0x16, 0x7c, 0x16, 0xa2, 0x16, 0xd2, 0x16, 0xe8, 0x17,
-    0x04, 0x17, 0x20, 0x17, 0x34, 0x17, 0x42, 0x17, 0x5e, 0x17, 0x86, 0x17, 0xaa, 0x17, 0xca, 0x17, 0xe2, 0x18, 0x04,
-    0x18, 0x1c, 0x18, 0x3e, 0x18, 0x52, 0x18, 0x80, 0x18, 0xaa, 0x18, 0xdc, 0x19, 0x0a, 0x19, 0x2c, 0x19, 0x4c, 0x19,
-    0x70, 0x19, 0xa0, 0x19, 0xca, 0x19, 0xd8, 0x19, 0xec, 0x1a, 0x14, 0x1a, 0x22, 0x1a, 0x44, 0x1a, 0x68, 0x1a, 0x7a,
-    0x1a, 0x88, 0x1a, 0xa6, 0x1a, 0xd4, 0x1b, 0x04, 0x1b, 0x1c, 0x1b, 0x4c, 0x1b, 0x74, 0x1b, 0xa4, 0x1b, 0xc8, 0x1b,
-    0xf0, 0x1c, 0x20, 0x1c, 0x3e, 0x1c, 0x5e, 0x1c, 0x92, 0x1c, 0xb8, 0x1c, 0xec, 0x1d, 0x16, 0x1d, 0x3e, 0x1d, 0x6e,
-    0x1d, 0x92, 0x1d, 0xb4, 0x1d, 0xe2, 0x1e, 0x0c, 0x1e, 0x42, 0x1e, 0x72, 0x1e, 0x9a, 0x1e, 0xc0, 0x1e, 0xee, 0x1f,
-    0x1e, 0x1f, 0x48, 0x1f, 0x72, 0x1f, 0xa0, 0x1f, 0xd0, 0x20, 0x04, 0x20, 0x36, 0x20, 0x60, 0x20, 0x8a, 0x20, 0x9c,
-    0x20, 0xcc, 0x20, 0xf6, 0x21, 0x18, 0x21, 0x42, 0x21, 0x64, 0x21, 0x84, 0x21, 0xac, 0x21, 0xd6, 0x21, 0xfa, 0x22,
-    0x1e, 0x22, 0x4c, 0x22, 0x6c, 0x22, 0x96, 0x22, 0xc2, 0x22, 0xec, 0x23, 0x1a, 0x23, 0x2c, 0x23, 0x5c, 0x23, 0x86,
-    0x23, 0xa8, 0x23, 0xd2, 0x23, 0xf4, 0x24, 0x14, 0x24, 0x3c, 0x24, 0x66, 0x24, 0x8a, 0x24, 0xae, 0x24, 0xd8, 0x25,
-    0x06, 0x25, 0x30, 0x25, 0x52, 0x25, 0x6c, 0x25, 0x8e, 0x25, 0xbc, 0x25, 0xdc, 0x26, 0x0a, 0x26, 0x30, 0x26, 0x52,
-    0x26, 0x7c, 0x26, 0xa4, 0x26, 0xc8, 0x26, 0xf0, 0x27, 0x1a, 0x27, 0x48, 0x27, 0x74, 0x27, 0x9e, 0x27, 0xc4, 0x27,
-    0xea, 0x28, 0x12, 0x28, 0x3c, 0x28, 0x68, 0x28, 0x90, 0x28, 0xae, 0x28, 0xc8, 0x28, 0xf8, 0x29, 0x26, 0x29, 0x4c,
-    0x29, 0x7a, 0x29, 0xa2, 0x29, 0xc4, 0x29, 0xf0, 0x2a, 0x20, 0x2a, 0x4a, 0x2a, 0x74, 0x2a, 0xa2, 0x2a, 0xcc, 0x2a,
-    0xf8, 0x2b, 0x26, 0x2b, 0x50, 0x2b, 0x78, 0x2b, 0x9e, 0x2b, 0xc8, 0x2b, 0xf0, 0x2c, 0x1e, 0x2c, 0x50, 0x2c, 0x82,
-    0x2c, 0xb2, 0x2c, 0xe6, 0x2d, 0x14, 0x2d, 0x40, 0x2d, 0x5e, 0x2d, 0x94, 0x2d, 0xc8, 0x2e, 0x02, 0x2e, 0x2c, 0x2e,
-    0x5e, 0x2e, 0x92, 0x2e, 0xc0, 0x2e, 0xe8, 0x2f, 0x16, 0x2f, 0x44, 0x2f, 0x7e, 0x2f, 0xb6, 0x2f, 0xe2, 0x30, 0x16,
-    0x30, 0x4a, 0x30, 0x82, 0x30, 0x94, 0x30, 0xc0, 0x30, 0xe4, 0x31, 0x0c, 0x31, 0x32, 0x31, 0x62, 0x31, 0x8e, 0x31,
-    0xaa, 0x31, 0xca, 0x31, 0xfa, 0x32, 0x1a, 0x32, 0x4a, 0x32, 0x74, 0x32, 0x98, 0x32, 0xc2, 0x32, 0xe0, 0x33, 0x06,
-    0x33, 0x28, 0x33, 0x54, 0x33, 0x80, 0x33, 0xa8, 0x33, 0xcc, 0x33, 0xf0, 0x34, 0x0e, 0x34, 0x34, 0x34, 0x4e, 0x34,
-    0x70, 0x34, 0x82, 0x34, 0xb0, 0x34, 0xda, 0x34, 0xfc, 0x35, 0x26, 0x35, 0x48, 0x35, 0x68, 0x35, 0x8a, 0x35, 0xac,
-    0x35, 0xd4, 0x35, 0xfc, 0x36, 0x2a, 0x36, 0x5e, 0x36, 0x88, 0x36, 0xb6, 0x36, 0xd6, 0x36, 0xfa, 0x37, 0x18, 0x37,
-    0x2c, 0x37, 0x56, 0x37, 0x80, 0x37, 0xb0, 0x37, 0xd0, 0x37, 0xee, 0x38, 0x0e, 0x38, 0x2e, 0x38, 0x4c, 0x38, 0x6a,
-    0x38, 0x82, 0x38, 0xa4, 0x38, 0xbe, 0x38, 0xe4, 0x39, 0x06, 0x39, 0x24, 0x39, 0x48, 0x39, 0x72, 0x39, 0x98, 0x39,
-    0xc2, 0x39, 0xe8, 0x3a, 0x12, 0x3a, 0x34, 0x3a, 0x56, 0x3a, 0x7c, 0x3a, 0xa4, 0x3a, 0xca, 0x3a, 0xdc, 0x3b, 0x06,
-    0x3b, 0x2e, 0x3b, 0x50, 0x3b, 0x7a, 0x3b, 0xa0, 0x3b, 0xca, 0x3b, 0xec, 0x3c, 0x08, 0x3c, 0x2e, 0x3c, 0x58, 0x3c,
-    0x7c, 0x3c, 0xa0, 0x3c, 0xbe, 0x3c, 0xdc, 0x3c, 0xf6, 0x3d, 0x1a, 0x3d, 0x46, 0x3d, 0x6c, 0x3d, 0x94, 0x3d, 0xb8,
-    0x3d, 0xd6, 0x3d, 0xfe, 0x3e, 0x1e, 0x3e, 0x3e, 0x3e, 0x5c, 0x3e, 0x78, 0x3e, 0x9c, 0x3e, 0xc0, 0x3e, 0xec, 0x3f,
-    0x10, 0x3f, 0x2e, 0x3f, 0x54, 0x3f, 0x74, 0x3f, 0x94, 0x3f, 0xb8, 0x3f, 0xe0, 0x40, 0x04, 0x40, 0x24, 0x40, 0x4a,
-    0x40, 0x68, 0x40, 0x8c, 0x40, 0xb2, 0x40, 0xc8, 0x40, 0xe4, 0x41, 0x0e, 0x41, 0x2a, 0x41, 0x44, 0x41, 0x64, 0x41,
-    0x7a, 0x41, 0x98, 0x41, 0xc4, 0x41, 0xe0, 0x41, 0xf6, 0x42, 0x0c, 0x42, 0x22, 0x42, 0x40, 0x42, 0x66, 0x42, 0x8a,
-    0x42, 0xb0, 0x42, 0xd4, 0x43, 0x0c, 0x43, 0x2c, 0x43, 0x4c, 0x43, 0x6c, 0x43, 0x8c, 0x43, 0xc2, 0x43, 0xfa, 0x44,
-    0x30, 0x44, 0x3c, 0x44, 0x4a, 0x44, 0x60, 0x44, 0x7e, 0x44, 0xb4, 0x44, 0xe8, 0x45, 0x12, 0x45, 0x64, 0x45, 0x86,
-    0x45, 0xce, 0x45, 0xf8, 0x46, 0x16, 0x46, 0x3a, 0x46, 0x5a, 0x46, 0x7e, 0x46, 0x9e, 0x46, 0xb6, 0x46, 0xd6, 0x46,
-    0xfa, 0x47, 0x1a, 0x47, 0x3c, 0x47, 0x68, 0x47, 0x90, 0x47, 0xba, 0x47, 0xdc, 0x48, 0x04, 0x48, 0x28, 0x48, 0x42,
-    0x48, 0x62, 0x48, 0x86, 0x48, 0xa8, 0x48, 0xca, 0x48, 0xec, 0x49, 0x0a, 0x49, 0x30, 0x49, 0x48, 0x49, 0x68, 0x49,
-    0x90, 0x49, 0xae, 0x49, 0xd6, 0x49, 0xe6, 0x4a, 0x06, 0x4a, 0x1e, 0x4a, 0x50, 0x4a, 0x7a, 0x4a, 0x9a, 0x4a, 0xc8,
-    0x4a, 0xf2, 0x4b, 0x0e, 0x4b, 0x2c, 0x4b, 0x44, 0x4b, 0x62, 0x4b, 0x74, 0x4b, 0x92, 0x4b, 0xb2, 0x4b, 0xc6, 0x4b,
-    0xf0, 0x4c, 0x1e, 0x4c, 0x4c, 0x4c, 0x64, 0x4c, 0x7a, 0x4c, 0x92, 0x4c, 0xac, 0x4c, 0xcc, 0x4c, 0xf0, 0x4d, 0x0c,
-    0x4d, 0x32, 0x4d, 0x58, 0x4d, 0x80, 0x4d, 0xa0, 0x4d, 0xc2, 0x4d, 0xe6, 0x4d, 0xf6, 0x4e, 0x16, 0x4e, 0x36, 0x4e,
-    0x62, 0x4e, 0x8a, 0x4e, 0xa8, 0x4e, 0xd6, 0x4e, 0xfa, 0x4f, 0x16, 0x4f, 0x34, 0x4f, 0x4c, 0x4f, 0x6a, 0x4f, 0x7c,
-    0x4f, 0x98, 0x4f, 0xb8, 0x4f, 0xcc, 0x4f, 0xf0, 0x50, 0x1e, 0x50, 0x42, 0x50, 0x5a, 0x50, 0x70, 0x50, 0x88, 0x50,
-    0xa2, 0x50, 0xc0, 0x50, 0xe2, 0x50, 0xfc, 0x51, 0x20, 0x51, 0x44, 0x51, 0x68, 0x51, 0x8a, 0x51, 0xb6, 0x51, 0xd6,
-    0x51, 0xf6, 0x52, 0x10, 0x52, 0x2e, 0x52, 0x52, 0x52, 0x74, 0x52, 0x9a, 0x52, 0xc0, 0x52, 0xdc, 0x52, 0xfc, 0x53,
-    0x16, 0x53, 0x2e, 0x53, 0x46, 0x53, 0x62, 0x53, 0x96, 0x53, 0xc2, 0x53, 0xea, 0x54, 0x12, 0x54, 0x26, 0x54, 0x3a,
-    0x54, 0x60, 0x54, 0x86, 0x54, 0xaa, 0x54, 0xca, 0x54, 0xf4, 0x55, 0x0e, 0x55, 0x2a, 0x55, 0x44, 0x55, 0x72, 0x55,
-    0x9e, 0x55, 0xc0, 0x55, 0xea, 0x56, 0x12, 0x56, 0x34, 0x56, 0x5c, 0x56, 0x84, 0x56, 0x94, 0x56, 0xb2, 0x56, 0xd4,
-    0x57, 0x00, 0x57, 0x18, 0x57, 0x40, 0x57, 0x62, 0x57, 0x86, 0x57, 0x9e, 0x57, 0xb4, 0x57, 0xd8, 0x57, 0xfa, 0x58,
-    0x12, 0x58, 0x24, 0x58, 0x4e, 0x58, 0x72, 0x58, 0x94, 0x58, 0xbc, 0x58, 0xda, 0x58, 0xf2, 0x59, 0x12, 0x59, 0x36,
-    0x59, 0x50, 0x59, 0x78, 0x59, 0x96, 0x59, 0xb4, 0x59, 0xc6, 0x59, 0xde, 0x59, 0xfc, 0x5a, 0x18, 0x5a, 0x3c, 0x5a,
-    0x5a, 0x5a, 0x7a, 0x5a, 0x8e, 0x5a, 0xa2, 0x5a, 0xc0, 0x5a, 0xd8, 0x5b, 0x06, 0x5b, 0x2c, 0x5b, 0x5a, 0x5b, 0x7e,
-    0x5b, 0xa4, 0x5b, 0xc6, 0x5b, 0xea, 0x5c, 0x12, 0x5c, 0x36, 0x5c, 0x56, 0x5c, 0x80, 0x5c, 0xa4, 0x5c, 0xd0, 0x5c,
-    0xfe, 0x5d, 0x1e, 0x5d, 0x50, 0x5d, 0x70, 0x5d, 0x90, 0x5d, 0xae, 0x5d, 0xcc, 0x5d, 0xf0, 0x5e, 0x1a, 0x5e, 0x3e,
-    0x5e, 0x62, 0x5e, 0x88, 0x5e, 0xbc, 0x5e, 0xe2, 0x5f, 0x0e, 0x5f, 0x2e, 0x5f, 0x5a, 0x5f, 0x96, 0x5f, 0xc0, 0x5f,
-    0xda, 0x5f, 0xfa, 0x60, 0x2c, 0x60, 0x56, 0x60, 0x7a, 0x60, 0x90, 0x60, 0xb0, 0x60, 0xd0, 0x60, 0xee, 0x61, 0x04,
-    0x61, 0x28, 0x61, 0x50, 0x61, 0x80, 0x61, 0xa0, 0x61, 0xc2, 0x61, 0xec, 0x62, 0x16, 0x62, 0x3e, 0x62, 0x4a, 0x62,
-    0x70, 0x62, 0x92, 0x62, 0xb0, 0x62, 0xce, 0x62, 0xe6, 0x62, 0xfe, 0x63, 0x18, 0x63, 0x32, 0x63, 0x5c, 0x63, 0x84,
-    0x63, 0xae, 0x63, 0xd6, 0x63, 0xf6, 0x64, 0x16, 0x64, 0x44, 0x64, 0x6e, 0x64, 0xa2, 0x64, 0xd0, 0x64, 0xfa, 0x65,
-    0x20, 0x65, 0x32, 0x65, 0x4c, 0x65, 0x5a, 0x65, 0x70, 0x65, 0x96, 0x65, 0xb8, 0x65, 0xda, 0x66, 0x02, 0x66, 0x20,
-    0x66, 0x3e, 0x66, 0x64, 0x66, 0x8a, 0x66, 0xc8, 0x67, 0x06, 0x67, 0x12, 0x67, 0x3a, 0x67, 0x4a, 0x67, 0x66, 0x67,
-    0xa8, 0x67, 0xd6, 0x68, 0x0a, 0x68, 0x3c, 0x68, 0x6a, 0x68, 0x80, 0x68, 0x94, 0x68, 0xb8, 0x68, 0xd6, 0x69, 0x02,
-    0x69, 0x36, 0x69, 0x50, 0x69, 0x74, 0x69, 0x86, 0x69, 0xa4, 0x69, 0xb2, 0x69, 0xce, 0x69, 0xe8, 0x6a, 0x12, 0x6a,
-    0x20, 0x6a, 0x3e, 0x6a, 0x5c, 0x6a, 0x82, 0x6a, 0x9c, 0x6a, 0xba, 0x6a, 0xda, 0x6b, 0x00, 0x6b, 0x28, 0x6b, 0x4a,
-    0x6b, 0x60, 0x6b, 0x8a, 0x6b, 0xaa, 0x6b, 0xc4, 0x6b, 0xe0, 0x6b, 0xfc, 0x6c, 0x0a, 0x6c, 0x28, 0x6c, 0x48, 0x6c,
-    0x5c, 0x6c, 0x72, 0x6c, 0x88, 0x6c, 0x9e, 0x6c, 0xc4, 0x6c, 0xd2, 0x6c, 0xfa, 0x6d, 0x1a, 0x6d, 0x4a, 0x6d, 0x72,
-    0x6d, 0xa2, 0x6d, 0xca, 0x6d, 0xf2, 0x6e, 0x12, 0x6e, 0x44, 0x6e, 0x68, 0x6e, 0x9e, 0x6e, 0xc2, 0x6e, 0xf2, 0x6f,
-    0x28, 0x6f, 0x66, 0x6f, 0xa8, 0x6f, 0xf8, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xb2, 0x70, 0xd0, 0x71, 0x1e, 0x71, 0x52,
-    0x71, 0x7e, 0x71, 0x98, 0x71, 0xb4, 0x71, 0xda, 0x72, 0x00, 0x72, 0x26, 0x72, 0x4c, 0x72, 0x70, 0x72, 0x94, 0x72,
-    0xb6, 0x72, 0xd8, 0x73, 0x06, 0x73, 0x36, 0x73, 0x64, 0x73, 0x94, 0x73, 0xca, 0x74, 0x04, 0x74, 0x22, 0x74, 0x40,
-    0x74, 0x6a, 0x74, 0x94, 0x74, 0xbe, 0x74, 0xe8, 0x75, 0x1c, 0x75, 0x50, 0x75, 0x72, 0x75, 0x94, 0x75, 0xbc, 0x75,
-    0xe8, 0x76, 0x0a, 0x76, 0x2a, 0x76, 0x40, 0x76, 0xa6, 0x77, 0x68, 0x77, 0xaa, 0x77, 0xd2, 0x78, 0x08, 0x78, 0x30,
-    0x78, 0x58, 0x78, 0x78, 0x78, 0x9e, 0x78, 0xb8, 0x78, 0xd4, 0x78, 0xf0, 0x79, 0x16, 0x79, 0x3a, 0x79, 0x72, 0x79,
-    0xa6, 0x79, 0xc0, 0x79, 0xd2, 0x79, 0xe4, 0x79, 0xf0, 0x7a, 0x10, 0x7a, 0x36, 0x7a, 0x66, 0x7a, 0xa2, 0x7a, 0xce,
-    0x7a, 0xfc, 0x7b, 0x1a, 0x7b, 0x44, 0x7b, 0x6e, 0x7b, 0x8a, 0x7b, 0xb2, 0x7b, 0xec, 0x7c, 0x1e, 0x7c, 0x44, 0x7c,
-    0x66, 0x7c, 0xa2, 0x7c, 0xc0, 0x7c, 0xf0, 0x7d, 0x1e, 0x7d, 0x3e, 0x7d, 0x5e, 0x7d, 0x7e, 0x7d, 0xa4, 0x7d, 0xca,
-    0x7d, 0xea, 0x7e, 0x10, 0x7e, 0x38, 0x7e, 0x62, 0x7e, 0x84, 0x7e, 0xba, 0x7e, 0xe2, 0x7f, 0x04, 0x7f, 0x22, 0x7f,
-    0x58, 0x7f, 0x82, 0x7f, 0x9e, 0x7f, 0xba, 0x7f, 0xd4, 0x7f, 0xf2, 0x80, 0x1e, 0x80, 0x4a, 0x80, 0x80, 0x80, 0xaa,
-    0x80, 0xd4, 0x80, 0xf0, 0x81, 0x0c, 0x81, 0x2a, 0x81, 0x48, 0x81, 0x66, 0x81, 0x8a, 0x81, 0xae, 0x81, 0xd8, 0x81,
-    0xfc, 0x82, 0x26, 0x82, 0x58, 0x82, 0x7e, 0x82, 0xb6, 0x82, 0xd6, 0x82, 0xe8, 0x83, 0x02, 0x83, 0x1c, 0x83, 0x4e,
-    0x83, 0x6c, 0x83, 0xb6, 0x83, 0xf4, 0x84, 0x24, 0x84, 0x46, 0x84, 0x6a, 0x84, 0x8a, 0x84, 0xcc, 0x84, 0xf0, 0x85,
-    0x10, 0x85, 0x3a, 0x85, 0x60, 0x85, 0x80, 0x85, 0xa6, 0x85, 0xd2, 0x86, 0x02, 0x86, 0x2e, 0x86, 0x64, 0x86, 0xa2,
-    0x86, 0xc8, 0x86, 0xe2, 0x86, 0xf4, 0x87, 0x10, 0x87, 0x28, 0x87, 0x40, 0x87, 0x60, 0x87, 0x88, 0x87, 0xb4, 0x87,
-    0xe0, 0x88, 0x0e, 0x88, 0x22, 0x88, 0x2e, 0x88, 0x4c, 0x88, 0x66, 0x88, 0x7e, 0x88, 0x96, 0x88, 0xb0, 0x88, 0xd4,
-    0x89, 0x08, 0x89, 0x3c, 0x89, 0x5c, 0x89, 0x84, 0x89, 0xaa, 0x89, 0xda, 0x8a, 0x12, 0x8a, 0x3a, 0x8a, 0x6e, 0x8a,
-    0x94, 0x8a, 0xba, 0x8a, 0xd8, 0x8a, 0xf4, 0x8b, 0x28, 0x8b, 0x5c, 0x8b, 0x8a, 0x8b, 0xb8, 0x8b, 0xde, 0x8b, 0xf2,
-    0x8c, 0x16, 0x8c, 0x3a, 0x8c, 0x66, 0x8c, 0xa4, 0x8c, 0xd6, 0x8c, 0xfc, 0x8d, 0x24, 0x8d, 0x60, 0x8d, 0x7a, 0x8d,
-    0xac, 0x8d, 0xd4, 0x8d, 0xec, 0x8e, 0x06, 0x8e, 0x20, 0x8e, 0x3a, 0x8e, 0x7a, 0x8e, 0xa8, 0x8e, 0xd2, 0x8f, 0x40,
-    0x8f, 0x74, 0x8f, 0xa2, 0x8f, 0xe4, 0x90, 0x04, 0x90, 0x64, 0x90, 0x94, 0x90, 0xc0, 0x90, 0xe2, 0x91, 0x02, 0x91,
-    0x36, 0x91, 0x62, 0x91, 0x70, 0x91, 0x7e, 0x91, 0xa2, 0x91, 0xc0, 0x91, 0xda, 0x91, 0xf8, 0x92, 0x16, 0x92, 0x36,
-    0x92, 0x56, 0x92, 0x76, 0x92, 0x9c, 0x92, 0xd2, 0x92, 0xfa, 0x93, 0x26, 0x93, 0x3c, 0x93, 0x6a, 0x93, 0x8e, 0x93,
-    0xca, 0x93, 0xde, 0x94, 0x06, 0x94, 0x3a, 0x94, 0x78, 0x94, 0xb4, 0x94, 0xd4, 0x94, 0xfe, 0x95, 0x28, 0x95, 0x5c,
-    0x95, 0x88, 0x95, 0xae, 0x95, 0xdc, 0x96, 0x10, 0x96, 0x42, 0x96, 0x6e, 0x96, 0xa8, 0x96, 0xde, 0x97, 0x08, 0x97,
-    0x32, 0x97, 0x56, 0x97, 0x78, 0x97, 0xa2, 0x97, 0xca, 0x97, 0xee, 0x98, 0x10, 0x98, 0x28, 0x98, 0x44, 0x98, 0x60,
-    0x98, 0x7c, 0x98, 0x94, 0x98, 0xac, 0x98, 0xc8, 0x98, 0xe4, 0x98, 0xfa, 0x99, 0x10, 0x99, 0x2a, 0x99, 0x44, 0x99,
-    0x7c, 0x99, 0xb4, 0x99, 0xd0, 0x99, 0xec, 0x9a, 0x12, 0x9a, 0x38, 0x9a, 0x54, 0x9a, 0x72, 0x9a, 0xa4, 0x9a, 0xca,
-    0x9a, 0xfa, 0x9b, 0x24, 0x9b, 0x58, 0x9b, 0x86, 0x9b, 0xaa, 0x9b, 0xce, 0x9c, 0x06, 0x9c, 0x28, 0x9c, 0x62, 0x9c,
-    0x84, 0x9c, 0xa6, 0x9c, 0xde, 0x9d, 0x0c, 0x9d, 0x4a, 0x9d, 0x7c, 0x9d, 0xa2, 0x9d, 0xc6, 0x9d, 0xf6, 0x9e, 0x1c,
-    0x9e, 0x42, 0x9e, 0x66, 0x9e, 0x92, 0x9e, 0xbc, 0x9e, 0xda, 0x9e, 0xf8, 0x9f, 0x22, 0x9f, 0x48, 0x9f, 0x78, 0x9f,
-    0xa6, 0x9f, 0xd0, 0x9f, 0xf8, 0xa0, 0x2a, 0xa0, 0x5c, 0xa0, 0x86, 0xa0, 0xac, 0xa0, 0xd0, 0xa0, 0xf4, 0xa1, 0x1a,
-    0xa1, 0x44, 0xa1, 0x60, 0xa1, 0x88, 0xa1, 0xa8, 0xa1, 0xca, 0xa1, 0xe2, 0xa1, 0xf0, 0xa2, 0x02, 0xa2, 0x14, 0xa2,
-    0x22, 0xa2, 0x34, 0xa2, 0x46, 0xa2, 0x6c, 0xa2, 0x80, 0xa2, 0x8e, 0xa2, 0x9a, 0xa2, 0xac, 0xa2, 0xd4, 0xa2, 0xfc,
-    0xa3, 0x0e, 0xa3, 0x20, 0xa3, 0x3a, 0xa3, 0x58, 0xa3, 0x66, 0xa3, 0x72, 0xa3, 0x84, 0xa3, 0x92, 0xa3, 0xa4, 0xa3,
-    0xb8, 0xa3, 0xd4, 0xa3, 0xec, 0xa3, 0xfa, 0xa4, 0x0e, 0xa4, 0x2a, 0xa4, 0x3c, 0xa4, 0x48, 0xa4, 0x5a, 0xa4, 0x66,
-    0xa4, 0x7c, 0xa4, 0x8a, 0xa4, 0x9c, 0xa4, 0xa8, 0xa4, 0xd2, 0xa4, 0xe0, 0xa5, 0x10, 0xa5, 0x3c, 0xa5, 0x60, 0xa5,
-    0x7a, 0xa5, 0xb0, 0xa5, 0xd6, 0xa5, 0xfa, 0xa6, 0x1e, 0xa6, 0x40, 0xa6, 0x62, 0xa6, 0x86, 0xa6, 0x9e, 0xa6, 0xaa,
-    0xa6, 0xb8, 0xa6, 0xc6, 0xa6, 0xd2, 0xa6, 0xe6, 0xa6, 0xfc, 0xa7, 0x0a, 0xa7, 0x18, 0xa7, 0x26, 0xa7, 0x34, 0xa7,
-    0x46, 0xa7, 0x58, 0xa7, 0x6a, 0xa7, 0x7c, 0xa7, 0x88, 0xa7, 0x96, 0xa7, 0xa2, 0xa7, 0xae, 0xa7, 0xd2, 0xa7, 0xf6,
-    0xa8, 0x26, 0xa8, 0x4e, 0xa8, 0x64, 0xa8, 0x7a, 0xa8, 0xa4, 0xa8, 0xcc, 0xa8, 0xe2, 0xa9, 0x04, 0xa9, 0x26, 0xa9,
-    0x54, 0xa9, 0x80, 0xa9, 0xb0, 0xaa, 0x08, 0xaa, 0x32, 0xaa, 0x4e, 0xaa, 0x76, 0xaa, 0x9c, 0xaa, 0xc0, 0xaa, 0xe4,
-    0xaa, 0xe4, 0xaa, 0xe4, 0xaa, 0xe4, 0xaa, 0xe4, 0xaa, 0xe4, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x23,
-    0x35, 0x33, 0x01, 0x11, 0x21, 0x11, 0x01, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x05,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x02, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x37, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x25, 0x21, 0x11, 0x21,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15,
-    0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x03, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00,
-    0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x03,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00,
-    0x11, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x02, 0x00, 0xff,
-    0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x01, 0x35, 0x21,
-    0x15, 0x2b, 0x01, 0x35, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x02, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x02, 0x00, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0xfd, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x03, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x01, 0x00, 0x02, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00,
-    0x00, 0x01, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x21, 0x03, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x00,
-    0x31, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80,
-    0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11,
-    0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x21, 0x11, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x01, 0x21, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35,
-    0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x03, 0x00, 0x01, 0x80,
-    0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00,
-    0x07, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x01, 0x33, 0x15, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f,
-    0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x21, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x15, 0x02,
-    0x80, 0xfd, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x11, 0x35, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80,
-    0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x21, 0x35, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21,
-    0x35, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00,
-    0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x21, 0x15, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17,
-    0x00, 0x00, 0x01, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x01, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x33, 0x11, 0x23, 0x03, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x03,
-    0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x25, 0x35,
-    0x33, 0x11, 0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x02,
-    0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x31, 0x11,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00,
-    0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80,
-    0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x01, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00,
-    0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x33, 0x35, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0d, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80,
-    0x80, 0xfd, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00, 0x02, 0x80, 0x03, 0x80,
-    0xfd, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00,
-    0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35,
-    0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfc, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x33, 0x11,
-    0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00,
-    0x03, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x19,
-    0x00, 0x00, 0x01, 0x23, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x05, 0x23, 0x35, 0x33, 0x21, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x19, 0x01, 0x21, 0x11, 0x21,
-    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13,
-    0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x80, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfd,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x03, 0x00, 0xfd, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80,
-    0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x31,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xfe,
-    0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x33, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21,
-    0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x35,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xff,
-    0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x05, 0x11, 0x33, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x35,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80,
-    0x01, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x01, 0x21, 0x11, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x01, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x23, 0x11, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x02, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x21, 0x11, 0x21, 0x01, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x35, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x03, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x25, 0x21, 0x11, 0x23, 0x35, 0x21, 0x11, 0x33, 0x05, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x11,
-    0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x01, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x21, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x23, 0x11, 0x21, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x21, 0x23,
-    0x35, 0x23, 0x35, 0x21, 0x25, 0x11, 0x21, 0x11, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80,
-    0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00,
-    0x03, 0x00, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x03, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x35,
-    0x21, 0x15, 0x01, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x01, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x21, 0x35, 0x21,
-    0x15, 0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15,
-    0x01, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x21, 0x35, 0x33, 0x11,
-    0x23, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x0b,
-    0x00, 0x00, 0x21, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x02, 0x00, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x02, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x13, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21,
-    0x35, 0x23, 0x15, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03,
-    0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x37,
-    0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x17, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x33, 0x11, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x03, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x29, 0x01, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x21, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x02, 0x80, 0x80, 0x00, 0x01, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35,
-    0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x03, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x33, 0x15, 0x23, 0x11, 0x23, 0x15, 0x21, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x29, 0x01, 0x11, 0x21, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00,
-    0x00, 0x37, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x11, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0x21, 0x01, 0x33, 0x11, 0x23, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x33, 0x35, 0x23, 0x27, 0x35, 0x23, 0x15, 0x01, 0x15, 0x23, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39,
-    0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x25, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x2b,
-    0x01, 0x35, 0x33, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x00, 0x00, 0x01, 0x33,
-    0x35, 0x23, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x03, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35,
-    0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00,
-    0x13, 0x00, 0x00, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x29, 0x01, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x17, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80,
-    0x03, 0x80, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x35, 0x11, 0x33, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x02,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x02, 0x80, 0xff, 0x00,
-    0x02, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x25, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x21, 0x23, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x03, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x27,
-    0x00, 0x00, 0x37, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x25, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x11, 0x33, 0x15, 0x21, 0x11, 0x23,
-    0x01, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x02, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x25, 0x15,
-    0x21, 0x35, 0x01, 0x23, 0x11, 0x33, 0x01, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff,
-    0x00, 0x02, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x35, 0x23, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x23, 0x11, 0x23, 0x11, 0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x00, 0x09, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
-    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00,
-    0x23, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35,
-    0x33, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x15, 0x21,
-    0x35, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x31, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x05, 0x23, 0x35, 0x33, 0x11, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x02, 0x80, 0xff,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x35,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x21, 0x35, 0x21, 0x80, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00,
-    0xfd, 0x00, 0x03, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35,
-    0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21,
-    0x15, 0x23, 0x11, 0x23, 0x11, 0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x01, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfd,
-    0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x21, 0x15, 0x21, 0x01, 0x15, 0x21, 0x11, 0x33, 0x11,
-    0x21, 0x23, 0x11, 0x33, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0xfe, 0x00,
-    0x80, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x03, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80,
-    0xfe, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00,
-    0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x1f, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11,
-    0x01, 0x11, 0x33, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01,
-    0x35, 0x21, 0x15, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03,
-    0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x01, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x01, 0x35, 0x21, 0x15, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x0f, 0x00, 0x00, 0x33, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21,
-    0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x00, 0x01,
-    0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x25,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x03, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x01,
-    0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x37, 0x11, 0x21, 0x15, 0x21, 0x11, 0x80,
-    0x02, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x01, 0x15, 0x21, 0x35, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x37, 0x23, 0x35,
-    0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x01, 0x15, 0x21, 0x35,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x03, 0x15, 0x21, 0x35, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15,
-    0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x02,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x03, 0x15, 0x21, 0x35, 0x01, 0x00, 0xff, 0x00, 0x03,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00,
-    0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x03, 0x15, 0x21, 0x35, 0x01, 0x80, 0xff, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x13, 0x15, 0x21, 0x35, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x13, 0x15, 0x21, 0x35, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21,
-    0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80,
-    0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01,
-    0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0xfd,
-    0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35,
-    0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x35, 0x21, 0x15, 0x33, 0x35,
-    0x21, 0x15, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33, 0x35, 0x21,
-    0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x03, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21,
-    0x15, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x01, 0x35, 0x21,
-    0x15, 0x33, 0x35, 0x21, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfd, 0x00, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35,
-    0x21, 0x15, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x35, 0x21,
-    0x15, 0x33, 0x35, 0x21, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00,
-    0xfd, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x15, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x33,
-    0x35, 0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01,
-    0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe,
-    0x80, 0x01, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x21, 0x11, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x35, 0x21,
-    0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00,
-    0x13, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33,
-    0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35,
-    0x21, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x03, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x35,
-    0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x11, 0x25, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x01, 0x35, 0x21, 0x15, 0x33,
-    0x35, 0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80,
-    0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x01, 0x33, 0x35, 0x23, 0x01, 0x23,
-    0x15, 0x33, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x33, 0x11,
-    0x23, 0x03, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0xfd,
-    0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x01, 0x33, 0x35, 0x23, 0x21,
-    0x23, 0x11, 0x33, 0x2b, 0x01, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x02, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01,
-    0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x23, 0x11, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x31,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x33, 0x15,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21, 0x11, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x07, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x35, 0x21, 0x11, 0x33, 0x35, 0x1d, 0x01, 0x23, 0x15,
-    0x21, 0x11, 0x23, 0x15, 0x01, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x02, 0x00, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x35, 0x21, 0x11, 0x33, 0x35, 0x1d, 0x01, 0x21, 0x11, 0x23, 0x15, 0x05, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x02, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x33, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xfe, 0x80, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00,
-    0x00, 0x01, 0x35, 0x33, 0x15, 0x03, 0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x33, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x02, 0x01,
-    0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00,
-    0x21, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x03, 0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x05, 0x33, 0x11,
-    0x21, 0x11, 0x33, 0x35, 0x33, 0x15, 0x23, 0x05, 0x33, 0x11, 0x21, 0x11, 0x33, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
-    0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x15, 0x23, 0x11, 0x21, 0x11, 0x03,
-    0x35, 0x33, 0x15, 0x01, 0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00,
-    0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35,
-    0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x01,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03,
-    0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00,
-    0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x2b, 0x01, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x23, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35,
-    0x23, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x35, 0x11, 0x21, 0x11, 0x02, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x21, 0x15, 0x11, 0x21, 0x11, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x21, 0x19, 0x01, 0x21, 0x35, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe,
-    0x80, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x80, 0x02,
-    0x00, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80,
-    0x03, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x01, 0x35, 0x33, 0x15, 0x03,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x03, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00,
-    0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x01, 0x35, 0x33, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02,
-    0x00, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x35,
-    0x33, 0x15, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x00, 0x33, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x11, 0x13, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x11,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02,
-    0x80, 0xfd, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x21, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15,
-    0x21, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x21,
-    0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
-    0x02, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x15, 0x33, 0x35, 0x25, 0x21, 0x11,
-    0x21, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x15, 0x13, 0x33, 0x35, 0x23, 0x01, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x33, 0x35, 0x33, 0x11, 0x21, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x13, 0x33,
-    0x35, 0x23, 0x05, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x11,
-    0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x23, 0x15, 0x33, 0x01, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x11, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x11, 0x23, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00,
-    0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x15, 0x33, 0x01, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x02,
-    0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00,
-    0x01, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x01, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe,
-    0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35,
-    0x23, 0x35, 0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x21, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x01, 0x80, 0x02, 0x00, 0x02, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x23, 0x11, 0x33,
-    0x01, 0x23, 0x11, 0x33, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x25, 0x33, 0x35, 0x21,
-    0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11,
-    0x21, 0x15, 0x21, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe,
-    0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x25, 0x21, 0x11, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x03, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00,
-    0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x31, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x00, 0xfd, 0x00,
-    0x00, 0x01, 0x01, 0x80, 0x01, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x02,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x11, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x00, 0x00, 0x06, 0x00, 0x80, 0x00, 0x80, 0x03,
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x25, 0x23,
-    0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x21, 0x11, 0x21, 0x03, 0x35, 0x23, 0x15, 0x01,
-    0x23, 0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x01,
-    0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x37, 0x23, 0x35, 0x33, 0x01, 0x35, 0x21, 0x15, 0x37, 0x23, 0x11, 0x33,
-    0x27, 0x15, 0x21, 0x35, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23,
-    0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00,
-    0x01, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x11, 0x13, 0x21, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x25, 0x33, 0x11, 0x23, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x01, 0x33, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x03, 0x80, 0xfe, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b,
-    0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80,
-    0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33,
-    0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x05, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x03, 0x23, 0x35, 0x33, 0x35, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x03, 0x80, 0xfd, 0x00,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35,
-    0x21, 0x01, 0x33, 0x11, 0x23, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11,
-    0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00,
-    0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x25, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x21, 0x15, 0x33,
-    0x15, 0x21, 0x35, 0x21, 0x11, 0x33, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfc,
-    0x80, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01,
-    0x33, 0x11, 0x23, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x21,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x25,
-    0x21, 0x35, 0x21, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x00, 0x01, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x02, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21,
-    0x03, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15,
-    0x01, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b,
-    0x01, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x31, 0x11, 0x21,
-    0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35,
-    0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-    0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x15, 0x00, 0x19, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0xfc, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00,
-    0x11, 0x00, 0x00, 0x01, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01,
-    0x35, 0x33, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33,
-    0x2b, 0x01, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23,
-    0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01,
-    0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11, 0x21, 0x11, 0x21,
-    0x35, 0x23, 0x11, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x11, 0x2b, 0x01, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x11, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01,
-    0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01,
-    0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x11, 0x23, 0x35, 0x33,
-    0x2b, 0x01, 0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x00, 0x01, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-    0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35,
-    0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01,
-    0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33,
-    0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80,
-    0x02, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00,
-    0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00,
-    0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x23,
-    0x35, 0x33, 0x03, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfd, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01,
-    0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80,
-    0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x25, 0x21,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x35,
-    0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x33, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfc, 0x80,
-    0x02, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
-    0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33,
-    0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
-    0x25, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01,
-    0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x21, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00,
-    0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00,
-    0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x2b, 0x01, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x11, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x01, 0x21, 0x35, 0x21, 0x03, 0x11, 0x21, 0x35, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfd, 0x00,
-    0x03, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x02,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x15, 0x33, 0x15, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02,
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x23, 0x35,
-    0x33, 0x11, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x11,
-    0x33, 0x15, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x02, 0x80,
-    0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00,
-    0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfc, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x01,
-    0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd,
-    0x80, 0x02, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35,
-    0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x02,
-    0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21,
-    0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x01, 0x23, 0x35,
-    0x33, 0x03, 0x23, 0x35, 0x33, 0x01, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33,
-    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80,
-    0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37,
-    0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x02, 0x80,
-    0xfc, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x33, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x21, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01,
-    0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x03, 0x23, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13,
-    0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
-    0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x02,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23,
-    0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0xff, 0x00,
-    0x03, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04,
-    0x01, 0x00, 0x02, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x01,
-    0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
-    0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x11, 0x21,
-    0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21,
-    0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33,
-    0x35, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21,
-    0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11, 0x21, 0x11, 0x21, 0x35, 0x23, 0x13, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00,
-    0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0xfe, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21,
-    0x03, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21,
-    0x11, 0x21, 0x11, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35,
-    0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17,
-    0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x01, 0x15, 0x23, 0x35, 0x23,
-    0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x01, 0x35,
-    0x21, 0x15, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x25, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17,
-    0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x31,
-    0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x13, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33,
-    0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00,
-    0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x11, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x13, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x21, 0x03, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x19, 0x01, 0x21,
-    0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x02, 0x00, 0xfd,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80,
-    0xfe, 0x00, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33,
-    0x13, 0x33, 0x11, 0x21, 0x11, 0x21, 0x35, 0x23, 0x03, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02,
-    0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x25, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35,
-    0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x01, 0x33, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33,
-    0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x11, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x21,
-    0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x01, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe,
-    0x00, 0x02, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x11, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x11, 0x13, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x01, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80,
-    0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19,
-    0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x35, 0x23,
-    0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x01, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x13, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x11,
-    0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x11, 0x33, 0x02, 0x80, 0xfd, 0x80,
-    0x03, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x13, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x01, 0x23, 0x11, 0x33, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x11, 0x33, 0x03, 0x80, 0xff, 0x00, 0xfe,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x11, 0x35, 0x21,
-    0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x11, 0x33, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x80, 0x00, 0x00, 0x03, 0x80,
-    0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x31, 0x23, 0x35, 0x33, 0x03, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x15, 0x23,
-    0x35, 0x03, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x19, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x27, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x23, 0x03, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x03,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x23, 0x02, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x23, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x11, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x15, 0x23, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01,
-    0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02,
-    0x00, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x13,
-    0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x23, 0x15, 0x23, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21,
-    0x13, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x03, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x21, 0x11, 0x21, 0x13, 0x15, 0x23, 0x35, 0x27, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x23, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00,
-    0x1f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21,
-    0x03, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x02, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35,
-    0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80,
-    0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x23, 0x11, 0x21, 0x15, 0x21, 0x01, 0x15, 0x23, 0x35, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x02, 0x00, 0xfd, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00,
-    0x00, 0x11, 0x35, 0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x01, 0x35, 0x33, 0x15, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x33, 0x35, 0x21,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x00, 0x31, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x11, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x01, 0x15, 0x33, 0x35, 0x25, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0xfe, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x15, 0x33, 0x35, 0x25, 0x21, 0x11,
-    0x21, 0x03, 0x23, 0x11, 0x33, 0x11, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x21, 0x00, 0x00, 0x13,
-    0x23, 0x11, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x21, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0xff, 0x00, 0xff, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00,
-    0x25, 0x35, 0x21, 0x15, 0x2b, 0x01, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x02,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x11, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x15, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x11, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x01, 0x00, 0x01, 0x80, 0xfe,
-    0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x11, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x15, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x11, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x15, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x29, 0x01, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x21, 0x03, 0x80, 0xfc, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00, 0x00,
-    0x31, 0x11, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x33, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x11, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x02, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x15, 0x33, 0x35, 0x03, 0x00, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x01, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x01, 0x80, 0xff, 0x00, 0x03,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00,
-    0x00, 0x01, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x23, 0x35, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x13,
-    0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x21, 0x33, 0x15, 0x23,
-    0x11, 0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x23, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x01, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35,
-    0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0xfd,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15,
-    0x21, 0x11, 0x23, 0x35, 0x21, 0x33, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x23, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21,
-    0x13, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x02,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02,
-    0x00, 0xfe, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x11, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x21, 0x33, 0x15, 0x23, 0x11, 0x33, 0x35,
-    0x33, 0x11, 0x23, 0x35, 0x23, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x33, 0x15,
-    0x21, 0x11, 0x21, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x21, 0x15, 0x21, 0x35,
-    0x21, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x15, 0x02, 0x80, 0x01, 0x00, 0xfd,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x11, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x33, 0x15, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfc, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x21, 0x11, 0x33, 0x11, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x11, 0x33, 0x11, 0x03, 0x00, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02,
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x02, 0x00,
-    0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x25, 0x21,
-    0x35, 0x21, 0x01, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x11,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80,
-    0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00,
-    0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x02, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19,
-    0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfc, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00,
-    0x25, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0x01,
-    0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00,
-    0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33,
-    0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21,
-    0x03, 0x35, 0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x35, 0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0xfd, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03,
-    0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0b, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x35,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x35, 0x03, 0x00,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x03,
-    0x00, 0xfd, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x11,
-    0x00, 0x00, 0x01, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23,
-    0x35, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x23,
-    0x35, 0x33, 0x80, 0x03, 0x00, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00,
-    0x31, 0x35, 0x21, 0x35, 0x33, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x01, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21,
-    0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x11,
-    0x21, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15,
-    0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x02,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23,
-    0x35, 0x33, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x25, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0xfc, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x19, 0x01, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x01, 0x33, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x01, 0x23,
-    0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x80, 0xfd, 0x80,
-    0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35,
-    0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x01,
-    0x23, 0x35, 0x33, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x23,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23,
-    0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33,
-    0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x23, 0x35, 0x33, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21,
-    0x15, 0x23, 0x15, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35,
-    0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80,
-    0x02, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x33,
-    0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21,
-    0x15, 0x2b, 0x01, 0x35, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x01, 0x23, 0x35, 0x33,
-    0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21,
-    0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00,
-    0x00, 0x01, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x13, 0x23, 0x35, 0x33, 0x01, 0x80, 0x02, 0x00,
-    0xfd, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xfe,
-    0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11,
-    0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00,
-    0x02, 0x00, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33,
-    0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfd,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35,
-    0x33, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x15, 0x07, 0x15, 0x21, 0x35,
-    0x01, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x01, 0x15, 0x21, 0x35, 0x01, 0x80, 0x02, 0x00, 0xfd, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x13, 0x33, 0x11, 0x21,
-    0x11, 0x21, 0x35, 0x23, 0x01, 0x15, 0x21, 0x35, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x05, 0x15, 0x21, 0x35, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x00,
-    0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80,
-    0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x25, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00,
-    0x09, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21,
-    0x15, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x03, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21,
-    0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x03, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x27, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x01, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00,
-    0x01, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15,
-    0x21, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03,
-    0x00, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x35,
-    0x23, 0x11, 0x23, 0x11, 0x23, 0x15, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x21,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x03, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x35, 0x33, 0x11, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x25, 0x23,
-    0x35, 0x33, 0x13, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x01, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x15, 0x23, 0x35, 0x25, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x01, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x33, 0x15, 0x01, 0x15, 0x23, 0x35, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x17, 0x15, 0x21, 0x35, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x04,
-    0x00, 0x04, 0x00, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x37, 0x11, 0x21, 0x11, 0x80, 0x02, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00,
-    0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x37, 0x11, 0x21, 0x11, 0x25, 0x21, 0x11, 0x21,
-    0x80, 0x02, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x23, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x23, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x25, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x11, 0x15, 0x21, 0x35, 0x03, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x01, 0x33, 0x35, 0x23, 0x05, 0x33, 0x35, 0x23, 0x11, 0x21, 0x35, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x21, 0x23, 0x11, 0x33, 0x05, 0x23,
-    0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x11, 0x33, 0x03,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x21, 0x35, 0x21, 0x05, 0x21, 0x35, 0x21, 0x13, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0xfd, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x11, 0x23, 0x25, 0x23,
-    0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x25, 0x00,
-    0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x33,
-    0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33,
-    0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfd, 0x00, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x01, 0x11, 0x21, 0x11, 0x01,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x21, 0x11,
-    0x21, 0x11, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03,
-    0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00,
-    0x25, 0x35, 0x33, 0x11, 0x23, 0x35, 0x23, 0x11, 0x01, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x11, 0x23, 0x35, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21,
-    0x01, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02,
-    0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00,
-    0x0d, 0x00, 0x13, 0x00, 0x00, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x23, 0x35, 0x33,
-    0x35, 0x23, 0x35, 0x21, 0x11, 0x23, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x37, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x11, 0x21, 0x35, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0xfc, 0x80,
-    0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x0b, 0x00, 0x00, 0x37, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x80, 0x02, 0x80,
-    0x80, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x15,
-    0x00, 0x00, 0x01, 0x15, 0x23, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x15, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x23, 0x03, 0x00, 0xfe,
-    0x00, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x01,
-    0x00, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x00, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00,
-    0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x23, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x33, 0x35, 0x21, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x03, 0x00,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x21, 0x35, 0x21, 0x01, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x03, 0x35, 0x21,
-    0x15, 0x13, 0x35, 0x33, 0x15, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x25, 0x21, 0x11,
-    0x21, 0x13, 0x35, 0x33, 0x15, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x03, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x25, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x01,
-    0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x35, 0x33,
-    0x15, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x13, 0x35, 0x33, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x11, 0x13, 0x35, 0x33, 0x15, 0x01, 0x00, 0x02, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11,
-    0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x13,
-    0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x15, 0x33, 0x11, 0x21, 0x11,
-    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x25, 0x35, 0x33, 0x15, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x11, 0x25, 0x35, 0x33, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01,
-    0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x13, 0x35, 0x33, 0x15, 0x02, 0x80,
-    0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x11, 0x25, 0x35, 0x33, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x25, 0x35, 0x33, 0x15, 0x03, 0x00, 0xfe,
-    0x00, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11,
-    0x13, 0x35, 0x33, 0x15, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x13, 0x35, 0x33,
-    0x15, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x01, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x25, 0x21, 0x11, 0x21, 0x03, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe,
-    0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01,
-    0x21, 0x11, 0x21, 0x01, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x03, 0x11, 0x21, 0x11,
-    0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x02, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x15, 0x21, 0x11, 0x03, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x80, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x25,
-    0x11, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x11, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00,
-    0x31, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe,
-    0x00, 0x02, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x29, 0x01,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x29, 0x01, 0x23, 0x35,
-    0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x33, 0x11, 0x33, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x03, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0xfe,
-    0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x00, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x80, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80,
-    0x80, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x1d, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x25, 0x33, 0x11,
-    0x23, 0x01, 0x33, 0x11, 0x23, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x23, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21,
-    0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35,
-    0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x00, 0x35, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x35, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x02, 0x00, 0xfe,
-    0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x03, 0x00, 0xfd, 0x00, 0x03, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x35, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x21, 0x11, 0x21, 0x35, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x03, 0x00,
-    0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x11, 0x01, 0x21, 0x11, 0x21, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x21,
-    0x11, 0x21, 0x11, 0x01, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x01, 0x33, 0x11, 0x23, 0x02, 0x80,
-    0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80,
-    0x03, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x25, 0x21, 0x11, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0x03, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x33, 0x23, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x01, 0x11, 0x21, 0x11, 0x03,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
-    0x37, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x35,
-    0x21, 0x01, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x03, 0x35, 0x21, 0x15, 0x01, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x05, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11, 0x03, 0x80, 0xfd, 0x80, 0x02,
-    0x80, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03,
-    0x00, 0x0f, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x25, 0x11, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33,
-    0x11, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x03, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x11, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x35,
-    0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x01,
-    0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21,
-    0x35, 0x33, 0x11, 0x33, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11,
-    0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x07, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0x02, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00,
-    0x03, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11,
-    0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15,
-    0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x80, 0x03,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x19, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33,
-    0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x25, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11,
-    0x23, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00,
-    0x35, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x35, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe,
-    0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x35, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11,
-    0x21, 0x35, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x01, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x01, 0x21, 0x35,
-    0x21, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x21, 0x11, 0x33, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x21, 0x01, 0x33, 0x15, 0x23, 0x02, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31,
-    0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x25, 0x21, 0x35, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01,
-    0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x33, 0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x05, 0x33, 0x11, 0x23, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00,
-    0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x1d, 0x01, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15,
-    0x33, 0x35, 0x21, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21,
-    0x15, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x35, 0x21, 0x15,
-    0x33, 0x35, 0x21, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x13, 0x00, 0x00, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35,
-    0x33, 0x11, 0x21, 0x11, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x33, 0x11, 0x21, 0x11, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x37, 0x23,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff,
-    0x00, 0x02, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x11,
-    0x23, 0x11, 0x01, 0x21, 0x11, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x03,
-    0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x03, 0x00, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x35, 0x23, 0x15, 0x01, 0x21,
-    0x11, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x03, 0x00, 0x80, 0xfe, 0x00,
-    0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x11, 0x00, 0x15, 0x00, 0x00, 0x25, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x33, 0x03, 0x11, 0x23, 0x11, 0x03, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00,
-    0x11, 0x00, 0x15, 0x00, 0x00, 0x25, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15, 0x03, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x00, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x33, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00, 0x02,
-    0x00, 0xfd, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x0b, 0x00, 0x00, 0x35, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x00, 0x01,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x33, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35,
-    0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x11, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00,
-    0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x11,
-    0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x29, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b,
-    0x01, 0x35, 0x33, 0x01, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x03, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x35, 0x33, 0x03, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25,
-    0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25,
-    0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15,
-    0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x31,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x80,
-    0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b,
-    0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x21, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x15, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
-    0x25, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x01, 0x80, 0xfd, 0x80, 0x02, 0x00,
-    0xfe, 0x00, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15,
-    0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x01,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x21, 0x23, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x01, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x33, 0x11, 0x23, 0x03, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x03,
-    0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x01,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11, 0x03,
-    0x80, 0xfd, 0x80, 0x03, 0x80, 0x80, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x33, 0x11, 0x25, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x1b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x03, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x03, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00,
-    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00,
-    0x19, 0x01, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x21, 0x35, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x03,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x09, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x21, 0x3d, 0x02, 0x21, 0x15,
-    0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00,
-    0x33, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01,
-    0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21,
-    0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x02,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x1d, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x29, 0x01, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x23, 0x15, 0x21, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23,
-    0x35, 0x23, 0x11, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35,
-    0x21, 0x15, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00,
-    0x13, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37,
-    0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x21,
-    0x11, 0x01, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00,
-    0x00, 0x01, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x11, 0x21, 0x11,
-    0x21, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00,
-    0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00,
-    0x13, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x80, 0x03, 0x00, 0xff,
-    0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x80, 0x03,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80,
-    0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x15, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x25, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03,
-    0x00, 0x17, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x27, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x23,
-    0x00, 0x00, 0x31, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x31,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x23,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x33, 0x15, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02,
-    0x00, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b,
-    0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x33,
-    0x35, 0x21, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02,
-    0x00, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x35, 0x21, 0x15, 0x33,
-    0x35, 0x21, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11,
-    0x21, 0x11, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01,
-    0x23, 0x11, 0x33, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x21, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35,
-    0x33, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23,
-    0x11, 0x33, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x03,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23,
-    0x35, 0x33, 0x35, 0x21, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x01, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x33, 0x35, 0x21, 0x11, 0x23, 0x35, 0x21,
-    0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x11, 0x33, 0x80, 0x01, 0x00, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0xfd, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x25, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37, 0x33, 0x11, 0x23, 0x05, 0x23,
-    0x11, 0x33, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x3b,
-    0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23,
-    0x01, 0x23, 0x11, 0x33, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x21, 0x35, 0x33, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x33, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x13, 0x23, 0x11,
-    0x33, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x11,
-    0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x21, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x35,
-    0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x00,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09,
-    0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x03, 0x00,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00,
-    0x2b, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x33, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
-    0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x02, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0xfd, 0x00,
-    0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x80, 0x03, 0x80, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x25, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x07, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x17, 0x00, 0x00, 0x21, 0x35, 0x21, 0x15, 0x21, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x01, 0x21, 0x11, 0x21,
-    0x01, 0x23, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23, 0x02, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xfd,
-    0x80, 0x01, 0x00, 0xfe, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x33, 0x15, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x02, 0x00,
-    0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00,
-    0x00, 0x01, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x03, 0x80, 0xfc, 0x80, 0x02, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80,
-    0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x13, 0x23, 0x35,
-    0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11,
-    0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x09, 0x00, 0x00, 0x13, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35,
-    0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01,
-    0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x21, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x35, 0x23,
-    0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x21, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x25, 0x35, 0x21, 0x15, 0x2b,
-    0x01, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00,
-    0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x02, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x33,
-    0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b,
-    0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15,
-    0x21, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x01, 0x33, 0x15, 0x33, 0x11,
-    0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x01, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x03, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
-    0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x35, 0x11, 0x21, 0x11, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
-    0x00, 0x00, 0x01, 0x15, 0x21, 0x3d, 0x02, 0x21, 0x15, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11,
-    0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80,
-    0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01,
-    0x00, 0x02, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x13, 0x23, 0x35,
-    0x33, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x00, 0x01,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x21, 0x35, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x25,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21,
-    0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x03,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x19, 0x00, 0x00, 0x25, 0x23, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x25,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00,
-    0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x21, 0x00, 0x00, 0x25, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x33, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00,
-    0x1d, 0x00, 0x00, 0x25, 0x21, 0x35, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21,
-    0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x25, 0x00, 0x00, 0x25, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
-    0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1d, 0x00,
-    0x00, 0x25, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x33, 0x11, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21,
-    0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x19, 0x00, 0x00, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x02, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x80, 0x02, 0x80, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80,
-    0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11,
-    0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00,
-    0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x15, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23,
-    0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x13,
-    0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x03, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02,
-    0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00,
-    0x03, 0x00, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x02, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00,
-    0x03, 0x00, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x2f, 0x00, 0x00, 0x25, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x05, 0x33, 0x15, 0x21,
-    0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x2f, 0x00,
-    0x00, 0x25, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21,
-    0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x03, 0x80, 0x03, 0x00, 0x80, 0x80,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x01, 0x23, 0x11,
-    0x33, 0x01, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x33,
-    0x11, 0x21, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfc, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x05, 0x00, 0x00, 0x11,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x01, 0x00, 0x02, 0x80, 0xfc, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
-    0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x25, 0x33, 0x11, 0x23, 0x21, 0x23, 0x11, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x25, 0x23, 0x11, 0x33, 0x05, 0x15, 0x21, 0x35, 0x11, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x33,
-    0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x05, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x11, 0x33, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x21, 0x15,
-    0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x13,
-    0x23, 0x11, 0x33, 0x01, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x01,
-    0x35, 0x21, 0x15, 0x01, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x35, 0x23, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x02, 0x80, 0xff, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0xfc, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1f,
-    0x00, 0x00, 0x01, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x02, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x31,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x02, 0x00, 0x01, 0x80,
-    0xfc, 0x80, 0x01, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x35, 0x23, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x33, 0x07,
-    0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11,
-    0x02, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x27, 0x00, 0x00, 0x01,
-    0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x11, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35,
-    0x33, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x23, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33,
-    0x15, 0x33, 0x11, 0x33, 0x15, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x17, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x35, 0x21, 0x11, 0x23, 0x35, 0x02, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x11,
-    0x35, 0x21, 0x15, 0x23, 0x11, 0x21, 0x11, 0x03, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x29,
-    0x01, 0x11, 0x21, 0x01, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfd,
-    0x80, 0x02, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00,
-    0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x03, 0x80, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11,
-    0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x03, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x03, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21,
-    0x11, 0x23, 0x35, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x03,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x35, 0x02, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x02, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00,
-    0x00, 0x31, 0x35, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x23, 0x15, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0f, 0x00, 0x00, 0x01, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11,
-    0x21, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x02, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x15, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x23, 0x11, 0x33, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x80, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x11, 0x23, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x21, 0x35, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11,
-    0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x13, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15, 0x21, 0x35, 0x23,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x03,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1d, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x01,
-    0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x35, 0x01, 0x21, 0x11, 0x21, 0x03, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x35, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x13, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x11, 0x23,
-    0x15, 0x21, 0x35, 0x33, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35,
-    0x21, 0x15, 0x21, 0x15, 0x23, 0x01, 0x00, 0x02, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35,
-    0x05, 0x23, 0x35, 0x33, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x23, 0x35, 0x21, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11,
-    0x21, 0x02, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80,
-    0x02, 0x80, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x00, 0x01, 0x00, 0x03, 0x80, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x11, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x21, 0x11, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15, 0x21, 0x35, 0x23, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21,
-    0x15, 0x33, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x00, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x02, 0x00, 0x01, 0x00,
-    0xfd, 0x80, 0x01, 0x00, 0x03, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00,
-    0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x21, 0x11, 0x33, 0x11, 0x01, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x01, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21,
-    0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x01, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x21, 0x00, 0x00, 0x01, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x33, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15,
-    0x23, 0x15, 0x03, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x03, 0x23, 0x11, 0x33, 0x01,
-    0x23, 0x11, 0x33, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x35, 0x33, 0x11, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x80,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11,
-    0x00, 0x00, 0x11, 0x35, 0x33, 0x11, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x21, 0x11,
-    0x21, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x03, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x15, 0x21, 0x11,
-    0x33, 0x15, 0x25, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x80, 0xfe, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x11, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x01, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x11,
-    0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23,
-    0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x01, 0x00, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x11, 0x00, 0x00, 0x25, 0x23, 0x11, 0x33, 0x01, 0x11, 0x21, 0x11, 0x01, 0x33, 0x11, 0x23, 0x35,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0xfc, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x25, 0x23, 0x11, 0x33, 0x01, 0x15, 0x21, 0x35, 0x03, 0x33, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11, 0x21, 0x11, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0xfd, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfd, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x21, 0x35, 0x21, 0x15, 0x01, 0x35, 0x33, 0x11, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x11, 0x33, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x13,
-    0x23, 0x35, 0x33, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x25, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35,
-    0x33, 0x11, 0x33, 0x15, 0x25, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35,
-    0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00,
-    0x21, 0x35, 0x21, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x13, 0x15, 0x21,
-    0x11, 0x33, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33,
-    0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00,
-    0x2b, 0x00, 0x2f, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23,
-    0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x01, 0x35, 0x21, 0x15, 0x25, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13,
-    0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00,
-    0x21, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x03, 0x15, 0x21, 0x35, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03,
-    0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x21, 0x35,
-    0x21, 0x03, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x23,
-    0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x21, 0x35, 0x21,
-    0x15, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x11, 0x23, 0x25, 0x15,
-    0x21, 0x35, 0x01, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15, 0x21, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x15, 0x01, 0x35, 0x23, 0x35, 0x21, 0x11, 0x01,
-    0x23, 0x11, 0x33, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x00,
-    0x25, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x03, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x23, 0x00, 0x00, 0x13, 0x15, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x23, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00,
-    0x0b, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x25, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11, 0x33,
-    0x01, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x00, 0x02, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x03, 0x15, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x02, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x01, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x23, 0x15, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03,
-    0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03,
-    0x80, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x02, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03,
-    0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03,
-    0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03, 0x15, 0x23, 0x35, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe,
-    0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x11, 0x29, 0x01, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x15, 0x23, 0x35, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00,
-    0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25,
-    0x21, 0x11, 0x29, 0x01, 0x35, 0x33, 0x11, 0x23, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x02,
-    0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x21, 0x11, 0x29, 0x01, 0x35, 0x33, 0x11, 0x23,
-    0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x1b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x35, 0x33, 0x11, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b,
-    0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x23, 0x35, 0x33, 0x01, 0x35, 0x33, 0x11, 0x23, 0x11, 0x23, 0x15, 0x21,
-    0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35, 0x33, 0x15, 0x33, 0x15, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35,
-    0x21, 0x15, 0x33, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x21,
-    0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x13, 0x35, 0x33, 0x15, 0x19, 0x01, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x33, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x21, 0x11, 0x21, 0x13, 0x15, 0x23, 0x35, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x35, 0x33, 0x11, 0x01, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x07, 0x15, 0x23, 0x35, 0x02, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21,
-    0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01,
-    0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02,
-    0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xfe,
-    0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01,
-    0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00,
-    0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01, 0x35, 0x33,
-    0x15, 0x21, 0x23, 0x35, 0x33, 0x07, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23, 0x35, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x01, 0x35, 0x33, 0x15, 0x21, 0x23, 0x35, 0x33, 0x07, 0x15, 0x23, 0x35, 0x21,
-    0x15, 0x23, 0x35, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b,
-    0x00, 0x11, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35,
-    0x23, 0x35, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x23, 0x35, 0x21, 0x11, 0x23, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0xff, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x00,
-    0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x15, 0x03, 0x23, 0x35, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x01, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x01, 0x23, 0x35, 0x21, 0x11, 0x23, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfc, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09,
-    0x00, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x01, 0x23, 0x35, 0x21, 0x11,
-    0x23, 0x02, 0x80, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11,
-    0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00,
-    0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33,
-    0x25, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x25, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x25, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23,
-    0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f,
-    0x00, 0x43, 0x00, 0x47, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x63, 0x00,
-    0x67, 0x00, 0x6b, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7b, 0x00, 0x7f, 0x00, 0x00, 0x33, 0x23, 0x35, 0x33,
-    0x21, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23,
-    0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x23,
-    0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1b, 0x00,
-    0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00, 0x11, 0x33, 0x11, 0x33, 0x11, 0x23, 0x35, 0x23, 0x01, 0x35, 0x33, 0x11,
-    0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0x13, 0x15, 0x23,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-    0x13, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x21, 0x01, 0x21, 0x35, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x03, 0x00, 0xfc, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1f,
-    0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x05, 0x33, 0x35, 0x23, 0x13, 0x23, 0x15, 0x33, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21,
-    0x35, 0x21, 0x35, 0x21, 0x35, 0x80, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x15, 0x00, 0x19,
-    0x00, 0x00, 0x13, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x35, 0x25, 0x15, 0x33, 0x35, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x23, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23,
-    0x35, 0x33, 0x05, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x35, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11,
-    0x23, 0x35, 0x01, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x23,
-    0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21,
-    0x11, 0x33, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x23, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x01, 0x11, 0x33, 0x11, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35,
-    0x23, 0x11, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x00,
-    0x13, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11,
-    0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x13, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x21, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x23,
-    0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x02, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x00, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x23,
-    0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x11, 0x00, 0x00, 0x01, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x21, 0x35, 0x21, 0x25, 0x23, 0x35, 0x33, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x21, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x21, 0x11, 0x21, 0x15, 0x23, 0x02, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x21, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x01, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x11, 0x21, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x15, 0x33,
-    0x02, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x19,
-    0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35,
-    0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80,
-    0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15,
-    0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x19, 0x00, 0x00, 0x21, 0x23, 0x35, 0x23, 0x11,
-    0x33, 0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x23,
-    0x35, 0x21, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x02, 0x00, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23, 0x35, 0x23,
-    0x35, 0x21, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff,
-    0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23,
-    0x35, 0x23, 0x35, 0x21, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01, 0x11, 0x21, 0x15, 0x23, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x25, 0x00, 0x29, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x21, 0x11, 0x33,
-    0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x25, 0x23, 0x35, 0x33, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01, 0x23,
-    0x35, 0x23, 0x35, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x15,
-    0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x03,
-    0x23, 0x35, 0x23, 0x35, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00,
-    0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x80,
-    0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
-    0x21, 0x35, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x33, 0x15, 0x21, 0x11, 0x23,
-    0x11, 0x03, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x01, 0x23,
-    0x11, 0x33, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x02, 0x00, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x00, 0x35, 0x11,
-    0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x11, 0x21, 0x15, 0x23, 0x15, 0x03, 0x00, 0x80, 0xff, 0x00,
-    0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x21, 0x00, 0x00, 0x01,
-    0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21,
-    0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x23, 0x35, 0x21, 0x02, 0x00, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x21, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x15, 0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00,
-    0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23,
-    0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01,
-    0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x25, 0x35, 0x33, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00,
-    0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x25,
-    0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x01, 0x35, 0x33, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x01,
-    0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x35, 0x11, 0x21,
-    0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x13, 0x23, 0x35, 0x23, 0x35, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23,
-    0x35, 0x33, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00,
-    0x00, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21,
-    0x01, 0x80, 0x02, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x03,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x13,
-    0x11, 0x21, 0x15, 0x23, 0x15, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x09, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x03, 0x11, 0x21, 0x15, 0x23, 0x15, 0x21, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x00, 0x80, 0xff,
-    0x00, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe,
-    0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x01, 0x11, 0x21, 0x15, 0x23, 0x15, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0f,
-    0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x03,
-    0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x01, 0x23,
-    0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x00, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15,
-    0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15,
-    0x11, 0x21, 0x11, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x19, 0x01,
-    0x21, 0x35, 0x21, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x00, 0x31, 0x11, 0x21, 0x15, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11,
-    0x01, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x31, 0x11,
-    0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x27, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x15, 0x23, 0x35, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x05, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x33,
-    0x11, 0x23, 0x27, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x35, 0x23,
-    0x11, 0x33, 0x35, 0x05, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x37, 0x23, 0x11,
-    0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23,
-    0x11, 0x33, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x21, 0x25,
-    0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x21, 0x35, 0x33, 0x11, 0x21, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x02,
-    0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x01,
-    0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x21, 0x25, 0x23, 0x11, 0x33, 0x01, 0x23, 0x35, 0x21, 0x35, 0x33, 0x11, 0x21,
-    0x03, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x03, 0x00, 0xfd, 0x00, 0x02, 0x80, 0xfe,
-    0x80, 0x01, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x29, 0x01, 0x11, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x29, 0x01,
-    0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x80, 0xff, 0x00, 0xfe,
-    0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00,
-    0x00, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x00,
-    0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x13, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x23, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x13,
-    0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x05, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x15, 0x23, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x17, 0x00, 0x00, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00,
-    0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x11, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x25, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x11, 0x21,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00,
-    0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x01, 0x11, 0x21, 0x15, 0x23, 0x15, 0x21, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x35, 0x33, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x21, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x03, 0x15, 0x21,
-    0x35, 0x23, 0x11, 0x21, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x01, 0x80,
-    0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x00, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x02,
-    0x00, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01,
-    0x15, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x80, 0xfd, 0x80,
-    0x02, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x02, 0x00, 0x80, 0xff, 0x00, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x21, 0x11,
-    0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0xfd, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x25, 0x15,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x05, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x21,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x02, 0x80,
-    0x80, 0xfc, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x1b, 0x00, 0x23, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x25, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x35, 0x01, 0x23,
-    0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x35, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x15, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x01, 0x15,
-    0x23, 0x11, 0x33, 0x11, 0x33, 0x15, 0x01, 0x35, 0x33, 0x11, 0x23, 0x11, 0x23, 0x35, 0x01, 0x23, 0x35, 0x33, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfd,
-    0x80, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17,
-    0x00, 0x00, 0x19, 0x01, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21,
-    0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x00, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x80, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00,
-    0x0f, 0x00, 0x2d, 0x00, 0x00, 0x33, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x01, 0x33, 0x35, 0x23, 0x03, 0x33,
-    0x35, 0x23, 0x07, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x21, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00,
-    0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x05, 0x23, 0x35,
-    0x33, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x13, 0x15, 0x23, 0x11, 0x21, 0x11, 0x21, 0x15,
-    0x23, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80,
-    0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x29, 0x01, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x35, 0x23, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
-    0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01,
-    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x01,
-    0x15, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35,
-    0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,
-    0x80, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x15, 0x11, 0x21, 0x35, 0x29,
-    0x01, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x02, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x01, 0x23, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x33, 0x35, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x0b, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x21, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x23,
-    0x35, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x01, 0x23, 0x11, 0x3b, 0x01, 0x23, 0x35,
-    0x33, 0x01, 0x23, 0x11, 0x33, 0x02, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33,
-    0x01, 0x35, 0x21, 0x15, 0x01, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x05,
-    0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x35, 0x11, 0x21, 0x11, 0x03, 0x23,
-    0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x0d, 0x00, 0x00, 0x37, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x21,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x02,
-    0x80, 0x80, 0xfd, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00,
-    0x31, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x80,
-    0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00,
-    0x13, 0x23, 0x11, 0x3b, 0x01, 0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x80, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03,
-    0x00, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23,
-    0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfd, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x29, 0x01,
-    0x11, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x03,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x03, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x25, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x33,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x13, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x23, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x33, 0x11, 0x23, 0x11, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x33,
-    0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00, 0x01,
-    0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x33, 0x15, 0x21,
-    0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x03, 0x80, 0xfc, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x03, 0x80,
-    0x03, 0x80, 0xfc, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x13,
-    0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0f,
-    0x00, 0x00, 0x29, 0x01, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x03,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x33, 0x11, 0x21,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x35, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11,
-    0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x03, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x15, 0x23, 0x11, 0x33,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x05, 0x23, 0x11, 0x33,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x00, 0x21, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x01, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x27, 0x00, 0x00,
-    0x37, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x23,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x11, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x05, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80,
-    0x03, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00,
-    0x13, 0x00, 0x00, 0x21, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33,
-    0x01, 0x23, 0x35, 0x33, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00,
-    0x00, 0x13, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x25, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23, 0x11, 0x23, 0x15, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0xff,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x21,
-    0x23, 0x35, 0x33, 0x21, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x01, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x80,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x03, 0x33, 0x11, 0x23, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x11, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x21,
-    0x33, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x01, 0x23,
-    0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfd, 0x00, 0x01, 0x80, 0xff, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe,
-    0x80, 0x03, 0x00, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35,
-    0x23, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11,
-    0x13, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x13, 0x23, 0x11,
-    0x33, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x25, 0x21, 0x11, 0x21, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x01, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x33, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x03, 0x21, 0x11, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x31, 0x35, 0x21, 0x15, 0x13, 0x23, 0x11, 0x33, 0x01,
-    0x15, 0x21, 0x35, 0x05, 0x23, 0x35, 0x33, 0x13, 0x21, 0x35, 0x33, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33,
-    0x27, 0x15, 0x21, 0x35, 0x11, 0x23, 0x11, 0x33, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x33, 0x15, 0x07, 0x33, 0x15,
-    0x21, 0x11, 0x33, 0x17, 0x35, 0x33, 0x15, 0x03, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x00, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x11,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35,
-    0x05, 0x33, 0x15, 0x23, 0x25, 0x33, 0x15, 0x23, 0x80, 0x02, 0x80, 0x80, 0xfc, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x11, 0x33, 0x11, 0x21,
-    0x11, 0x33, 0x11, 0x21, 0x01, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x25, 0x23, 0x35,
-    0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x02, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x01, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x03, 0x11, 0x21, 0x15, 0x23, 0x11, 0x21, 0x35, 0x33, 0x11, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80,
-    0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0xfd, 0x00, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfd, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x03, 0x15, 0x21, 0x35, 0x03, 0x80, 0x80,
-    0xfe, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21,
-    0x11, 0x23, 0x15, 0x11, 0x15, 0x21, 0x35, 0x01, 0x15, 0x23, 0x11, 0x21, 0x15, 0x21, 0x15, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x19, 0x00, 0x00, 0x11, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x35, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x01, 0x11, 0x21, 0x11, 0x25, 0x21, 0x11,
-    0x23, 0x35, 0x21, 0x15, 0x23, 0x05, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00,
-    0x03, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0xfe, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00,
-    0x27, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x21, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35,
-    0x33, 0x11, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01,
-    0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x15, 0x03, 0x33, 0x35, 0x23, 0x03, 0x33,
-    0x35, 0x23, 0x05, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x00, 0x13, 0x15, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x23, 0x11, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x80,
-    0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35,
-    0x33, 0x25, 0x23, 0x11, 0x33, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x25, 0x11, 0x33, 0x11, 0x02, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x25, 0x23, 0x35, 0x33, 0x03, 0x35, 0x33, 0x15, 0x05, 0x35,
-    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x11, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x13,
-    0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00,
-    0x80, 0xff, 0x00, 0x80, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x09, 0x00, 0x0d, 0x00,
-    0x00, 0x01, 0x33, 0x15, 0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00,
-    0x01, 0x15, 0x21, 0x35, 0x03, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x33, 0x15,
-    0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x25, 0x35, 0x21, 0x15, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00,
-    0x17, 0x00, 0x00, 0x33, 0x35, 0x21, 0x15, 0x25, 0x23, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x11, 0x21, 0x01, 0x23, 0x11, 0x33, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x02, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x00, 0x31, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x25, 0x33, 0x15, 0x21, 0x11, 0x33,
-    0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x03, 0x00, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x23, 0x11, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x11, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23,
-    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x01,
-    0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00,
-    0x00, 0x13, 0x23, 0x35, 0x33, 0x01, 0x23, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x01, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01,
-    0x00, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x03,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x15, 0x23, 0x35, 0x01, 0x33,
-    0x11, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x01, 0x35, 0x21, 0x15, 0x80,
-    0x80, 0x02, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfd, 0x80,
-    0x80, 0x80, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00,
-    0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x00, 0x25, 0x23, 0x35, 0x33, 0x01, 0x35, 0x33, 0x15,
-    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33,
-    0x15, 0x03, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35,
-    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x11, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x13,
-    0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00, 0x80, 0xfe, 0x00, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x00, 0x11, 0x33,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x11, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x01, 0x80, 0x01, 0x00, 0xfe, 0x80, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x15, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x03, 0x00, 0x80,
-    0xfe, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x21, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x03, 0x23, 0x35, 0x33,
-    0x05, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x01,
-    0x15, 0x33, 0x35, 0x27, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x23, 0x01, 0x21, 0x11, 0x21, 0x01, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0xfc, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00,
-    0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x03, 0x35,
-    0x33, 0x1d, 0x01, 0x35, 0x33, 0x15, 0x13, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01,
-    0x35, 0x33, 0x15, 0x13, 0x35, 0x33, 0x15, 0x3d, 0x01, 0x33, 0x1d, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
-    0x03, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x1d, 0x01, 0x35, 0x33,
-    0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x23, 0x00, 0x00, 0x01, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35,
-    0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23,
-    0x15, 0x23, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x01, 0x80, 0xfe,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x80, 0xfc, 0x80, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x27, 0x00, 0x00, 0x01,
-    0x23, 0x15, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33,
-    0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01,
-    0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0x03, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x31, 0x35, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x02, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x03,
-    0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x31, 0x35, 0x21,
-    0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00,
-    0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
-    0x80, 0x03, 0x00, 0xfd, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00,
-    0x11, 0x35, 0x33, 0x11, 0x21, 0x15, 0x23, 0x11, 0x21, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23, 0x11,
-    0x23, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80,
-    0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x21, 0x35, 0x33, 0x15, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35,
-    0x21, 0x11, 0x21, 0x01, 0x21, 0x11, 0x21, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x80, 0x80, 0xfd, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x35, 0x33, 0x15, 0x11, 0x35, 0x21, 0x15, 0x01,
-    0x23, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x23, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
-    0x25, 0x35, 0x33, 0x15, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80,
-    0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x19, 0x01, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x11, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b,
-    0x00, 0x00, 0x13, 0x15, 0x23, 0x35, 0x17, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x21, 0x15, 0x21, 0x11, 0x23, 0x15, 0x21, 0x11, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x33, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x21, 0x35, 0x21, 0x11, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x25, 0x11, 0x21, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21,
-    0x11, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x01,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00,
-    0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x03, 0x23, 0x11, 0x33, 0x01, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21,
-    0x35, 0x33, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x01, 0x15, 0x33, 0x35, 0x11, 0x15, 0x21, 0x35,
-    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0xfe, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x37, 0x21,
-    0x11, 0x21, 0x27, 0x21, 0x11, 0x21, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfc, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x21, 0x11, 0x21, 0x27, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x3b, 0x01,
-    0x23, 0x11, 0x33, 0x01, 0x35, 0x33, 0x15, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x37, 0x21, 0x11, 0x21, 0x27,
-    0x21, 0x11, 0x21, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x11, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33,
-    0x13, 0x23, 0x35, 0x33, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x03, 0x80, 0xfc, 0x80, 0x02, 0x00, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfc, 0x80, 0x02, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x01, 0x23, 0x35, 0x33, 0x05, 0x35, 0x33,
-    0x15, 0x11, 0x23, 0x35, 0x33, 0x05, 0x35, 0x33, 0x15, 0x25, 0x23, 0x11, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x01, 0x33,
-    0x11, 0x23, 0x15, 0x33, 0x11, 0x23, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x37, 0x23, 0x11,
-    0x33, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23,
-    0x11, 0x33, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xfd, 0x80,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfd,
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0xfd, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x00, 0x21, 0x35, 0x33, 0x15, 0x01, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15, 0x01,
-    0x35, 0x33, 0x15, 0x03, 0x11, 0x33, 0x11, 0x02, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfd, 0x80, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x21, 0x35, 0x33, 0x15, 0x01, 0x11, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x11, 0x33, 0x01, 0x00, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00,
-    0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x33,
-    0x35, 0x33, 0x15, 0x01, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15, 0x01, 0x35, 0x33, 0x15,
-    0x01, 0x11, 0x21, 0x11, 0x23, 0x15, 0x23, 0x11, 0x33, 0x11, 0x23, 0x15, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01,
-    0x00, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0xfe, 0x00,
-    0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x11, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x13, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x37,
-    0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x13, 0x35,
-    0x33, 0x15, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01,
-    0x11, 0x21, 0x11, 0x01, 0x35, 0x21, 0x15, 0x33, 0x11, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x11,
-    0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xff, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x25, 0x15,
-    0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x01, 0x11, 0x21, 0x11, 0x01, 0x21, 0x15, 0x33, 0x15,
-    0x21, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0xfd, 0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x01, 0x11, 0x33, 0x35,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21,
-    0x15, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x37, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x37, 0x21, 0x35, 0x21, 0x03, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x1f, 0x00,
-    0x23, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x03, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x15, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x1b, 0x00,
-    0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x03, 0x35, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x15, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01, 0x35,
-    0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00,
-    0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23,
-    0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23,
-    0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x21, 0x25, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x00, 0x02, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21,
-    0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x25, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x01, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x15, 0x00,
-    0x19, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x25, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x02, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x29, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21,
-    0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x25, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xfd, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x19, 0x01, 0x21, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd,
-    0x80, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x19, 0x01, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11,
-    0x21, 0x11, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe,
-    0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x33,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x03, 0x35, 0x21, 0x11,
-    0x23, 0x35, 0x21, 0x11, 0x21, 0x15, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x02, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x80, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x33,
-    0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x11, 0x23, 0x02,
-    0x80, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x25, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x33, 0x11, 0x23, 0x02, 0x80, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15,
-    0x23, 0x11, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x02, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x23,
-    0x11, 0x02, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x09, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x33, 0x11, 0x23, 0x01, 0x00, 0xff, 0x00,
-    0x03, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x33,
-    0x11, 0x23, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x25, 0x21,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00, 0xfd, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x23, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
-    0x00, 0x00, 0x33, 0x35, 0x21, 0x15, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x33, 0x01,
-    0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x15, 0x80, 0x02, 0x00, 0x80,
-    0xfd, 0x80, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfd,
-    0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00,
-    0x33, 0x35, 0x21, 0x15, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11,
-    0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x15, 0x80, 0x02, 0x00, 0x80, 0xfd, 0x80,
-    0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x0f, 0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x23, 0x35, 0x21,
-    0x80, 0x80, 0x02, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00,
-    0x02, 0x80, 0xfd, 0x80, 0xff, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f,
-    0x00, 0x00, 0x13, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x11, 0x23, 0x35, 0x21, 0x80,
-    0x80, 0x02, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01,
-    0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x15, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x15, 0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x11, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00,
-    0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00,
-    0x0d, 0x00, 0x00, 0x29, 0x01, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x01, 0x11, 0x21, 0x11, 0x03, 0x80,
-    0xfd, 0x00, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0xfd,
-    0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x0d,
-    0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x03, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x01, 0x00, 0x01,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x33, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x13, 0x35, 0x33,
-    0x15, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x03, 0x80,
-    0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x25, 0x21, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x02, 0x80, 0x01, 0x00, 0xfe, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00,
-    0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x13, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33,
-    0x35, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x05, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33,
-    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x02, 0x80,
-    0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x02, 0x80, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x05, 0x11,
-    0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x11, 0x33, 0x11, 0x02, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x11, 0x15, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
-    0x11, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x15,
-    0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x11, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x11, 0x23, 0x35, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x15, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
-    0x00, 0x23, 0x00, 0x00, 0x25, 0x23, 0x35, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x21, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x23, 0x15, 0x23, 0x01, 0x35, 0x21, 0x15, 0x13, 0x23, 0x11, 0x33, 0x25, 0x15, 0x21, 0x35, 0x11, 0x23,
-    0x11, 0x33, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0xfe,
-    0x80, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x25, 0x35,
-    0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x03, 0x35, 0x33, 0x15, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0xfd, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11,
-    0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21, 0x11, 0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01,
-    0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x00, 0x01,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x23, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x03, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21,
-    0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x03, 0x33, 0x15, 0x21, 0x35, 0x23,
-    0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x35,
-    0x23, 0x15, 0x23, 0x11, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35,
-    0x23, 0x15, 0x23, 0x35, 0x01, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x13, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x3b,
-    0x01, 0x11, 0x23, 0x01, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x03, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x03, 0x80,
-    0xfe, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x11, 0x21, 0x35, 0x33, 0x15, 0x33, 0x15, 0x31, 0x33, 0x15, 0x23, 0x01, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x15, 0x00, 0x00, 0x01, 0x33, 0x11, 0x21, 0x11, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x33,
-    0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x03, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x15, 0x00, 0x00, 0x01, 0x33, 0x35, 0x2b, 0x02, 0x15, 0x33, 0x17, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00,
-    0x00, 0x01, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35,
-    0x23, 0x11, 0x21, 0x11, 0x33, 0x15, 0x01, 0x23, 0x35, 0x33, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80,
-    0xfe, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff,
-    0x00, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0xfe, 0x80, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23,
-    0x35, 0x21, 0x11, 0x33, 0x15, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xfe,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23,
-    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x37, 0x23,
-    0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x21, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11,
-    0x05, 0x11, 0x33, 0x15, 0x33, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x35, 0x23, 0x35, 0x02, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x23, 0x15, 0x05, 0x11, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x02, 0x80,
-    0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x11, 0x00, 0x00, 0x25, 0x23, 0x11, 0x21, 0x35,
-    0x21, 0x15, 0x21, 0x11, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x80, 0x80, 0xff, 0x00, 0x03,
-    0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00,
-    0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x33, 0x15, 0x03, 0x00, 0xfe,
-    0x80, 0x80, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0xff, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x31, 0x11, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x15, 0x01, 0x33, 0x35, 0x23, 0x01, 0x23, 0x15, 0x33, 0x01, 0x00, 0xff,
-    0x00, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
-    0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35,
-    0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15, 0x23,
-    0x15, 0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23,
-    0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-    0x01, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x31, 0x35, 0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35,
-    0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x15, 0x23, 0x15, 0x01, 0x35, 0x21,
-    0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35,
-    0x21, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15, 0x23,
-    0x15, 0x23, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0d,
-    0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x01, 0x11, 0x23, 0x11, 0x23,
-    0x35, 0x03, 0x15, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x17, 0x23, 0x35, 0x33, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0xfe, 0x00, 0x03, 0x80, 0xff, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x80, 0x80,
-    0x01, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x23, 0x11, 0x33, 0x01, 0x11, 0x21, 0x15,
-    0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x11, 0x01, 0x23, 0x35, 0x33, 0x03,
-    0x15, 0x21, 0x35, 0x03, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x02, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x02, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 0x01,
-    0x21, 0x11, 0x23, 0x11, 0x21, 0x05, 0x23, 0x35, 0x33, 0x03, 0x15, 0x21, 0x35, 0x21, 0x23, 0x11, 0x33, 0x25, 0x33,
-    0x11, 0x23, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x02, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80,
-    0x80, 0xfe, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfe, 0x00, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x01,
-    0x15, 0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35, 0x21, 0x11, 0x23, 0x11,
-    0x21, 0x11, 0x23, 0x11, 0x03, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x03, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00,
-    0x0f, 0x00, 0x13, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x05, 0x11, 0x33, 0x11, 0x21, 0x15, 0x01, 0x11, 0x23, 0x11,
-    0x23, 0x35, 0x11, 0x23, 0x35, 0x33, 0x03, 0x00, 0x80, 0x80, 0xfd, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x00, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x19,
-    0x01, 0x21, 0x11, 0x21, 0x15, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x02, 0x80, 0xfe, 0x00,
-    0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x23, 0x11, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x01, 0x11, 0x23, 0x15, 0x21, 0x35, 0x21, 0x11, 0x01, 0x15, 0x21, 0x35, 0x80, 0x80, 0x01, 0x00,
-    0x01, 0x00, 0xfe, 0x80, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x02, 0x00,
-    0xfe, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21,
-    0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15,
-    0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x29,
-    0x01, 0x35, 0x23, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x03, 0x00, 0xfd, 0x80,
-    0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x00, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x15, 0x21, 0x01, 0x23, 0x35,
-    0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0xfd,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03,
-    0x00, 0x11, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x01, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x00, 0x02, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x01, 0x15, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x01, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x02, 0x00, 0xfd,
-    0x80, 0x02, 0x00, 0xfd, 0x80, 0x80, 0x02, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00,
-    0x00, 0x33, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x80, 0x01, 0x00, 0xff, 0x00, 0x03,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x00, 0xfd, 0x80,
-    0x03, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00,
-    0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x25, 0x15, 0x21,
-    0x35, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x02, 0x80, 0x01, 0x00,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x15,
-    0x23, 0x35, 0x33, 0x25, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x02, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x03, 0x00, 0xfd, 0x80, 0x02, 0x80, 0xfd,
-    0x80, 0x02, 0x80, 0x03, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x01, 0x01, 0x80, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x23, 0x11, 0x33, 0x02, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x13,
-    0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x21, 0x80, 0x80, 0x01, 0x80, 0x80, 0xfd, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x00,
-    0x00, 0x13, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x23, 0x35, 0x21, 0x01, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15,
-    0x33, 0x15, 0x23, 0x11, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x00, 0x01, 0x00, 0xff, 0x00,
-    0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x02, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x80, 0xfd, 0x00, 0x80, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00,
-    0x09, 0x00, 0x15, 0x00, 0x00, 0x13, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x23, 0x35, 0x21, 0x01, 0x35, 0x21, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x00,
-    0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x80, 0xfe, 0x00,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x13, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x01, 0x00, 0x02, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x00, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x21, 0x23, 0x35, 0x33, 0x17, 0x35, 0x33, 0x15, 0x02,
-    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x13,
-    0x35, 0x21, 0x15, 0x80, 0x02, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x03, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00,
-    0x01, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x15, 0x02, 0x00, 0x80, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01, 0x01,
-    0x80, 0x03, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00,
-    0x00, 0x01, 0x15, 0x33, 0x35, 0x25, 0x21, 0x11, 0x21, 0x01, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x03,
-    0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x00, 0x02, 0x00, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00,
-    0x0f, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x21, 0x35, 0x33, 0x35, 0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x02, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
-    0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x80,
-    0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x02,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x07,
-    0x00, 0x0f, 0x00, 0x00, 0x01, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x21, 0x15,
-    0x33, 0x01, 0x80, 0x01, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x07, 0x00, 0x00, 0x21, 0x23, 0x35, 0x3b, 0x01, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21,
-    0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0x02, 0x02, 0x80, 0x00, 0x00, 0x03, 0x80, 0x01, 0x00,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x25, 0x15, 0x23, 0x35, 0x31, 0x23, 0x35, 0x33, 0x03, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x02, 0x80, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x21, 0x11, 0x21, 0x15, 0x23, 0x15, 0x03, 0x11, 0x21, 0x11,
-    0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00,
-    0x01, 0x01, 0x80, 0x01, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x00, 0x21, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00,
-    0x00, 0x21, 0x23, 0x35, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x11, 0x15, 0x23, 0x11, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x11, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x05, 0x23, 0x11, 0x33,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x00,
-    0x01, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x01,
-    0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x29, 0x01, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x33, 0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x15, 0x21, 0x35, 0x23, 0x11, 0x23, 0x35, 0x21, 0x35, 0x23, 0x13, 0x33,
-    0x15, 0x23, 0x01, 0x00, 0x80, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x00,
-    0xfe, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x21, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x23, 0x11, 0x23, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33,
-    0x35, 0x23, 0x35, 0x01, 0x80, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x11, 0x01, 0x35, 0x21, 0x15, 0x03, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0x03, 0x80, 0x02,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x01, 0x23, 0x15,
-    0x33, 0x13, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x33, 0x11, 0x33, 0x35, 0x23, 0x27, 0x35, 0x23, 0x15, 0x25, 0x15, 0x33, 0x35, 0x01, 0x80, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xfd, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x15, 0x00, 0x00, 0x29, 0x01, 0x35, 0x21, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x02, 0x80, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x80,
-    0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0xff, 0x00, 0xff, 0x00,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x13, 0x00, 0x00, 0x25, 0x21, 0x11, 0x21, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x35, 0x21, 0x11, 0x21, 0x35, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80,
-    0x80, 0x01, 0x00, 0xff, 0x00, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00,
-    0x25, 0x21, 0x11, 0x21, 0x01, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x11, 0x21,
-    0x35, 0x01, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0xff,
-    0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x11, 0x21, 0x19,
-    0x01, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x02, 0x80, 0xff,
-    0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02,
-    0x80, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x25, 0x11, 0x21, 0x19, 0x01, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15,
-    0x21, 0x35, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x02, 0x80, 0xff, 0x00, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x31, 0x35, 0x33,
-    0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x21, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80,
-    0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01,
-    0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x33, 0x35, 0x21, 0x15, 0x21, 0x11,
-    0x23, 0x15, 0x21, 0x35, 0x21, 0x01, 0x80, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x03, 0x00,
-    0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x02, 0x00, 0x04, 0x00, 0xfc, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0xfc,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x19, 0x01,
-    0x21, 0x11, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x31, 0x11, 0x21, 0x11, 0x04, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x19, 0x01, 0x21, 0x19, 0x02,
-    0x21, 0x11, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x21, 0x11,
-    0x21, 0x01, 0x21, 0x11, 0x21, 0x04, 0x00, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0xfc, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x29, 0x01, 0x11, 0x21, 0x02, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x11, 0x21, 0x11, 0x02, 0x00, 0x02, 0x00, 0x02,
-    0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x19, 0x01, 0x21, 0x11, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x02,
-    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x04, 0x00, 0xfe, 0x00, 0x02, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0x21, 0x11, 0x21, 0x11, 0x21, 0x02, 0x00, 0xfe, 0x00, 0x04, 0x00, 0xfe, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfc, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x02, 0x00, 0xfe, 0x00, 0x04, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x04, 0x00, 0xfe, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21,
-    0x11, 0x02, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x02,
-    0x00, 0x02, 0x00, 0xfc, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x31, 0x11, 0x33, 0x11, 0x80, 0x04, 0x00, 0xfc, 0x00,
-    0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x21, 0x11, 0x33, 0x11,
-    0x03, 0x80, 0x80, 0x04, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x80, 0x00, 0x03, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x04, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x03, 0x80, 0x04, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x04, 0x00, 0x03, 0x80, 0x80,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x21,
-    0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x02, 0x00, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x80, 0x80, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x33, 0x15, 0x33, 0x11, 0x21, 0x11, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x21, 0x11, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0xff, 0x00, 0x01, 0x00, 0x80, 0x80, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x03, 0x35, 0x21, 0x15, 0x33, 0x11,
-    0x23, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x23,
-    0x15, 0x21, 0x11, 0x02, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff, 0x00, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80,
-    0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x15, 0x23, 0x15,
-    0x33, 0x11, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x02, 0x80, 0xfe, 0x80,
-    0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0xff,
-    0x00, 0x02, 0x00, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x35, 0x11, 0x21, 0x15, 0x33, 0x11, 0x21,
-    0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x03, 0x00, 0x80, 0xfd, 0x00, 0x03, 0x00, 0xfd,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x09, 0x00, 0x00, 0x35,
-    0x11, 0x21, 0x15, 0x33, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x00, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x80, 0x02, 0x00,
-    0x80, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15,
-    0x33, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80,
-    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0xfe, 0x80, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x09, 0x00, 0x00, 0x25, 0x11,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfc, 0x80, 0x01, 0x00, 0x80,
-    0x03, 0x00, 0xfd, 0x00, 0x80, 0x03, 0x80, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-    0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x23, 0x35, 0x33, 0x35, 0x21, 0x15, 0x33, 0x35, 0x21, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x21, 0x11, 0x01, 0x80, 0xff, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xff,
-    0x00, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
-    0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x80,
-    0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x02, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03,
-    0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x11, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x21, 0x11, 0x21, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x33, 0x35, 0x33,
-    0x15, 0x21, 0x23, 0x11, 0x33, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x00, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00,
-    0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x25, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x25, 0x21, 0x11, 0x21, 0x02, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x03, 0x80, 0xfc, 0x80,
-    0x01, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00,
-    0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x35,
-    0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x21, 0x11, 0x21, 0x35, 0x23, 0x11, 0x33, 0x11, 0x01, 0x80, 0x80, 0xff, 0x00,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0xfd, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x23,
-    0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x11, 0x35, 0x33,
-    0x15, 0x17, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x37, 0x15, 0x33, 0x35, 0x01, 0x35, 0x33, 0x15, 0x25,
-    0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x1d, 0x01, 0x35, 0x33, 0x15,
-    0x25, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0xfd,
-    0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00,
-    0x1b, 0x00, 0x00, 0x25, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x33, 0x35,
-    0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x00, 0xfd, 0x80, 0x80, 0x80, 0x02,
-    0x00, 0xfe, 0x80, 0xff, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x01, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x29, 0x01, 0x35, 0x23, 0x11, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x15, 0x33, 0x11, 0x21, 0x15, 0x21, 0x03, 0x80, 0xfd, 0x00, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x03, 0x00,
-    0x80, 0xfd, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x21, 0x11, 0x23, 0x11, 0x23, 0x15, 0x21,
-    0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x25, 0x11, 0x23, 0x11, 0x03, 0x00,
-    0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01, 0x80, 0xff, 0x00, 0x80,
-    0x80, 0x02, 0x80, 0x80, 0x80, 0xff, 0x00, 0x01, 0x80, 0xfc, 0x80, 0x80, 0x02, 0x80, 0xfd, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x21, 0x11, 0x23,
-    0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x25, 0x11,
-    0x23, 0x11, 0x03, 0x00, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x80, 0x01,
-    0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37,
-    0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x37, 0x21, 0x11, 0x21, 0x01, 0x23, 0x35, 0x33,
-    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
-    0x02, 0x80, 0x80, 0x80, 0xfd, 0x80, 0x80, 0x80, 0x02, 0x80, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x23, 0x11, 0x33, 0x35,
-    0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21, 0x01, 0x21, 0x11, 0x21, 0x27, 0x23, 0x35, 0x33, 0x80, 0x80, 0x80, 0x02,
-    0x80, 0x80, 0x80, 0xfd, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
-    0xfe, 0x80, 0x80, 0x02, 0x00, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x96, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x18, 0x00, 0x40, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00,
-    0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x32, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x01,
-    0x04, 0x09, 0x00, 0x04, 0x00, 0x18, 0x00, 0x40, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x08, 0x00,
-    0x0e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x10, 0x00, 0x18, 0x00,
-    0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x58, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c,
-    0x00, 0x22, 0x00, 0x58, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x48, 0x00, 0x7a, 0x00, 0x03, 0x00,
-    0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x64, 0x00, 0xc2, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
-    0x00, 0x61, 0x00, 0x72, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x30, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x47, 0x00,
-    0x42, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x4e, 0x00, 0x65, 0x00, 0x74, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x75, 0x00, 0x62,
-    0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x50, 0x00,
-    0x75, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78, 0x00, 0x65,
-    0x00, 0x6c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
-    0x67, 0x00, 0x67, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x74, 0x00, 0x43,
-    0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00,
-    0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x72,
-    0x00, 0x6f, 0x00, 0x20, 0x00, 0x76, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x20, 0x00, 0x55, 0x00, 0x6e, 0x00,
-    0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
-    0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00,
-    0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x70, 0x00, 0x75, 0x00, 0x62, 0x00,
-    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x2f,
-    0x00, 0x7a, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x27, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc5, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d,
-    0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00,
-    0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-    0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00,
-    0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
-    0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00,
-    0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x13, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x0a,
-    0x00, 0x05, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x12, 0x00,
-    0x20, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x06, 0x00, 0x07,
-    0x00, 0x08, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x21, 0x00, 0x41, 0x00, 0x23, 0x00, 0x61, 0x00, 0xa3, 0x00, 0xa2, 0x00,
-    0xa9, 0x00, 0xaa, 0x00, 0x83, 0x00, 0x8b, 0x00, 0x88, 0x00, 0x84, 0x00, 0xf0, 0x00, 0xb8, 0x00, 0x85, 0x01, 0x02,
-    0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x00, 0xa7, 0x01, 0x08, 0x00, 0x94, 0x00, 0x95, 0x00,
-    0x93, 0x00, 0x97, 0x00, 0xa4, 0x01, 0x09, 0x00, 0xda, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
-    0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x8e, 0x00, 0x62, 0x00,
-    0x6c, 0x00, 0xca, 0x00, 0x73, 0x00, 0xce, 0x00, 0x77, 0x00, 0x67, 0x00, 0x7c, 0x00, 0x68, 0x00, 0x81, 0x00, 0xbb,
-    0x00, 0xba, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xb1, 0x01,
-    0x1a, 0x00, 0x89, 0x00, 0x91, 0x00, 0xa1, 0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x00, 0xb6,
-    0x00, 0xb7, 0x00, 0xc4, 0x01, 0x20, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xc5, 0x01, 0x21, 0x00, 0xef, 0x01, 0x22, 0x00,
-    0xb2, 0x00, 0xb3, 0x01, 0x23, 0x01, 0x24, 0x00, 0x86, 0x00, 0x96, 0x00, 0xe8, 0x00, 0xed, 0x00, 0xee, 0x01, 0x25,
-    0x00, 0xdc, 0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x00, 0xab, 0x01, 0x2a, 0x00, 0x82, 0x00, 0xc2, 0x00,
-    0xdd, 0x00, 0x63, 0x00, 0x6e, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x31,
-    0x00, 0xc3, 0x01, 0x32, 0x01, 0x33, 0x00, 0x87, 0x01, 0x34, 0x00, 0x99, 0x00, 0x9a, 0x01, 0x35, 0x01, 0x36, 0x00,
-    0xbd, 0x00, 0x8a, 0x00, 0xe1, 0x00, 0xff, 0x01, 0x00, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b,
-    0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x00, 0xe4, 0x00, 0xe5, 0x01, 0x41, 0x01, 0x42, 0x00,
-    0xe6, 0x00, 0xe7, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a,
-    0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x00, 0x43, 0x00, 0xad, 0x00, 0x6a, 0x00,
-    0xcb, 0x00, 0x71, 0x00, 0xcf, 0x00, 0x75, 0x00, 0xd3, 0x00, 0x7a, 0x00, 0xd6, 0x00, 0x7f, 0x01, 0x51, 0x01, 0x52,
-    0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x00, 0x8d, 0x00, 0xc9, 0x00, 0x69, 0x00, 0x65, 0x00, 0x70, 0x00,
-    0xcc, 0x00, 0x74, 0x00, 0xd0, 0x00, 0x79, 0x00, 0xd4, 0x00, 0x7e, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xfd, 0x00, 0xfe,
-    0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01,
-    0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69,
-    0x01, 0x6a, 0x01, 0x6b, 0x00, 0xf7, 0x00, 0xd8, 0x00, 0xc7, 0x00, 0x6b, 0x00, 0xc8, 0x00, 0x72, 0x00, 0xcd, 0x00,
-    0x76, 0x00, 0xd1, 0x00, 0x7b, 0x00, 0xd5, 0x00, 0x80, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70,
-    0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01,
-    0x7a, 0x01, 0x7b, 0x00, 0xd9, 0x00, 0xae, 0x00, 0x6d, 0x00, 0x66, 0x00, 0x78, 0x00, 0xaf, 0x00, 0x7d, 0x01, 0x7c,
-    0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x00,
-    0xde, 0x00, 0x64, 0x00, 0x6f, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c,
-    0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0xfb, 0x00, 0xfc, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01,
-    0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x00, 0xe0, 0x01, 0x9c,
-    0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01,
-    0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x00, 0xe2, 0x00, 0xe3, 0x01, 0xaa, 0x00, 0xd7, 0x01, 0xab, 0x01, 0xac,
-    0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01,
-    0xb6, 0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01, 0x01, 0x00, 0xe9, 0x00, 0xea, 0x01, 0xbc,
-    0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x00, 0xdb, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01,
-    0xc5, 0x00, 0xf8, 0x00, 0xf9, 0x01, 0xc6, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc,
-    0x01, 0xcd, 0x01, 0xce, 0x00, 0xa6, 0x01, 0xcf, 0x01, 0xd0, 0x01, 0xd1, 0x01, 0xd2, 0x01, 0xd3, 0x01, 0xd4, 0x01,
-    0xd5, 0x01, 0xd6, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9, 0x01, 0xda, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde,
-    0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01,
-    0xe8, 0x01, 0xe9, 0x01, 0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1,
-    0x01, 0xf2, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf6, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01,
-    0xfb, 0x01, 0xfc, 0x01, 0xfd, 0x01, 0xfe, 0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04,
-    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a, 0x00, 0x8c, 0x00, 0xc6, 0x02, 0x0b, 0x02,
-    0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15,
-    0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02,
-    0x1f, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28,
-    0x02, 0x29, 0x02, 0x2a, 0x02, 0x2b, 0x02, 0x2c, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x30, 0x02, 0x31, 0x02,
-    0x32, 0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3a, 0x02, 0x3b,
-    0x02, 0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x02, 0x3f, 0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43, 0x02, 0x44, 0x02,
-    0x45, 0x02, 0x46, 0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b, 0x02, 0x4c, 0x02, 0x4d, 0x02, 0x4e,
-    0x02, 0x4f, 0x02, 0x50, 0x02, 0x51, 0x02, 0x52, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02,
-    0x58, 0x02, 0x59, 0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x60, 0x02, 0x61,
-    0x02, 0x62, 0x02, 0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6a, 0x02,
-    0x6b, 0x02, 0x6c, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6f, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x73, 0x02, 0x74,
-    0x02, 0x75, 0x02, 0x76, 0x02, 0x77, 0x02, 0x78, 0x02, 0x79, 0x02, 0x7a, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7d, 0x02,
-    0x7e, 0x02, 0x7f, 0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87,
-    0x02, 0x88, 0x02, 0x89, 0x02, 0x8a, 0x02, 0x8b, 0x02, 0x8c, 0x02, 0x8d, 0x02, 0x8e, 0x02, 0x8f, 0x02, 0x90, 0x02,
-    0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95, 0x02, 0x96, 0x02, 0x97, 0x02, 0x98, 0x02, 0x99, 0x02, 0x9a,
-    0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02,
-    0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x00, 0x9b, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac,
-    0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02,
-    0xb6, 0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbc, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf,
-    0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02,
-    0xc9, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xd0, 0x00, 0xa5, 0x00, 0x92,
-    0x02, 0xd1, 0x00, 0x9f, 0x02, 0xd2, 0x02, 0xd3, 0x00, 0x9d, 0x00, 0x9e, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd6, 0x02,
-    0xd7, 0x02, 0xd8, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdc, 0x02, 0xdd, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xe0,
-    0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02,
-    0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xed, 0x02, 0xee, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf2, 0x02, 0xf3,
-    0x02, 0xf4, 0x02, 0xf5, 0x02, 0xf6, 0x00, 0xbc, 0x02, 0xf7, 0x02, 0xf8, 0x00, 0xbe, 0x00, 0xbf, 0x02, 0xf9, 0x02,
-    0xfa, 0x02, 0xfb, 0x02, 0xfc, 0x02, 0xfd, 0x00, 0xa8, 0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02,
-    0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03,
-    0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15,
-    0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03,
-    0x1f, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28,
-    0x03, 0x29, 0x03, 0x2a, 0x03, 0x2b, 0x03, 0x2c, 0x03, 0x2d, 0x03, 0x2e, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x31, 0x03,
-    0x32, 0x03, 0x33, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x37, 0x03, 0x38,
-    0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b, 0x03, 0x3c, 0x00, 0x9c, 0x03, 0x3d, 0x00, 0x98, 0x03, 0x3e, 0x03, 0x3f, 0x00,
-    0xdf, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x03, 0x47, 0x03, 0x48,
-    0x03, 0x49, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03,
-    0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03, 0x5a, 0x03, 0x5b,
-    0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63, 0x00, 0x8f, 0x03,
-    0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d,
-    0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03,
-    0x77, 0x03, 0x78, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7e, 0x03, 0x7f, 0x03, 0x80,
-    0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88, 0x03, 0x89, 0x03,
-    0x8a, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90, 0x03, 0x91, 0x03, 0x92, 0x03, 0x93,
-    0x03, 0x94, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97, 0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03,
-    0x9d, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6,
-    0x03, 0xa7, 0x03, 0xa8, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03,
-    0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xb9,
-    0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc2, 0x03,
-    0xc3, 0x03, 0xc4, 0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca, 0x03, 0xcb, 0x03, 0xcc,
-    0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5, 0x03,
-    0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xde, 0x03, 0xdf,
-    0x03, 0xe0, 0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xe8, 0x03,
-    0xe9, 0x03, 0xea, 0x03, 0xeb, 0x03, 0xec, 0x03, 0xed, 0x03, 0xee, 0x03, 0xef, 0x03, 0xf0, 0x03, 0xf1, 0x03, 0xf2,
-    0x03, 0xf3, 0x03, 0xf4, 0x03, 0xf5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xf8, 0x03, 0xf9, 0x03, 0xfa, 0x03, 0xfb, 0x03,
-    0xfc, 0x03, 0xfd, 0x03, 0xfe, 0x03, 0xff, 0x04, 0x00, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05,
-    0x04, 0x06, 0x04, 0x07, 0x04, 0x08, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e, 0x04,
-    0x0f, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x17, 0x04, 0x18,
-    0x04, 0x19, 0x04, 0x1a, 0x04, 0x1b, 0x04, 0x1c, 0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x21, 0x04,
-    0x22, 0x04, 0x23, 0x04, 0x24, 0x04, 0x25, 0x04, 0x26, 0x04, 0x27, 0x04, 0x28, 0x04, 0x29, 0x04, 0x2a, 0x04, 0x2b,
-    0x04, 0x2c, 0x04, 0x2d, 0x04, 0x2e, 0x04, 0x2f, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32, 0x04, 0x33, 0x04, 0x34, 0x04,
-    0x35, 0x04, 0x36, 0x04, 0x37, 0x04, 0x38, 0x04, 0x39, 0x04, 0x3a, 0x04, 0x3b, 0x04, 0x3c, 0x04, 0x3d, 0x04, 0x3e,
-    0x04, 0x3f, 0x04, 0x40, 0x04, 0x41, 0x04, 0x42, 0x04, 0x43, 0x04, 0x44, 0x04, 0x45, 0x04, 0x46, 0x04, 0x47, 0x04,
-    0x48, 0x04, 0x49, 0x04, 0x4a, 0x04, 0x4b, 0x04, 0x4c, 0x04, 0x4d, 0x04, 0x4e, 0x04, 0x4f, 0x04, 0x50, 0x04, 0x51,
-    0x04, 0x52, 0x04, 0x53, 0x04, 0x54, 0x04, 0x55, 0x04, 0x56, 0x04, 0x57, 0x04, 0x58, 0x04, 0x59, 0x04, 0x5a, 0x04,
-    0x5b, 0x04, 0x5c, 0x04, 0x5d, 0x04, 0x5e, 0x04, 0x5f, 0x04, 0x60, 0x04, 0x61, 0x04, 0x62, 0x04, 0x63, 0x04, 0x64,
-    0x04, 0x65, 0x04, 0x66, 0x04, 0x67, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6a, 0x04, 0x6b, 0x04, 0x6c, 0x04, 0x6d, 0x04,
-    0x6e, 0x04, 0x6f, 0x04, 0x70, 0x04, 0x71, 0x04, 0x72, 0x04, 0x73, 0x04, 0x74, 0x04, 0x75, 0x04, 0x76, 0x04, 0x77,
-    0x04, 0x78, 0x04, 0x79, 0x04, 0x7a, 0x04, 0x7b, 0x04, 0x7c, 0x04, 0x7d, 0x04, 0x7e, 0x04, 0x7f, 0x04, 0x80, 0x04,
-    0x81, 0x04, 0x82, 0x04, 0x83, 0x04, 0x84, 0x04, 0x85, 0x04, 0x86, 0x04, 0x87, 0x04, 0x88, 0x04, 0x89, 0x04, 0x8a,
-    0x04, 0x8b, 0x04, 0x8c, 0x04, 0x8d, 0x04, 0x8e, 0x04, 0x8f, 0x04, 0x90, 0x04, 0x91, 0x04, 0x92, 0x04, 0x93, 0x04,
-    0x94, 0x04, 0x95, 0x04, 0x96, 0x04, 0x97, 0x04, 0x98, 0x04, 0x99, 0x04, 0x9a, 0x04, 0x9b, 0x04, 0x9c, 0x04, 0x9d,
-    0x04, 0x9e, 0x04, 0x9f, 0x04, 0xa0, 0x04, 0xa1, 0x04, 0xa2, 0x04, 0xa3, 0x04, 0xa4, 0x04, 0xa5, 0x04, 0xa6, 0x04,
-    0xa7, 0x04, 0xa8, 0x04, 0xa9, 0x04, 0xaa, 0x04, 0xab, 0x04, 0xac, 0x04, 0xad, 0x04, 0xae, 0x04, 0xaf, 0x04, 0xb0,
-    0x04, 0xb1, 0x04, 0xb2, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0xb5, 0x04, 0xb6, 0x04, 0xb7, 0x04, 0xb8, 0x04, 0xb9, 0x04,
-    0xba, 0x04, 0xbb, 0x04, 0xbc, 0x04, 0xbd, 0x04, 0xbe, 0x04, 0xbf, 0x04, 0xc0, 0x04, 0xc1, 0x04, 0xc2, 0x04, 0xc3,
-    0x04, 0xc4, 0x04, 0xc5, 0x04, 0xc6, 0x04, 0xc7, 0x04, 0xc8, 0x04, 0xc9, 0x04, 0xca, 0x04, 0xcb, 0x04, 0xcc, 0x04,
-    0xcd, 0x04, 0xce, 0x04, 0xcf, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x35, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69,
-    0x32, 0x30, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x30, 0x0b, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61,
-    0x6c, 0x65, 0x6e, 0x63, 0x65, 0x0d, 0x72, 0x65, 0x76, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x6e, 0x6f, 0x74,
-    0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x45, 0x6d,
-    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x49, 0x6d, 0x61, 0x63, 0x72,
-    0x6f, 0x6e, 0x07, 0x69, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x4f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07,
-    0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x55, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6d, 0x61,
-    0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33,
-    0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x37, 0x09, 0x57,
-    0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x44, 0x0d, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x72, 0x65, 0x76, 0x65,
-    0x72, 0x73, 0x65, 0x64, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x46, 0x0a, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65,
-    0x64, 0x61, 0x73, 0x68, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41,
-    0x44, 0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x0a, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a,
-    0x65, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
-    0x6e, 0x74, 0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x09, 0x65, 0x78, 0x63, 0x6c, 0x61,
-    0x6d, 0x64, 0x62, 0x6c, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x36,
-    0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x34, 0x0c, 0x6b,
-    0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69, 0x63, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x30, 0x41, 0x32, 0x09, 0x65, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x07, 0x75, 0x6e, 0x69,
-    0x32, 0x32, 0x31, 0x39, 0x0c, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x06, 0x44,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x06, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6c, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x06, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x52, 0x63,
-    0x61, 0x72, 0x6f, 0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06,
-    0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x31, 0x43, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x44, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x44, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x44, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x44, 0x34, 0x06, 0x47, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x06, 0x67, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x45, 0x38, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
-    0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x39, 0x06,
-    0x57, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x06, 0x79, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x52,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x7a, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35,
-    0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x35, 0x06, 0x57, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x77, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x04, 0x64, 0x6f, 0x6e, 0x67, 0x0b, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
-    0x65, 0x78, 0x0b, 0x63, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x47, 0x63, 0x69, 0x72,
-    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75,
-    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x6a,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x57, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x39, 0x31, 0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x55,
-    0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x37,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x37, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x46, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x37, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31,
-    0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x34, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x35, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x35, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x31, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32,
-    0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x32, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x41,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f,
-    0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x65, 0x6f, 0x67, 0x6f, 0x6e,
-    0x65, 0x6b, 0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07,
-    0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x31, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x45, 0x42, 0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61,
-    0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61,
-    0x75, 0x74, 0x0d, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x75, 0x68,
-    0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0a, 0x49, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63,
-    0x65, 0x6e, 0x74, 0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x05, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x31, 0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x39,
-    0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x39, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x39, 0x36, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x31, 0x38, 0x45, 0x03, 0x45, 0x6e, 0x67, 0x03, 0x65, 0x6e, 0x67, 0x04, 0x48, 0x62, 0x61, 0x72, 0x04, 0x68, 0x62,
-    0x61, 0x72, 0x04, 0x54, 0x62, 0x61, 0x72, 0x04, 0x74, 0x62, 0x61, 0x72, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
-    0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x38, 0x39, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61,
-    0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65,
-    0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x4f, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x75, 0x62,
-    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x38,
-    0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x35, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x39, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x33, 0x0a, 0x43, 0x64, 0x6f, 0x74,
-    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x47,
-    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x36, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x41,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x38, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x37, 0x38, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x37,
-    0x38, 0x43, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42,
-    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x39, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x46, 0x09, 0x61, 0x72, 0x72, 0x6f,
-    0x77, 0x6c, 0x65, 0x66, 0x74, 0x07, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x75, 0x70, 0x0a, 0x61, 0x72, 0x72, 0x6f, 0x77,
-    0x72, 0x69, 0x67, 0x68, 0x74, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x64, 0x6f, 0x77, 0x6e, 0x09, 0x61, 0x72, 0x72,
-    0x6f, 0x77, 0x62, 0x6f, 0x74, 0x68, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x75, 0x70, 0x64, 0x6e, 0x0c, 0x61, 0x72,
-    0x72, 0x6f, 0x77, 0x75, 0x70, 0x64, 0x6e, 0x62, 0x73, 0x65, 0x05, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x09, 0x66, 0x69,
-    0x6c, 0x6c, 0x65, 0x64, 0x62, 0x6f, 0x78, 0x06, 0x48, 0x32, 0x32, 0x30, 0x37, 0x33, 0x06, 0x48, 0x31, 0x38, 0x35,
-    0x33, 0x33, 0x0a, 0x6f, 0x70, 0x65, 0x6e, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x09, 0x73, 0x6d, 0x69, 0x6c, 0x65,
-    0x66, 0x61, 0x63, 0x65, 0x0c, 0x69, 0x6e, 0x76, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x66, 0x61, 0x63, 0x65, 0x03, 0x73,
-    0x75, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x37, 0x0b, 0x6e, 0x61, 0x70,
-    0x6f, 0x73, 0x74, 0x72, 0x6f, 0x70, 0x68, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x44, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x32, 0x37, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31,
-    0x42, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x36, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x39, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x31, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x36, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x32, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x34, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31,
-    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x31, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x31, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x45,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x30, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x32, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x31,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x33, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x38, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x41, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33,
-    0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x34, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x35, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35,
-    0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x35,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x35, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x30, 0x05,
-    0x41, 0x6c, 0x70, 0x68, 0x61, 0x05, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x04, 0x42, 0x65, 0x74, 0x61, 0x04, 0x62, 0x65,
-    0x74, 0x61, 0x05, 0x47, 0x61, 0x6d, 0x6d, 0x61, 0x05, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x33, 0x39, 0x34, 0x05, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x07, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x07, 0x65,
-    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x5a, 0x65, 0x74, 0x61, 0x04, 0x7a, 0x65, 0x74, 0x61, 0x03, 0x45, 0x74,
-    0x61, 0x03, 0x65, 0x74, 0x61, 0x05, 0x54, 0x68, 0x65, 0x74, 0x61, 0x05, 0x74, 0x68, 0x65, 0x74, 0x61, 0x04, 0x49,
-    0x6f, 0x74, 0x61, 0x04, 0x69, 0x6f, 0x74, 0x61, 0x05, 0x4b, 0x61, 0x70, 0x70, 0x61, 0x05, 0x6b, 0x61, 0x70, 0x70,
-    0x61, 0x06, 0x4c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x06, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02, 0x4d, 0x75, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x42, 0x43, 0x02, 0x4e, 0x75, 0x02, 0x6e, 0x75, 0x02, 0x58, 0x69, 0x02, 0x78, 0x69,
-    0x07, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x02, 0x50, 0x69,
-    0x03, 0x52, 0x68, 0x6f, 0x03, 0x72, 0x68, 0x6f, 0x05, 0x53, 0x69, 0x67, 0x6d, 0x61, 0x05, 0x73, 0x69, 0x67, 0x6d,
-    0x61, 0x06, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x03, 0x54, 0x61, 0x75, 0x03, 0x74, 0x61, 0x75, 0x07, 0x55, 0x70,
-    0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x07, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x50, 0x68, 0x69, 0x03, 0x70,
-    0x68, 0x69, 0x03, 0x43, 0x68, 0x69, 0x03, 0x63, 0x68, 0x69, 0x03, 0x50, 0x73, 0x69, 0x03, 0x70, 0x73, 0x69, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x41, 0x39, 0x05, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x0c, 0x49, 0x6f, 0x74, 0x61, 0x64,
-    0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0c, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69,
-    0x73, 0x0f, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f, 0x75,
-    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0a, 0x41, 0x6c, 0x70, 0x68,
-    0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x45,
-    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x45, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x65, 0x74, 0x61, 0x74,
-    0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x49, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x69, 0x6f, 0x74, 0x61,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c,
-    0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f,
-    0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x0a, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f,
-    0x6e, 0x6f, 0x73, 0x11, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e,
-    0x6f, 0x73, 0x14, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74,
-    0x6f, 0x6e, 0x6f, 0x73, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x43,
-    0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x37, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x36, 0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x31, 0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x38, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x44, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x31, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x64,
-    0x62, 0x6c, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x46, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39,
-    0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x42, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x39, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x39, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x41, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x31, 0x05, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0d, 0x64, 0x69,
-    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x61, 0x6e, 0x6f, 0x74, 0x65, 0x6c, 0x65,
-    0x69, 0x61, 0x06, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x32, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37,
-    0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x33, 0x30, 0x30, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x33, 0x30, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x33, 0x45, 0x0a, 0x6f, 0x72, 0x74,
-    0x68, 0x6f, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x05, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x45, 0x04,
-    0x6c, 0x69, 0x72, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x43, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x35, 0x44, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x32,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x34, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x35, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35,
-    0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x35, 0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x35, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x35, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x41,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x35, 0x44, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x44, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35,
-    0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x46, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x35, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x46, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x35, 0x46, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x43,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x46, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x31,
-    0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x32, 0x02, 0x49, 0x4a, 0x02, 0x69, 0x6a, 0x08, 0x6f, 0x6e, 0x65, 0x74,
-    0x68, 0x69, 0x72, 0x64, 0x09, 0x6f, 0x6e, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x09, 0x74, 0x77, 0x6f, 0x74,
-    0x68, 0x69, 0x72, 0x64, 0x73, 0x0c, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0b,
-    0x66, 0x69, 0x76, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0c, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x65, 0x69,
-    0x67, 0x68, 0x74, 0x68, 0x73, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31,
-    0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x44, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x33, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32,
-    0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x46, 0x05, 0x4f, 0x68, 0x6f, 0x72, 0x6e, 0x05, 0x6f, 0x68, 0x6f,
-    0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x31, 0x05, 0x55, 0x68, 0x6f, 0x72, 0x6e, 0x05,
-    0x75, 0x68, 0x6f, 0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46,
-    0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x43, 0x33, 0x07, 0x6c, 0x74, 0x73, 0x68,
-    0x61, 0x64, 0x65, 0x05, 0x73, 0x68, 0x61, 0x64, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x32, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x30, 0x43, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x30, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x31, 0x05, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x39, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x39, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x45, 0x35,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x33, 0x37, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x37, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x46, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x45,
-    0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x30, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x46, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x46, 0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x31, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x34, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x35, 0x30, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x46, 0x36, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46,
-    0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x42, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x37, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46,
-    0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x46, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x46, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x35, 0x31,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x30, 0x34, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x46, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x42, 0x04,
-    0x70, 0x68, 0x69, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x37, 0x38, 0x06, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x31,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x33, 0x46, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x33, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x32, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x44,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x33, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x43, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x45, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x43, 0x08, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x31, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x44, 0x30, 0x06, 0x74, 0x68, 0x65, 0x74, 0x61, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x46, 0x34, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x33, 0x37, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x37, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x33, 0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x33, 0x46, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x46, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x45, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x33, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36,
-    0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x30, 0x38, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x36, 0x30, 0x31, 0x06, 0x75, 0x31, 0x46, 0x34, 0x37, 0x44, 0x06, 0x75, 0x31, 0x46, 0x35,
-    0x31, 0x37, 0x06, 0x75, 0x31, 0x46, 0x35, 0x41, 0x34, 0x06, 0x75, 0x31, 0x46, 0x36, 0x41, 0x43, 0x06, 0x75, 0x31,
-    0x46, 0x36, 0x42, 0x39, 0x06, 0x75, 0x31, 0x46, 0x36, 0x42, 0x41, 0x06, 0x75, 0x31, 0x46, 0x35, 0x45, 0x38, 0x06,
-    0x75, 0x31, 0x46, 0x35, 0x45, 0x39, 0x06, 0x75, 0x31, 0x46, 0x34, 0x45, 0x34, 0x06, 0x75, 0x31, 0x46, 0x34, 0x45,
-    0x35, 0x06, 0x75, 0x31, 0x46, 0x34, 0x43, 0x34, 0x06, 0x75, 0x31, 0x46, 0x34, 0x43, 0x31, 0x06, 0x75, 0x31, 0x46,
-    0x34, 0x43, 0x32, 0x06, 0x75, 0x31, 0x46, 0x34, 0x44, 0x45, 0x06, 0x75, 0x31, 0x46, 0x34, 0x45, 0x37, 0x06, 0x75,
-    0x31, 0x46, 0x33, 0x30, 0x44, 0x06, 0x75, 0x31, 0x46, 0x39, 0x36, 0x35, 0x06, 0x75, 0x31, 0x46, 0x33, 0x33, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x34, 0x43, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x31, 0x33, 0x39, 0x06, 0x75, 0x31, 0x46, 0x35, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x31,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x45, 0x33, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x35, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x31, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x33, 0x44,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x33, 0x42, 0x06, 0x75, 0x31, 0x46, 0x33, 0x41, 0x37, 0x06, 0x75, 0x31, 0x46,
-    0x33, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46, 0x44,
-    0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x43, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x39, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x46, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x32, 0x35, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x31, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x38, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x31, 0x38, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x31, 0x34, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x37, 0x44, 0x42, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x30, 0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31,
-    0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x31, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x36, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x32, 0x36, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x34,
-    0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x34, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x30, 0x34, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x32, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x44,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x32, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x42, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x42,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35,
-    0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x36, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x36, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x44, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x36, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x38, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x42, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x36, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38,
-    0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x46,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x46, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x46, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x45, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x31, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x41, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x31, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x44, 0x44,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x36, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x32, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
-    0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x45, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x45, 0x45, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x46, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x41, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x41, 0x33, 0x09, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32, 0x09, 0x74, 0x69, 0x6c,
-    0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x33, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x33, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
-    0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x46, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x32, 0x38, 0x0c, 0x64, 0x6f, 0x74, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x63, 0x6f, 0x6d, 0x62, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x30, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x37, 0x0e, 0x74, 0x77, 0x6f, 0x64,
-    0x6f, 0x74, 0x65, 0x6e, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0e, 0x6f, 0x6e, 0x65, 0x64, 0x6f, 0x74, 0x65, 0x6e,
-    0x6c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x30, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x33, 0x30, 0x31, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x45, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x45, 0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x43,
-    0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x43, 0x37, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x38, 0x33, 0x07, 0x6c, 0x66, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x07, 0x72, 0x74, 0x62, 0x6c, 0x6f, 0x63,
-    0x6b, 0x07, 0x75, 0x70, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x07, 0x64, 0x6e, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x35, 0x39, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x35, 0x39, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x38,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x43, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x35, 0x39, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35,
-    0x39, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x35, 0x38, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x38, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32,
-    0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x35, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x42,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x32, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x33, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33,
-    0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x36, 0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x36, 0x34, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x41, 0x36, 0x35, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x36, 0x35, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x41, 0x36, 0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x41, 0x36, 0x36, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30,
-    0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x30, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// NOLINTEND
-
-} // namespace Assets::Classic
-
-#endif
\ No newline at end of file
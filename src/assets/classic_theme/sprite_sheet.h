@@ -1,388 +0,0 @@
-/*
- * MIT License
- *
- * Copyright (c) 2024 Yan01h
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-// To make sprite sheets create a new png file containing all sprites in a row and use the following
-// website to convert it to a c-style array:
-// https://notisrac.github.io/FileToCArray/
-// Format: 32bit RGBA
-// Endian: Big-Endian (might have to be changed)
-// DataType int
-
-#ifndef WS_ASSETS_CLASSIC_THEME_SPRITE_SHEET_H
-#define WS_ASSETS_CLASSIC_THEME_SPRITE_SHEET_H
-
-namespace Assets::Classic {
-
-constexpr unsigned int SHEET_WIDTH  = 192;
-constexpr unsigned int SHEET_HEIGHT = 16;
-
-// NOLINTBEGIN
-constexpr unsigned int SHEET_DATA[] = {
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000,
-    0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000,
-    0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
-    0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000,
-    0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff,
-    0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000,
-    0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080,
-    0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0,
-    0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000,
-    0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000,
-    0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000,
-    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000,
-    0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
-    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
-    0xffffffff, 0xffffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff,
-    0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000,
-    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
-    0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080,
-    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000,
-    0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000,
-    0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000,
-    0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff,
-    0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
-    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000,
-    0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080,
-    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000,
-    0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
-    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
-    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000,
-    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
-    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
-    0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000, 0xff808000,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000,
-    0xff000000, 0xff000000, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffffffff,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0,
-    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xffffffff,
-    0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
-    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
-    0xff808080, 0xff808080, 0xff808080};
-// NOLINTEND
-
-} // namespace Assets::Classic
-
-#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "embedded_asset.h"
+
+#include <raylib.h>
+
+AssetData::AssetData(const EmbeddedAsset& asset)
+    : _data(DecompressData(asset.compressedData, asset.compressedSize, &_size))
+{
+    if (_data == nullptr || _size != asset.size)
+    {
+        TraceLog(LOG_WARNING, "Failed to decompress an embedded asset (%i of %i bytes)", _data != nullptr ? _size : 0,
+                 asset.size);
+        MemFree(_data);
+        _data = nullptr;
+        _size = 0;
+    }
+}
+
+AssetData::~AssetData()
+{
+    MemFree(_data);
+}
+
+auto AssetData::isValid() const -> bool
+{
+    return _data != nullptr;
+}
+
+auto AssetData::getData() const -> const unsigned char*
+{
+    return _data;
+}
+
+auto AssetData::getSize() const -> int
+{
+    return _size;
+}
+
+auto AssetData::release() -> unsigned char*
+{
+    unsigned char* data = _data;
+    _data               = nullptr;
+    _size               = 0;
+    return data;
+}
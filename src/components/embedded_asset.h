@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_EMBEDDED_ASSET_H
+#define WS_COMPONENTS_EMBEDDED_ASSET_H
+
+// Asset compressed at build time by tools/asset_compiler (see cmake/AssetCompiler.cmake)
+struct EmbeddedAsset
+{
+    const unsigned char* compressedData;
+    int                  compressedSize;
+    int                  size;
+};
+
+// Glyph metrics and atlas rectangle of a baked font, same layout as raylib's GlyphInfo and Font::recs
+struct BakedGlyph
+{
+    int   value;
+    int   offsetX;
+    int   offsetY;
+    int   advanceX;
+    float x;
+    float y;
+    float width;
+    float height;
+};
+
+// Font atlas rasterized at build time. The atlas only stores the alpha channel.
+struct BakedFont
+{
+    int               baseSize;
+    int               glyphCount;
+    int               glyphPadding;
+    bool              sdf;
+    int               atlasWidth;
+    int               atlasHeight;
+    const BakedGlyph* glyphs;
+    EmbeddedAsset     atlas;
+};
+
+// Decompressed copy of an embedded asset. Themes only create it while loading, so the compressed data stays
+// untouched in the executable until a theme actually needs it. A corrupted asset leaves it empty.
+class AssetData final
+{
+public:
+             AssetData() = delete;
+    explicit AssetData(const EmbeddedAsset& asset);
+    ~AssetData();
+
+    AssetData(const AssetData&)                    = delete;
+    auto operator=(const AssetData&) -> AssetData& = delete;
+
+    [[nodiscard]] auto isValid() const -> bool;
+    [[nodiscard]] auto getData() const -> const unsigned char*;
+    [[nodiscard]] auto getSize() const -> int;
+
+    // Hands the decompressed buffer over to the caller, it has to be freed with MemFree() or UnloadImage()
+    [[nodiscard]] auto release() -> unsigned char*;
+private:
+    unsigned char* _data;
+    int            _size;
+};
+
+#endif
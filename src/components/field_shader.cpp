@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "field_shader.h"
+
+#include <cstddef>
+
+// The shader decodes packTile() and maps the tile to a sprite sheet cell exactly like GameScreen::renderTile()
+static_assert(static_cast<int>(TileState::Closed) == 0 && static_cast<int>(TileState::Flagged) == 2);
+static_assert(CLOSED_NUM == 10 && FLAG_NUM == 11);
+
+static constexpr const char* FIELD_FRAGMENT_SHADER = R"(#version 330
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform sampler2D spriteSheet;
+uniform vec4      colDiffuse;
+uniform vec2      fieldSize;
+uniform float     spriteCount;
+
+out vec4 finalColor;
+
+void main()
+{
+    vec2 fieldPosition = fragTexCoord * fieldSize;
+    vec2 tile          = min(floor(fieldPosition), fieldSize - 1.0);
+    vec2 tileUV        = fieldPosition - tile;
+
+    int packedTile = int(texelFetch(texture0, ivec2(tile), 0).r * 255.0 + 0.5);
+    int number     = packedTile & 15;
+    int state      = packedTile >> 4;
+    int sprite     = state == 0 ? 10 : (state == 2 ? 11 : number);
+
+    vec2 spriteUV = vec2((float(sprite) + tileUV.x) / spriteCount, tileUV.y);
+    finalColor    = texture(spriteSheet, spriteUV) * colDiffuse * fragColor;
+}
+)";
+
+FieldStateTexture::FieldStateTexture(IRenderBackend& renderer)
+    : _renderer(renderer)
+    , _texture()
+{}
+
+FieldStateTexture::~FieldStateTexture()
+{
+    _renderer.unloadTexture(_texture);
+}
+
+void FieldStateTexture::update(MineField& field, FrameArena& arena)
+{
+    const FrameArena::Scope scope(arena);
+    if (_texture.width != field.getWidth() || _texture.height != field.getHeight())
+    {
+        load(field, arena);
+    } else if (const TileArea area = field.getDirtyArea(); area.rowCount > 0 && area.columnCount > 0)
+    {
+        updateArea(field, area, arena);
+    }
+    field.clearDirtyArea();
+}
+
+auto FieldStateTexture::getTexture() const -> const Texture2D&
+{
+    return _texture;
+}
+
+void FieldStateTexture::load(const MineField& field, FrameArena& arena)
+{
+    _renderer.unloadTexture(_texture);
+
+    auto* stagingBuffer = arena.allocate<unsigned char>(static_cast<std::size_t>(field.getWidth()) * field.getHeight());
+    for (int row = 0; row < field.getHeight(); row++)
+    {
+        for (int column = 0; column < field.getWidth(); column++)
+        {
+            stagingBuffer[column + row * field.getWidth()] = packTile(field.getTile(row, column));
+        }
+    }
+
+    Image image;
+    image.width   = field.getWidth();
+    image.height  = field.getHeight();
+    image.data    = stagingBuffer;
+    image.format  = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    image.mipmaps = 1;
+
+    _texture = _renderer.loadTexture(image);
+}
+
+void FieldStateTexture::updateArea(const MineField& field, const TileArea& area, FrameArena& arena)
+{
+    auto* stagingBuffer = arena.allocate<unsigned char>(static_cast<std::size_t>(area.columnCount) * area.rowCount);
+    for (int row = 0; row < area.rowCount; row++)
+    {
+        for (int column = 0; column < area.columnCount; column++)
+        {
+            stagingBuffer[column + row * area.columnCount] =
+                packTile(field.getTile(area.row + row, area.column + column));
+        }
+    }
+
+    const Rectangle rectangle{static_cast<float>(area.column), static_cast<float>(area.row),
+                              static_cast<float>(area.columnCount), static_cast<float>(area.rowCount)};
+    _renderer.updateTexture(_texture, rectangle, stagingBuffer);
+}
+
+FieldShader::FieldShader(IRenderBackend& renderer)
+    : _renderer(renderer)
+    , _shader(renderer.loadShader(FIELD_FRAGMENT_SHADER))
+    , _spriteSheetLocation(renderer.getShaderLocation(_shader, "spriteSheet"))
+    , _fieldSizeLocation(renderer.getShaderLocation(_shader, "fieldSize"))
+    , _spriteCountLocation(renderer.getShaderLocation(_shader, "spriteCount"))
+{
+    if (!isSupported())
+    {
+        TraceLog(LOG_WARNING, "Field shader not supported, falling back to per tile rendering");
+    }
+}
+
+FieldShader::~FieldShader()
+{
+    _renderer.unloadShader(_shader);
+}
+
+auto FieldShader::isSupported() const -> bool
+{
+    return _renderer.isShaderSupported(_shader);
+}
+
+void FieldShader::render(const FieldStateTexture& state, const Texture2D& spriteSheet, const int tileSize,
+                         const Rectangle& destination) const
+{
+    const Texture2D& stateTexture = state.getTexture();
+    const Vector2    fieldSize{static_cast<float>(stateTexture.width), static_cast<float>(stateTexture.height)};
+    const auto       spriteCount = static_cast<float>(spriteSheet.width / tileSize);
+
+    _renderer.beginShader(_shader);
+    {
+        _renderer.setShaderTexture(_shader, _spriteSheetLocation, spriteSheet);
+        _renderer.setShaderValue(_shader, _fieldSizeLocation, &fieldSize, SHADER_UNIFORM_VEC2);
+        _renderer.setShaderValue(_shader, _spriteCountLocation, &spriteCount, SHADER_UNIFORM_FLOAT);
+
+        _renderer.drawTexture(stateTexture, {0.F, 0.F, fieldSize.x, fieldSize.y}, destination, WHITE);
+    }
+    _renderer.endShader();
+}
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_FIELD_SHADER_H
+#define WS_COMPONENTS_FIELD_SHADER_H
+
+#include <raylib.h>
+
+#include "components/frame_arena.h"
+#include "components/mine_field.h"
+#include "components/render_backend.h"
+
+// Per board part of the field shader, the tiles are stored in a one byte per tile state texture (see packTile())
+class FieldStateTexture final
+{
+public:
+    explicit FieldStateTexture(IRenderBackend& renderer);
+            ~FieldStateTexture();
+
+    FieldStateTexture(const FieldStateTexture&)                    = delete;
+    auto operator=(const FieldStateTexture&) -> FieldStateTexture& = delete;
+
+    // Uploads the tiles that changed since the last call, the upload is staged in the frame arena
+    void               update(MineField& field, FrameArena& arena);
+    [[nodiscard]] auto getTexture() const -> const Texture2D&;
+private:
+    void load(const MineField& field, FrameArena& arena);
+    void updateArea(const MineField& field, const TileArea& area, FrameArena& arena);
+private:
+    IRenderBackend& _renderer;
+    Texture2D       _texture;
+};
+
+// Renders a whole mine field with a single quad, a fragment shader picks the matching sprite sheet cell for every
+// pixel of the state texture. Compiled once and shared by all game screens.
+class FieldShader final
+{
+public:
+    explicit FieldShader(IRenderBackend& renderer);
+            ~FieldShader();
+
+    FieldShader(const FieldShader&)                    = delete;
+    auto operator=(const FieldShader&) -> FieldShader& = delete;
+
+    [[nodiscard]] auto isSupported() const -> bool;
+
+    void render(const FieldStateTexture& state, const Texture2D& spriteSheet, int tileSize,
+                const Rectangle& destination) const;
+private:
+    IRenderBackend& _renderer;
+
+    Shader _shader;
+    int    _spriteSheetLocation;
+    int    _fieldSizeLocation;
+    int    _spriteCountLocation;
+};
+
+#endif
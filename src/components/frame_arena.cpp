@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "frame_arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <raylib.h>
+
+FrameArena::Scope::Scope(FrameArena& arena)
+    : _arena(arena)
+    , _marker(arena._used)
+{}
+
+FrameArena::Scope::~Scope()
+{
+    // Overflow blocks stay until the next reset, only the main buffer is rewound
+    assert(_marker <= _arena._used);
+    _arena._used = _marker;
+}
+
+FrameArena::FrameArena()
+    : _buffer()
+    , _capacity(0)
+    , _used(0)
+    , _peak(0)
+    , _reserved(0)
+    , _shrink(false)
+    , _overflow()
+    , _overflowSize(0)
+{}
+
+void FrameArena::reserve(const std::size_t size)
+{
+    _reserved += size;
+    if (_used == 0 && _overflow.empty() && _reserved > _capacity)
+    {
+        resize(_reserved);
+    }
+}
+
+void FrameArena::release(const std::size_t size)
+{
+    assert(size <= _reserved);
+    _reserved -= size;
+    _shrink = _shrink || size > 0;
+}
+
+void FrameArena::reset()
+{
+    if (!_overflow.empty())
+    {
+        TraceLog(LOG_INFO, "Frame arena overflowed, growing to %zu bytes", _peak);
+        _overflow.clear();
+        _overflowSize = 0;
+    }
+    // The last frame is the best guess for the next one, e.g. a few megabytes of a big board are not kept after it
+    if (const std::size_t capacity = std::max(_peak, _reserved);
+        capacity > _capacity || (_shrink && capacity < _capacity))
+    {
+        resize(capacity);
+    }
+    _used   = 0;
+    _peak   = 0;
+    _shrink = false;
+}
+
+auto FrameArena::getUsed() const -> std::size_t
+{
+    return _used;
+}
+
+auto FrameArena::getCapacity() const -> std::size_t
+{
+    return _capacity;
+}
+
+auto FrameArena::allocateBytes(const std::size_t size, const std::size_t alignment) -> void*
+{
+    const std::size_t offset = (_used + alignment - 1) & ~(alignment - 1);
+    if (offset + size <= _capacity)
+    {
+        _used = offset + size;
+        _peak = std::max(_peak, _used);
+        return _buffer.get() + offset;
+    }
+
+    // Counted as if the main buffer had been large enough, so the next reset makes room for it
+    _overflowSize += size + alignment;
+    _peak = std::max(_peak, _used + _overflowSize);
+    _overflow.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+    return _overflow.back().get();
+}
+
+void FrameArena::resize(const std::size_t capacity)
+{
+    _buffer   = std::make_unique_for_overwrite<std::byte[]>(capacity);
+    _capacity = capacity;
+}
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_FRAME_ARENA_H
+#define WS_COMPONENTS_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for temporaries of a single frame, everything is released at once when the main loop resets it.
+// Running out of space falls back to separate blocks until the next reset, which then grows the arena to the peak
+// usage, so a steady frame never touches the heap. It only shrinks again when a reservation is released.
+class FrameArena final
+{
+public:
+    // Releases everything allocated after its creation when it goes out of scope
+    class Scope final
+    {
+    public:
+        explicit Scope(FrameArena& arena);
+        ~Scope();
+
+        Scope(const Scope&)                    = delete;
+        auto operator=(const Scope&) -> Scope& = delete;
+    private:
+        FrameArena& _arena;
+        std::size_t _marker;
+    };
+public:
+    FrameArena();
+
+    FrameArena(const FrameArena&)                    = delete;
+    auto operator=(const FrameArena&) -> FrameArena& = delete;
+
+    // Uninitialized storage for count values, valid until the next reset or the end of the enclosing scope
+    template <typename T>
+    [[nodiscard]] auto allocate(std::size_t count) -> T*;
+
+    // Keeps room for size bytes until it is released, right away if the arena is unused and at the next reset
+    // otherwise. Reservations add up, so a game started while the last one is still alive keeps its room.
+    void reserve(std::size_t size);
+    // Gives a reservation back, the next reset shrinks the arena to what is still reserved or was used
+    void release(std::size_t size);
+    // Called by the main loop at the start of every frame
+    void reset();
+
+    [[nodiscard]] auto getUsed() const -> std::size_t;
+    [[nodiscard]] auto getCapacity() const -> std::size_t;
+private:
+    [[nodiscard]] auto allocateBytes(std::size_t size, std::size_t alignment) -> void*;
+    void               resize(std::size_t capacity);
+private:
+    std::unique_ptr<std::byte[]> _buffer;
+    std::size_t                  _capacity;
+    std::size_t                  _used;
+    std::size_t                  _peak; // Including the overflow blocks
+    std::size_t                  _reserved;
+    bool                         _shrink; // A reservation was released since the last reset
+
+    std::vector<std::unique_ptr<std::byte[]>> _overflow;
+    std::size_t                               _overflowSize;
+};
+
+template <typename T>
+auto FrameArena::allocate(const std::size_t count) -> T*
+{
+    static_assert(std::is_trivially_destructible_v<T>, "The arena never runs destructors");
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    return static_cast<T*>(allocateBytes(count * sizeof(T), alignof(T)));
+}
+
+#endif
@@ -0,0 +1,278 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "game_rules.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "components/frame_arena.h"
+#include "diagnostics/metrics.h"
+#include "diagnostics/profiler.h"
+
+GameRules::GameRules(FrameArena& arena)
+    : _arena(arena)
+    , _reserved(0)
+    , _field(nullptr)
+    , _state(GameState::Playing)
+    , _bombCount(0)
+    , _normalTileCount(0)
+    , _autoChordDepth(0)
+    , _autoChord(false)
+{}
+
+GameRules::~GameRules()
+{
+    _arena.release(_reserved);
+}
+
+void GameRules::start(MineField& field)
+{
+    _field           = &field;
+    _state           = GameState::Playing;
+    _bombCount       = field.getBombCount();
+    _normalTileCount = field.getWidth() * field.getHeight() - field.getBombCount();
+    _autoChordDepth  = 0;
+
+    // Room for the flood fill stack, so the first click does not allocate. The arena shrinks again after the game.
+    _arena.release(_reserved);
+    _reserved = static_cast<std::size_t>(field.getWidth()) * field.getHeight() * sizeof(int);
+    _arena.reserve(_reserved);
+}
+
+void GameRules::setAutoChord(const bool autoChord)
+{
+    _autoChord = autoChord;
+}
+
+void GameRules::leftClick(const int row, const int column)
+{
+    assert(_field);
+    if (_state != GameState::Playing)
+    {
+        return;
+    }
+
+    if (const Tile& tile = _field->getTile(row, column); tile.state == TileState::Open && tile.number != 0)
+    {
+        WS_PROFILE_SCOPE("GameRules::chordClick");
+        doChordClick(row, column);
+    } else
+    {
+        doSingleTileClick(row, column);
+    }
+}
+
+void GameRules::rightClick(const int row, const int column)
+{
+    assert(_field);
+    if (_state != GameState::Playing)
+    {
+        return;
+    }
+
+    const auto [number, state] = _field->getTile(row, column);
+    if (state == TileState::Open)
+    {
+        return;
+    }
+    if (state == TileState::Closed)
+    {
+        _field->setTileState(row, column, TileState::Flagged);
+        _bombCount--;
+    } else
+    {
+        _field->setTileState(row, column, TileState::Closed);
+        _bombCount++;
+    }
+
+    if (_autoChord)
+    {
+        doAutoChord(row, column);
+    }
+}
+
+auto GameRules::getState() const -> GameState
+{
+    return _state;
+}
+
+auto GameRules::getBombCount() const -> int
+{
+    return _bombCount;
+}
+
+void GameRules::doSingleTileClick(const int row, const int column)
+{
+    const auto [number, state] = _field->getTile(row, column);
+    if (state == TileState::Open || state == TileState::Flagged)
+    {
+        return;
+    }
+
+    if (number == 0)
+    {
+        WS_PROFILE_SCOPE("GameRules::floodFill");
+        openEmptyTiles(row, column);
+    } else
+    {
+        if (number != BOMB_NUM)
+        {
+            _normalTileCount--;
+        }
+        _field->setTileState(row, column, TileState::Open);
+        if (_autoChord)
+        {
+            doAutoChordClick(row, column);
+        }
+    }
+
+    if (number == BOMB_NUM)
+    {
+        explode();
+    }
+
+    if (_normalTileCount == 0)
+    {
+        _state = GameState::Won;
+    }
+}
+
+void GameRules::doChordClick(const int row, const int column)
+{
+    Metrics::add(Metric::ChordAttempts);
+    // Count flags
+    int flagCount = 0;
+    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field->getHeight() - 1); blockRow++)
+    {
+        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field->getWidth() - 1);
+             blockColumn++)
+        {
+            if (_field->getTile(blockRow, blockColumn).state == TileState::Flagged)
+            {
+                flagCount++;
+            }
+        }
+    }
+
+    if (flagCount != _field->getTile(row, column).number)
+    {
+        return;
+    }
+
+    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field->getHeight() - 1); blockRow++)
+    {
+        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field->getWidth() - 1);
+             blockColumn++)
+        {
+            doSingleTileClick(blockRow, blockColumn);
+        }
+    }
+}
+
+void GameRules::doAutoChordClick(const int row, const int column)
+{
+    // Tiles opened by the chord chord again, the depth is the length of that chain
+    _autoChordDepth++;
+    Metrics::observeMax(Metric::AutoChordDepth, static_cast<uint64_t>(_autoChordDepth));
+    doChordClick(row, column);
+    _autoChordDepth--;
+}
+
+void GameRules::openEmptyTiles(const int row, const int column)
+{
+    // Iterative so huge empty areas can not overflow the call stack. A tile is only pushed when it gets opened, so the
+    // stack never holds more than every tile once.
+    const FrameArena::Scope scope(_arena);
+
+    const int width = _field->getWidth();
+    int*      stack = _arena.allocate<int>(static_cast<std::size_t>(width) * _field->getHeight());
+    int       size  = 0;
+
+    const auto open = [this, stack, &size, width](const int tileRow, const int tileColumn) {
+        Metrics::add(Metric::FloodFillTiles);
+        const auto [number, state] = _field->getTile(tileRow, tileColumn);
+        if (state == TileState::Open)
+        {
+            return;
+        }
+
+        _field->setTileState(tileRow, tileColumn, TileState::Open);
+        _normalTileCount--;
+        if (number == 0)
+        {
+            stack[size++] = tileColumn + tileRow * width;
+        }
+    };
+
+    open(row, column);
+    while (size > 0)
+    {
+        const int tile       = stack[--size];
+        const int tileRow    = tile / width;
+        const int tileColumn = tile % width;
+        for (int blockRow = std::max(tileRow - 1, 0); blockRow <= std::min(tileRow + 1, _field->getHeight() - 1);
+             blockRow++)
+        {
+            for (int blockColumn = std::max(tileColumn - 1, 0); blockColumn <= std::min(tileColumn + 1, width - 1);
+                 blockColumn++)
+            {
+                open(blockRow, blockColumn);
+            }
+        }
+    }
+}
+
+void GameRules::doAutoChord(const int row, const int column)
+{
+    WS_PROFILE_FUNCTION();
+    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field->getHeight() - 1); blockRow++)
+    {
+        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field->getWidth() - 1);
+             blockColumn++)
+        {
+            if (const auto [number, state] = _field->getTile(blockRow, blockColumn);
+                state == TileState::Open && number != 0)
+            {
+                doAutoChordClick(blockRow, blockColumn);
+            }
+        }
+    }
+}
+
+void GameRules::explode()
+{
+    _state = GameState::Exploded;
+    for (int row = 0; row < _field->getHeight(); row++)
+    {
+        for (int column = 0; column < _field->getWidth(); column++)
+        {
+            if (const auto [number, state] = _field->getTile(row, column);
+                number == BOMB_NUM && state != TileState::Flagged)
+            {
+                _field->setTileState(row, column, TileState::Open);
+            }
+        }
+    }
+}
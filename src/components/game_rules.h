@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_GAME_RULES_H
+#define WS_COMPONENTS_GAME_RULES_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "components/mine_field.h"
+
+class FrameArena;
+
+enum class GameState : uint8_t
+{
+    Playing = 0,
+    Won,
+    Exploded
+};
+
+// The rules of one game on a mine field, without any input or rendering so the headless commands play by the same
+// rules as GameScreen. Flood fills take their scratch memory from the arena, playing allocates nothing.
+class GameRules final
+{
+public:
+    GameRules() = delete;
+    explicit GameRules(FrameArena& arena);
+    ~GameRules();
+
+    GameRules(const GameRules&)                    = delete;
+    auto operator=(const GameRules&) -> GameRules& = delete;
+
+    // Starts a new game, the field has to outlive it
+    void start(MineField& field);
+    void setAutoChord(bool autoChord);
+
+    // Opens a closed tile, or chords an open number
+    void leftClick(int row, int column);
+    // Toggles the flag of a closed tile
+    void rightClick(int row, int column);
+
+    [[nodiscard]] auto getState() const -> GameState;
+    // Bombs minus flags, negative with too many flags
+    [[nodiscard]] auto getBombCount() const -> int;
+private:
+    void doSingleTileClick(int row, int column);
+    void doChordClick(int row, int column);
+    void doAutoChordClick(int row, int column);
+    void openEmptyTiles(int row, int column);
+    void doAutoChord(int row, int column);
+    void explode();
+private:
+    FrameArena& _arena;
+    std::size_t _reserved; // Room of the flood fill stack, given back to the arena when the game ends
+    MineField*  _field;
+
+    GameState _state;
+    int       _bombCount;
+    int       _normalTileCount;
+    int       _autoChordDepth;
+    bool      _autoChord;
+};
+
+#endif
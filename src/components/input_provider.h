@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_INPUT_PROVIDER_H
+#define WS_COMPONENTS_INPUT_PROVIDER_H
+
+#include <raylib.h>
+
+// Input of the current frame as read by the screens, so scripts can drive them the same way the player does. The
+// getters mirror their raylib counterparts. Raygui widgets still read raylib directly.
+class IInputProvider
+{
+public:
+    virtual ~IInputProvider() = default;
+
+    // Moves on to the input of the next frame, called by the main loop before the screens update
+    virtual void update() = 0;
+
+    [[nodiscard]] virtual auto isKeyPressed(int key) const -> bool             = 0;
+    [[nodiscard]] virtual auto isMouseButtonPressed(int button) const -> bool  = 0;
+    [[nodiscard]] virtual auto isMouseButtonReleased(int button) const -> bool = 0;
+    [[nodiscard]] virtual auto getMousePosition() const -> Vector2             = 0;
+    [[nodiscard]] virtual auto getMouseDelta() const -> Vector2                = 0;
+    [[nodiscard]] virtual auto getMouseWheelMove() const -> float              = 0;
+
+    // True if any mouse or key input arrived for the current frame, which wakes the main loop up
+    [[nodiscard]] virtual auto hasInput() const -> bool = 0;
+    // True while input is scheduled for coming frames, which keeps the main loop from idling
+    [[nodiscard]] virtual auto hasPendingInput() const -> bool = 0;
+};
+
+#endif
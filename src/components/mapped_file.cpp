@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mapped_file.h"
+
+#include <raylib.h>
+
+#ifdef WS_PLATFORM_WINDOWS
+#    define WIN32_LEAN_AND_MEAN
+#    define NOGDI
+#    define NOUSER
+#    include <windows.h>
+#    undef near
+#    undef far
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : _data(nullptr)
+    , _size(0)
+#ifdef WS_PLATFORM_WINDOWS
+    , _mapping(nullptr)
+#endif
+{}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#ifdef WS_PLATFORM_WINDOWS
+
+auto MappedFile::open(const char* path) -> bool
+{
+    close();
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        TraceLog(LOG_WARNING, "Failed to open %s", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) == 0 || size.QuadPart == 0)
+    {
+        TraceLog(LOG_WARNING, "Failed to get the size of %s", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    // The mapping keeps the file open on its own
+    _mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (_mapping == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Failed to map %s", path);
+        return false;
+    }
+
+    _data = static_cast<const unsigned char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (_data == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Failed to map %s", path);
+        close();
+        return false;
+    }
+    _size = static_cast<std::size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+    }
+    _data    = nullptr;
+    _size    = 0;
+    _mapping = nullptr;
+}
+
+#else
+
+auto MappedFile::open(const char* path) -> bool
+{
+    close();
+
+    const int file = ::open(path, O_RDONLY);
+    if (file == -1)
+    {
+        TraceLog(LOG_WARNING, "Failed to open %s", path);
+        return false;
+    }
+
+    struct stat status = {};
+    if (fstat(file, &status) == -1 || status.st_size == 0)
+    {
+        TraceLog(LOG_WARNING, "Failed to get the size of %s", path);
+        ::close(file);
+        return false;
+    }
+
+    // The mapping keeps the file open on its own
+    void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED) // NOLINT
+    {
+        TraceLog(LOG_WARNING, "Failed to map %s", path);
+        return false;
+    }
+
+    _data = static_cast<const unsigned char*>(data);
+    _size = static_cast<std::size_t>(status.st_size);
+
+    // Everything gets uploaded right away, so let the kernel read ahead
+    posix_madvise(data, _size, POSIX_MADV_WILLNEED);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data != nullptr)
+    {
+        munmap(const_cast<unsigned char*>(_data), _size); // NOLINT
+    }
+    _data = nullptr;
+    _size = 0;
+}
+
+#endif
+
+auto MappedFile::isOpen() const -> bool
+{
+    return _data != nullptr;
+}
+
+auto MappedFile::getData() const -> const unsigned char*
+{
+    return _data;
+}
+
+auto MappedFile::getSize() const -> std::size_t
+{
+    return _size;
+}
@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_MAPPED_FILE_H
+#define WS_COMPONENTS_MAPPED_FILE_H
+
+#include <cstddef>
+
+// Read only memory mapping of a whole file. The pages are shared with every other process mapping the same file.
+class MappedFile final
+{
+public:
+     MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)                    = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    [[nodiscard]] auto open(const char* path) -> bool;
+    void               close();
+
+    [[nodiscard]] auto isOpen() const -> bool;
+    [[nodiscard]] auto getData() const -> const unsigned char*;
+    [[nodiscard]] auto getSize() const -> std::size_t;
+private:
+    const unsigned char* _data;
+    std::size_t          _size;
+#ifdef WS_PLATFORM_WINDOWS
+    void* _mapping;
+#endif
+};
+
+#endif
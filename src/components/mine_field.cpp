@@ -24,28 +24,76 @@
 
 #include "mine_field.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <random>
 #include <raylib.h>
+#include <string>
+
+#include "diagnostics/logger.h"
+#include "diagnostics/metrics.h"
+#include "diagnostics/profiler.h"
+
+constexpr int PROGRESS_INTERVAL = 1 << 14; // Bombs placed between two progress reports
 
 MineField::MineField(const int width, const int height, const int bombCount)
+    : MineField(Uninitialized{}, width, height, bombCount)
+{
+    reset(width, height, bombCount, std::random_device()());
+}
+
+MineField::MineField(Uninitialized /*tag*/, const int width, const int height, const int bombCount)
     : _width(width)
     , _height(height)
     , _bombCount(bombCount)
-{
-    assert(_width < 999);
-    assert(_height < 999);
+    , _seed(0)
+    , _dirtyArea()
+{}
 
-    create(bombCount);
+auto MineField::generate(const int width, const int height, const int bombCount, const GenerationProgress& progress,
+                         std::unique_ptr<MineField> storage) -> std::unique_ptr<MineField>
+{
+    std::unique_ptr<MineField> field = std::move(storage);
+    if (!field)
+    {
+        field = std::make_unique<MineField>(Uninitialized{}, width, height, bombCount);
+    }
+    if (!field->reset(width, height, bombCount, std::random_device()(), progress))
+    {
+        Logger::log(LOG_INFO, "Mine field generation cancelled");
+        return nullptr;
+    }
+    return field;
 }
 
-auto MineField::getTile(const int row, const int column) -> Tile&
+auto MineField::getTile(const int row, const int column) const -> const Tile&
 {
     assert(row < _height);
     assert(column < _width);
     return _tiles[column + row * _width];
 }
 
+void MineField::setTileState(const int row, const int column, const TileState state)
+{
+    assert(row < _height);
+    assert(column < _width);
+    _tiles[column + row * _width].state = state;
+
+    if (_dirtyArea.rowCount == 0 || _dirtyArea.columnCount == 0)
+    {
+        _dirtyArea = {row, column, 1, 1};
+        return;
+    }
+
+    const int firstRow    = std::min(_dirtyArea.row, row);
+    const int firstColumn = std::min(_dirtyArea.column, column);
+    const int lastRow     = std::max(_dirtyArea.row + _dirtyArea.rowCount - 1, row);
+    const int lastColumn  = std::max(_dirtyArea.column + _dirtyArea.columnCount - 1, column);
+
+    _dirtyArea = {firstRow, firstColumn, lastRow - firstRow + 1, lastColumn - firstColumn + 1};
+}
+
 auto MineField::getWidth() const -> int
 {
     return _width;
@@ -61,29 +109,102 @@ auto MineField::getBombCount() const -> int
     return _bombCount;
 }
 
-void MineField::create(const int bombCount)
+auto MineField::getSeed() const -> unsigned int
 {
-    TraceLog(LOG_INFO, "Creating %ix%i mine field with %i mines", _width, _height, bombCount);
-    assert(_width > 0 && _height > 0 && bombCount > 0);
+    return _seed;
+}
 
-    _tiles.resize(_width * _height, {0, TileState::Closed});
+auto MineField::encodeTiles() const -> std::string
+{
+    std::string tiles;
+    for (int row = 0; row < _height; row++)
+    {
+        int column = 0;
+        while (column < _width)
+        {
+            const char number = getTile(row, column).number;
+            int        run    = 1;
+            while (column + run < _width && getTile(row, column + run).number == number)
+            {
+                run++;
+            }
+            if (run > 1)
+            {
+                tiles += std::to_string(run);
+            }
+            tiles += number == BOMB_NUM ? 'x' : static_cast<char>('a' + number);
+            column += run;
+        }
+        tiles += '/';
+    }
+    return tiles;
+}
+
+auto MineField::getDirtyArea() const -> TileArea
+{
+    return _dirtyArea;
+}
+
+void MineField::clearDirtyArea()
+{
+    _dirtyArea = {0, 0, 0, 0};
+}
+
+void MineField::reset(const int width, const int height, const int bombCount, const unsigned int seed)
+{
+    (void)reset(width, height, bombCount, seed, [](float) { return true; });
+}
+
+auto MineField::reset(const int width, const int height, const int bombCount, const unsigned int seed,
+                      const GenerationProgress& progress) -> bool
+{
+    WS_PROFILE_SCOPE("MineField::reset");
+    const auto start = std::chrono::steady_clock::now();
+    Logger::log(LOG_INFO, "Creating %ix%i mine field with %i mines", width, height, bombCount);
+    assert(width > 0 && height > 0 && bombCount > 0);
+    assert(width < 999);
+    assert(height < 999);
+
+    _width     = width;
+    _height    = height;
+    _bombCount = bombCount;
+    _seed      = seed;
 
-    placeBombs(bombCount);
-    adjustNumbers();
+    // assign() keeps the capacity, so a restart of the same size neither allocates nor touches new pages
+    _tiles.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), {0, TileState::Closed});
+
+    if (!placeBombs(seed, progress) || !adjustNumbers(progress))
+    {
+        return false;
+    }
+
+    // Every tile is new
+    _dirtyArea = {0, 0, _height, _width};
 
 #ifdef WS_DEBUG_BUILD
     logField();
 #endif
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    Metrics::add(Metric::BoardsGenerated);
+    Metrics::add(Metric::GenerationNanoseconds,
+                 static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    return true;
 }
 
-void MineField::placeBombs(const int bombCount)
+// Bomb placement is the first half of the progress, the numbers the second
+auto MineField::placeBombs(const unsigned int seed, const GenerationProgress& progress) -> bool
 {
-    std::random_device            randDevice;
-    std::mt19937                  mersenne(randDevice());
+    std::mt19937                  mersenne(seed);
     std::uniform_int_distribution dist(0, static_cast<int>(_tiles.size() - 1));
 
-    for (int i = 0; i < bombCount; i++)
+    for (int i = 0; i < _bombCount; i++)
     {
+        if (i % PROGRESS_INTERVAL == 0 && !progress(0.5F * static_cast<float>(i) / static_cast<float>(_bombCount)))
+        {
+            return false;
+        }
+
         unsigned int bombSpot = dist(mersenne);
         while (_tiles[bombSpot].number == BOMB_NUM)
         {
@@ -95,20 +216,26 @@ void MineField::placeBombs(const int bombCount)
         }
         _tiles[bombSpot].number = BOMB_NUM;
     }
+    return true;
 }
 
-void MineField::adjustNumbers()
+auto MineField::adjustNumbers(const GenerationProgress& progress) -> bool
 {
     for (int row = 0; row < _height; row++)
     {
+        if (!progress(0.5F + 0.5F * static_cast<float>(row) / static_cast<float>(_height)))
+        {
+            return false;
+        }
         for (int column = 0; column < _width; column++)
         {
-            if (getTile(row, column).number != BOMB_NUM)
+            if (Tile& tile = _tiles[column + row * _width]; tile.number != BOMB_NUM)
             {
-                getTile(row, column).number = countBombsAround(row, column);
+                tile.number = countBombsAround(row, column);
             }
         }
     }
+    return progress(1.F);
 }
 
 auto MineField::countBombsAround(int row, int column) -> char
@@ -129,13 +256,10 @@ auto MineField::countBombsAround(int row, int column) -> char
 
 void MineField::logField()
 {
-    TraceLog(LOG_INFO, "Generated field:");
-    for (int row = 0; row < _height; row++)
+    // One line instead of a write per tile
+    if (Logger::isEnabled(LOG_INFO))
     {
-        for (int column = 0; column < _width; column++)
-        {
-            printf("%i ", getTile(row, column).number);
-        }
-        printf("\n");
+        Logger::write(LOG_INFO, "Generated field " + std::to_string(_width) + "x" + std::to_string(_height) +
+                                    ", seed " + std::to_string(_seed) + ": " + encodeTiles());
     }
 }
\ No newline at end of file
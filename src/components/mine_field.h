@@ -25,6 +25,9 @@
 #ifndef WS_COMPONENTS_MINE_FIELD_H
 #define WS_COMPONENTS_MINE_FIELD_H
 
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
 constexpr char BOMB_NUM   = 9;
@@ -44,32 +47,77 @@ struct Tile
     TileState state;
 };
 
+// Rectangle of tiles, empty if rowCount or columnCount is 0
+struct TileArea
+{
+    int row;
+    int column;
+    int rowCount;
+    int columnCount;
+};
+
+// Packs a tile into a single byte: number in the low nibble, state in the high nibble
+[[nodiscard]] constexpr auto packTile(const Tile& tile) -> unsigned char
+{
+    return static_cast<unsigned char>(tile.number) | static_cast<unsigned char>(tile.state) << 4;
+}
+
+// Receives the generation progress from 0 to 1, returning false aborts the generation
+using GenerationProgress = std::function<bool(float progress)>;
+
 class MineField final
 {
+public:
+    struct Uninitialized
+    {};
 public:
     MineField() = delete;
     MineField(int width, int height, int bombCount);
+    // Generates nothing, the field is unusable until the first reset with a seed
+    MineField(Uninitialized tag, int width, int height, int bombCount);
+
+    // Generates a field on the calling thread, nullptr if progress aborted it. A recycled field passed as storage is
+    // reset instead of allocating a new one.
+    [[nodiscard]] static auto generate(int width, int height, int bombCount, const GenerationProgress& progress,
+                                       std::unique_ptr<MineField> storage = nullptr) -> std::unique_ptr<MineField>;
+
+    // Generates a new field in place, reusing the tile storage when it is large enough. The same seed always yields
+    // the same field. The field is unusable until the next reset if progress aborted it.
+    void               reset(int width, int height, int bombCount, unsigned int seed);
+    [[nodiscard]] auto reset(int width, int height, int bombCount, unsigned int seed,
+                             const GenerationProgress& progress) -> bool;
 
-    auto getTile(int row, int column) -> Tile&;
+    [[nodiscard]] auto getTile(int row, int column) const -> const Tile&;
+    void               setTileState(int row, int column, TileState state);
 
     [[nodiscard]] auto getWidth() const -> int;
     [[nodiscard]] auto getHeight() const -> int;
     [[nodiscard]] auto getBombCount() const -> int;
-private:
-    void create(int bombCount);
+    // Seed of the last reset, generating with it again yields the same field
+    [[nodiscard]] auto getSeed() const -> unsigned int;
+
+    // Run length encoded numbers of all tiles: 'a' to 'i' for 0 to 8 and 'x' for bombs, prefixed by their count when
+    // repeated, '/' ends a row
+    [[nodiscard]] auto encodeTiles() const -> std::string;
 
-    void placeBombs(int bombCount);
-    void adjustNumbers();
+    // Area of tiles whose state changed since the last call to clearDirtyArea()
+    [[nodiscard]] auto getDirtyArea() const -> TileArea;
+    void               clearDirtyArea();
+private:
+    [[nodiscard]] auto placeBombs(unsigned int seed, const GenerationProgress& progress) -> bool;
+    [[nodiscard]] auto adjustNumbers(const GenerationProgress& progress) -> bool;
 
     auto countBombsAround(int row, int column) -> char;
 
     void logField();
 private:
-    int _width;
-    int _height;
-    int _bombCount;
+    int          _width;
+    int          _height;
+    int          _bombCount;
+    unsigned int _seed;
 
     std::vector<Tile> _tiles;
+    TileArea          _dirtyArea;
 };
 
 #endif
\ No newline at end of file
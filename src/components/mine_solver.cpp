@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mine_solver.h"
+
+#include <algorithm>
+
+#include "components/frame_arena.h"
+#include "components/mine_field.h"
+#include "diagnostics/profiler.h"
+
+namespace {
+
+struct Neighborhood
+{
+    int closed;
+    int flagged;
+};
+
+auto countNeighborhood(const MineField& field, const int row, const int column) -> Neighborhood
+{
+    Neighborhood neighborhood{0, 0};
+    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, field.getHeight() - 1); blockRow++)
+    {
+        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, field.getWidth() - 1);
+             blockColumn++)
+        {
+            const TileState state = field.getTile(blockRow, blockColumn).state;
+            neighborhood.closed += state == TileState::Closed ? 1 : 0;
+            neighborhood.flagged += state == TileState::Flagged ? 1 : 0;
+        }
+    }
+    return neighborhood;
+}
+
+// One pass of single number deductions, false if none applied
+auto deduce(MineField& field, GameRules& rules, SolveResult& result) -> bool
+{
+    bool progress = false;
+    for (int row = 0; row < field.getHeight() && rules.getState() == GameState::Playing; row++)
+    {
+        for (int column = 0; column < field.getWidth() && rules.getState() == GameState::Playing; column++)
+        {
+            const auto [number, state] = field.getTile(row, column);
+            if (state != TileState::Open || number == 0)
+            {
+                continue;
+            }
+
+            const auto [closed, flagged] = countNeighborhood(field, row, column);
+            if (closed == 0)
+            {
+                continue;
+            }
+            if (flagged == number)
+            {
+                // Every flag is proven, so the chord only opens safe tiles
+                rules.leftClick(row, column);
+                result.clicks++;
+                progress = true;
+            } else if (flagged + closed == number)
+            {
+                for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, field.getHeight() - 1);
+                     blockRow++)
+                {
+                    for (int blockColumn = std::max(column - 1, 0);
+                         blockColumn <= std::min(column + 1, field.getWidth() - 1); blockColumn++)
+                    {
+                        if (field.getTile(blockRow, blockColumn).state == TileState::Closed)
+                        {
+                            rules.rightClick(blockRow, blockColumn);
+                            result.flags++;
+                        }
+                    }
+                }
+                progress = true;
+            }
+        }
+    }
+    return progress;
+}
+
+void guess(MineField& field, GameRules& rules, FrameArena& arena, SolveResult& result)
+{
+    const int               width  = field.getWidth();
+    const int               height = field.getHeight();
+    const FrameArena::Scope scope(arena);
+
+    // A tile next to numbers is at least as risky as its riskiest number says, any other tile gets the average risk of
+    // all closed tiles
+    float* risk = arena.allocate<float>(static_cast<std::size_t>(width) * height);
+    std::fill_n(risk, static_cast<std::size_t>(width) * height, -1.F);
+
+    int closedCount = 0;
+    for (int row = 0; row < height; row++)
+    {
+        for (int column = 0; column < width; column++)
+        {
+            const auto [number, state] = field.getTile(row, column);
+            closedCount += state == TileState::Closed ? 1 : 0;
+            if (state != TileState::Open || number == 0)
+            {
+                continue;
+            }
+
+            const auto [closed, flagged] = countNeighborhood(field, row, column);
+            if (closed == 0)
+            {
+                continue;
+            }
+            const float numberRisk = static_cast<float>(number - flagged) / static_cast<float>(closed);
+            for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, height - 1); blockRow++)
+            {
+                for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, width - 1);
+                     blockColumn++)
+                {
+                    float& tileRisk = risk[blockColumn + blockRow * width];
+                    tileRisk        = std::max(tileRisk, numberRisk);
+                }
+            }
+        }
+    }
+
+    const float averageRisk = static_cast<float>(rules.getBombCount()) / static_cast<float>(std::max(closedCount, 1));
+
+    int   bestRow    = -1;
+    int   bestColumn = -1;
+    float bestRisk   = 2.F;
+    for (int row = 0; row < height; row++)
+    {
+        for (int column = 0; column < width; column++)
+        {
+            if (field.getTile(row, column).state != TileState::Closed)
+            {
+                continue;
+            }
+            const float tileRisk = risk[column + row * width] < 0.F ? averageRisk : risk[column + row * width];
+            if (tileRisk < bestRisk)
+            {
+                bestRisk   = tileRisk;
+                bestRow    = row;
+                bestColumn = column;
+            }
+        }
+    }
+
+    if (bestRow >= 0)
+    {
+        rules.leftClick(bestRow, bestColumn);
+        result.clicks++;
+        result.guesses++;
+    }
+}
+
+} // namespace
+
+namespace MineSolver {
+
+auto solve(MineField& field, FrameArena& arena) -> SolveResult
+{
+    WS_PROFILE_FUNCTION();
+    GameRules rules(arena);
+    rules.start(field);
+
+    SolveResult result{GameState::Playing, 0, 0, 0};
+
+    rules.leftClick(field.getHeight() / 2, field.getWidth() / 2);
+    result.clicks++;
+    result.guesses++;
+
+    while (rules.getState() == GameState::Playing)
+    {
+        if (!deduce(field, rules, result))
+        {
+            guess(field, rules, arena, result);
+        }
+    }
+    result.state = rules.getState();
+    return result;
+}
+
+} // namespace MineSolver
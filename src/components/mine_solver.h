@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_MINE_SOLVER_H
+#define WS_COMPONENTS_MINE_SOLVER_H
+
+#include "components/game_rules.h"
+
+class FrameArena;
+class MineField;
+
+struct SolveResult
+{
+    GameState state;
+    int       clicks;  // Left clicks, guesses included
+    int       flags;   // Right clicks
+    int       guesses; // Clicks no deduction proved safe
+};
+
+// Plays a game on the field with only what a player sees: the numbers of open tiles and the bomb count. Tiles that
+// single number deductions prove safe are opened and proven bombs flagged, otherwise the tile with the lowest
+// estimated risk is guessed. The first click goes to the center.
+namespace MineSolver {
+
+[[nodiscard]] auto solve(MineField& field, FrameArena& arena) -> SolveResult;
+
+} // namespace MineSolver
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_RENDER_BACKEND_H
+#define WS_COMPONENTS_RENDER_BACKEND_H
+
+#include <raylib.h>
+
+// Everything the screens, themes and overlays draw or upload goes through here, so the same frames can run on a
+// backend without a window (see NullRenderBackend). The functions mirror their raylib and raygui counterparts.
+class IRenderBackend
+{
+public:
+    virtual ~IRenderBackend() = default;
+
+    // Frame
+    virtual void beginFrame(const Color& clearColor) = 0;
+    virtual void endFrame()                          = 0;
+
+    [[nodiscard]] virtual auto getScreenWidth() const -> int  = 0;
+    [[nodiscard]] virtual auto getScreenHeight() const -> int = 0;
+    // Of the monitor showing the window, 0 if unknown
+    [[nodiscard]] virtual auto getRefreshRate() const -> int = 0;
+    [[nodiscard]] virtual auto isWindowFocused() const -> bool = 0;
+    [[nodiscard]] virtual auto isWindowResized() const -> bool = 0;
+    // Draw and widget calls since beginFrame(), before raylib batches them
+    [[nodiscard]] virtual auto getDrawCount() const -> int = 0;
+
+    // Resources, main thread only. Unloading empty resources does nothing.
+    [[nodiscard]] virtual auto loadTexture(const Image& image) -> Texture2D = 0;
+    virtual void updateTexture(const Texture2D& texture, const Rectangle& area, const void* pixels) = 0;
+    virtual void setTextureFilter(const Texture2D& texture, int filter)                             = 0;
+    virtual void unloadTexture(const Texture2D& texture)                                            = 0;
+    // Frees the glyph data together with the atlas
+    virtual void unloadFont(const Font& font) = 0;
+
+    // Compiled together with raylib's default vertex shader
+    [[nodiscard]] virtual auto loadShader(const char* fragmentCode) -> Shader = 0;
+    // False if compiling failed and raylib fell back to its default shader
+    [[nodiscard]] virtual auto isShaderSupported(const Shader& shader) const -> bool                  = 0;
+    [[nodiscard]] virtual auto getShaderLocation(const Shader& shader, const char* name) const -> int = 0;
+    virtual void               unloadShader(const Shader& shader)                                    = 0;
+
+    // Drawing
+    virtual void drawTexture(const Texture2D& texture, const Rectangle& source, const Rectangle& destination,
+                             const Color& tint) = 0;
+    virtual void drawText(const Font& font, const char* text, const Vector2& position, float fontSize, float spacing,
+                          const Color& color)   = 0;
+    virtual void drawRectangle(const Rectangle& rectangle, const Color& color)          = 0;
+    virtual void drawLine(const Vector2& start, const Vector2& end, const Color& color) = 0;
+
+    virtual void beginCamera(const Camera2D& camera) = 0;
+    virtual void endCamera()                         = 0;
+    virtual void beginShader(const Shader& shader)   = 0;
+    virtual void endShader()                         = 0;
+
+    virtual void setShaderValue(const Shader& shader, int location, const void* value, int uniformType) = 0;
+    virtual void setShaderTexture(const Shader& shader, int location, const Texture2D& texture)         = 0;
+
+    // Raygui widgets in the style applied by the current theme, true when clicked
+    [[nodiscard]] virtual auto button(const Rectangle& bounds, const char* text) -> bool          = 0;
+    virtual void               label(const Rectangle& bounds, const char* text)                   = 0;
+    virtual void               checkBox(const Rectangle& bounds, const char* text, bool& checked) = 0;
+    virtual void               progressBar(const Rectangle& bounds, float progress)               = 0;
+    // True when clicked into or out of edit mode
+    [[nodiscard]] virtual auto spinner(const Rectangle& bounds, const char* text, int& value, int minValue,
+                                       int maxValue, bool editMode) -> bool = 0;
+};
+
+#endif
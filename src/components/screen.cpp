@@ -34,4 +34,13 @@ Screen::Screen(Wyrmsweeper* game)
 
 void Screen::update() {}
 
-void Screen::render() {}
\ No newline at end of file
+void Screen::render() {}
+
+void Screen::pause() {}
+
+void Screen::resume() {}
+
+auto Screen::getRedrawTimeout() const -> double
+{
+    return -1.0;
+}
@@ -37,6 +37,14 @@ public:
 
     virtual void update();
     virtual void render();
+
+    // Called when another screen is pushed on top of this one and when it is uncovered again. A covered screen keeps
+    // its state but is neither updated nor rendered.
+    virtual void pause();
+    virtual void resume();
+
+    // Seconds until the screen changes without any input, negative if it only changes on input
+    [[nodiscard]] virtual auto getRedrawTimeout() const -> double;
 protected:
     Wyrmsweeper* _game; // NOLINT
 };
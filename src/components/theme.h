@@ -27,11 +27,23 @@
 
 #include <raylib.h>
 
+#include "components/tile_render_descriptor.h"
+#include "gui/digit_strip.h"
+
 class ITheme
 {
 public:
     virtual ~ITheme() = default;
 
+    // Loading, driven by ThemeManager
+    // Decodes all assets into CPU memory, returns false if they are unusable. Runs on a worker thread so it must not
+    // touch the GPU or raygui.
+    [[nodiscard]] virtual auto decode() -> bool = 0;
+    // Uploads the next decoded asset on the main thread, returns false once everything is uploaded
+    [[nodiscard]] virtual auto uploadNext() -> bool = 0;
+    // Applies global state like the raygui style when the theme becomes the current one
+    virtual void apply() const = 0;
+
     // Asset info
     [[nodiscard]] virtual auto getTileSize() const -> int = 0;
 
@@ -39,6 +51,13 @@ public:
     [[nodiscard]] virtual auto getSpriteSheet() const -> const Texture2D& = 0;
     [[nodiscard]] virtual auto getBackground() const -> const Texture2D&  = 0;
     [[nodiscard]] virtual auto getFont() const -> const Font&             = 0;
+    [[nodiscard]] virtual auto getDigitStrip() const -> const DigitStrip& = 0;
+
+    // Fetched once per frame by the field renderer instead of querying the theme per tile
+    [[nodiscard]] virtual auto getTileRenderDescriptor() const -> const TileRenderDescriptor& = 0;
+
+    // Shader that has to be active while drawing with getFont() or getDigitStrip()
+    [[nodiscard]] virtual auto getFontShader() const -> const Shader& = 0;
 
     // Colors
     [[nodiscard]] virtual auto getFontColor() const -> const Color = 0;
@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "tile_render_descriptor.h"
+
+auto makeTileRenderDescriptor(const Texture2D& spriteSheet, const int tileSize) -> TileRenderDescriptor
+{
+    TileRenderDescriptor descriptor{};
+    descriptor.texture  = spriteSheet;
+    descriptor.tileSize = tileSize;
+
+    const auto size = static_cast<float>(tileSize);
+    for (int packed = 0; packed < PACKED_TILE_COUNT; packed++)
+    {
+        const auto state  = static_cast<TileState>(packed >> 4);
+        const int  number = packed & 0xF;
+
+        int sprite = number;
+        if (state == TileState::Closed)
+        {
+            sprite = CLOSED_NUM;
+        } else if (state == TileState::Flagged)
+        {
+            sprite = FLAG_NUM;
+        }
+
+        descriptor.sources[packed] = {static_cast<float>(sprite) * size, 0.F, size, size};
+    }
+    return descriptor;
+}
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_COMPONENTS_TILE_RENDER_DESCRIPTOR_H
+#define WS_COMPONENTS_TILE_RENDER_DESCRIPTOR_H
+
+#include <array>
+#include <raylib.h>
+
+#include "components/mine_field.h"
+
+constexpr int TILE_SPRITE_COUNT = 12; // Numbers 0-8, bomb, closed tile and flag
+constexpr int PACKED_TILE_COUNT = (static_cast<int>(TileState::Flagged) + 1) << 4;
+
+// Everything needed to draw a tile. Themes publish it once after loading so the field renderer only indexes a table.
+struct TileRenderDescriptor
+{
+    Texture2D                                texture;
+    int                                      tileSize;
+    std::array<Rectangle, PACKED_TILE_COUNT> sources; // Sprite sheet cell of every packTile() value
+};
+
+[[nodiscard]] auto makeTileRenderDescriptor(const Texture2D& spriteSheet, int tileSize) -> TileRenderDescriptor;
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "allocation_auditor.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <raylib.h>
+
+namespace {
+
+// Plain thread locals without constructors, operator new can run before or during their thread's initialization
+struct AllocationState
+{
+    uint64_t count;
+    uint64_t bytes;
+    uint64_t violations; // Allocations inside a guard without a permit
+    int      guards;
+    int      permits;
+};
+
+thread_local AllocationState t_state{};
+
+} // namespace
+
+#ifdef WS_DEBUG_BUILD
+
+// The other forms of operator new and delete forward to these two, aligned allocations are not counted
+auto operator new(const std::size_t size) -> void*
+{
+    t_state.count++;
+    t_state.bytes += size;
+    if (t_state.guards > 0 && t_state.permits == 0)
+    {
+        t_state.violations++;
+    }
+
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+#endif
+
+namespace AllocationAuditor {
+
+auto isEnabled() -> bool
+{
+#ifdef WS_DEBUG_BUILD
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto getThreadCounts() -> AllocationCounts
+{
+    return {t_state.count, t_state.bytes};
+}
+
+} // namespace AllocationAuditor
+
+ScopedAllocationGuard::ScopedAllocationGuard(const char* name)
+    : _name(name)
+    , _violations(t_state.violations)
+{
+    t_state.guards++;
+}
+
+ScopedAllocationGuard::~ScopedAllocationGuard()
+{
+    t_state.guards--;
+    if (const uint64_t violations = t_state.violations - _violations; violations > 0)
+    {
+        TraceLog(LOG_ERROR, "%s allocated %llu times, it has to be allocation free", _name,
+                 static_cast<unsigned long long>(violations));
+        assert(false && "Allocation inside ScopedAllocationGuard");
+    }
+}
+
+ScopedAllocationPermit::ScopedAllocationPermit()
+{
+    t_state.permits++;
+}
+
+ScopedAllocationPermit::~ScopedAllocationPermit()
+{
+    t_state.permits--;
+}
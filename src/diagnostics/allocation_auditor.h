@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_ALLOCATION_AUDITOR_H
+#define WS_DIAGNOSTICS_ALLOCATION_AUDITOR_H
+
+#include <cstdint>
+
+struct AllocationCounts
+{
+    uint64_t count;
+    uint64_t bytes;
+};
+
+// Counts the heap allocations of every thread through replaced global operator new and delete. Only debug builds
+// replace them, release builds always report zero.
+namespace AllocationAuditor {
+
+[[nodiscard]] auto isEnabled() -> bool;
+// Running totals of the calling thread
+[[nodiscard]] auto getThreadCounts() -> AllocationCounts;
+
+} // namespace AllocationAuditor
+
+// Code that must not allocate, like the update and render of a running game. An allocation on this thread inside the
+// scope is reported when the scope ends and fails an assertion.
+class ScopedAllocationGuard final
+{
+public:
+    explicit ScopedAllocationGuard(const char* name);
+    ~ScopedAllocationGuard();
+
+    ScopedAllocationGuard(const ScopedAllocationGuard&)                    = delete;
+    auto operator=(const ScopedAllocationGuard&) -> ScopedAllocationGuard& = delete;
+private:
+    const char* _name;
+    uint64_t    _violations;
+};
+
+// Allows allocations inside a guard, for rare events like screen changes
+class ScopedAllocationPermit final
+{
+public:
+     ScopedAllocationPermit();
+    ~ScopedAllocationPermit();
+
+    ScopedAllocationPermit(const ScopedAllocationPermit&)                    = delete;
+    auto operator=(const ScopedAllocationPermit&) -> ScopedAllocationPermit& = delete;
+};
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "flight_recorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <raylib.h>
+#include <utility>
+#include <vector>
+
+#include "app/game_clock.h"
+#include "app/job_system.h"
+#include "diagnostics/profiler.h"
+
+constexpr double DUMP_WINDOW   = 5.0;  // Seconds of frames written before the hitch
+constexpr double DUMP_COOLDOWN = 10.0; // A burst of slow frames only writes one file
+#ifdef WS_PROFILE
+constexpr std::size_t MAX_DUMP_SCOPES = 4096; // Most recent trace events written with a hitch
+#endif
+
+FlightRecorder::FlightRecorder(JobSystem& jobs, const GameClock& clock)
+    : _jobs(jobs)
+    , _clock(clock)
+    , _directory()
+    , _hitchThreshold(0.0)
+    , _lastDump(-DUMP_COOLDOWN)
+    , _dumpCount(0)
+    , _frames()
+    , _actions()
+    , _board()
+    , _boardActionStart(0)
+    , _actionCount(0)
+{}
+
+void FlightRecorder::setOutput(std::string directory, const double hitchThreshold)
+{
+    _directory      = std::move(directory);
+    _hitchThreshold = hitchThreshold;
+    if (!_directory.empty())
+    {
+        TraceLog(LOG_INFO, "Writing frames slower than %.1f ms to %s", hitchThreshold * 1000.0, _directory.c_str());
+    }
+}
+
+void FlightRecorder::recordFrame(const FrameTimings& timings)
+{
+    const double time = _clock.getTime();
+    _frames.push({time, timings});
+
+    if (!_directory.empty() && timings.duration > _hitchThreshold && time - _lastDump > DUMP_COOLDOWN)
+    {
+        _lastDump = time;
+        dump(time, timings.duration);
+    }
+}
+
+void FlightRecorder::recordBoard(const int width, const int height, const int bombCount, const unsigned int seed,
+                                 const bool autoChord)
+{
+    _board            = {_clock.getTime(), width, height, bombCount, seed, autoChord};
+    _boardActionStart = _actionCount;
+}
+
+void FlightRecorder::recordAction(const FlightAction action, const int row, const int column, const bool autoChord)
+{
+    _actions.push({_clock.getTime(), action, row, column, autoChord});
+    _actionCount++;
+}
+
+void FlightRecorder::dump(const double time, const float duration)
+{
+    // Formatting happens here so the worker does not read the rings while the main thread keeps writing
+    std::vector<std::string> lines;
+    lines.emplace_back(TextFormat("hitch %.3f %.2f", time, duration * 1000.F));
+    if (_board.width > 0)
+    {
+        lines.emplace_back(TextFormat("board %.3f %i %i %i %u %i", _board.time, _board.width, _board.height,
+                                      _board.bombCount, _board.seed, _board.autoChord ? 1 : 0));
+    }
+
+    // All actions of the board if the ring still holds them, so the board can be replayed from its seed. A long game
+    // can overflow the ring, the lost actions are counted so a replay refuses the recording instead of diverging.
+    // The setting can be toggled in the pause menu, a change is written before the first action using it
+    const std::size_t boardActions = _actionCount - _boardActionStart;
+    const std::size_t actionCount  = std::min(boardActions, _actions.getSize());
+    if (actionCount < boardActions)
+    {
+        lines.emplace_back(TextFormat("truncated %zu", boardActions - actionCount));
+    }
+    bool autoChord = _board.autoChord;
+    for (std::size_t age = actionCount; age > 0; age--)
+    {
+        const ActionEntry& entry = _actions.getRecent(age - 1);
+        if (entry.autoChord != autoChord)
+        {
+            autoChord = entry.autoChord;
+            lines.emplace_back(TextFormat("auto-chord %.3f %i", entry.time, autoChord ? 1 : 0));
+        }
+        lines.emplace_back(TextFormat("action %.3f %s %i %i", entry.time,
+                                      entry.action == FlightAction::LeftClick ? "left" : "right", entry.row,
+                                      entry.column));
+    }
+
+    std::size_t frameCount = 0;
+    while (frameCount < _frames.getSize() && time - _frames.getRecent(frameCount).time <= DUMP_WINDOW)
+    {
+        frameCount++;
+    }
+    for (std::size_t age = frameCount; age > 0; age--)
+    {
+        const auto& [frameTime, timings] = _frames.getRecent(age - 1);
+        const auto phase                 = [&timings](const FramePhase framePhase) {
+            return timings.phases[static_cast<std::size_t>(framePhase)] * 1000.F;
+        };
+        lines.emplace_back(TextFormat("frame %.3f %.2f update %.2f render %.2f field %.2f gui %.2f present %.2f "
+                                      "idle %.2f draws %i tiles %i",
+                                      frameTime, timings.duration * 1000.F, phase(FramePhase::Update),
+                                      phase(FramePhase::Render), phase(FramePhase::Field), phase(FramePhase::Gui),
+                                      phase(FramePhase::Present), timings.idleUsed * 1000.F, timings.drawCalls,
+                                      timings.tilesDrawn));
+    }
+
+#ifdef WS_PROFILE
+    // Trace events of the main thread in the same window, so the slow frame shows which flood fill, chord or upload
+    // took the time. Their clock is a different one, so they are placed by their age at the end of the slow frame.
+    const int64_t now = Profiler::now();
+    for (const Profiler::Event& event :
+         Profiler::getRecentEvents(now - static_cast<int64_t>(DUMP_WINDOW * 1e9), MAX_DUMP_SCOPES))
+    {
+        lines.emplace_back(TextFormat("scope %.3f %.3f %s", time - static_cast<double>(now - event.start) / 1e9,
+                                      static_cast<double>(event.end - event.start) / 1e6, event.name));
+    }
+#endif
+
+    std::string path =
+        _directory + TextFormat("/hitch_%lld_%03i.txt", static_cast<long long>(std::time(nullptr)), _dumpCount++);
+    _jobs.dispatch([path = std::move(path), lines = std::move(lines)] {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        if (file == nullptr)
+        {
+            TraceLog(LOG_WARNING, "Failed to write flight recording %s", path.c_str());
+            return;
+        }
+
+        std::fputs("# Wyrmsweeper flight recording, times in seconds, durations in milliseconds\n", file);
+        for (const std::string& line : lines)
+        {
+            std::fputs(line.c_str(), file);
+            std::fputc('\n', file);
+        }
+        std::fclose(file);
+        TraceLog(LOG_INFO, "Wrote flight recording %s", path.c_str());
+    });
+}
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_FLIGHT_RECORDER_H
+#define WS_DIAGNOSTICS_FLIGHT_RECORDER_H
+
+#include <cstdint>
+#include <string>
+
+#include "diagnostics/frame_stats.h"
+#include "diagnostics/ring_buffer.h"
+
+class GameClock;
+class JobSystem;
+
+enum class FlightAction : uint8_t
+{
+    LeftClick = 0,
+    RightClick
+};
+
+// Always records the timings of recent frames and the input of the current board. Once a frame takes longer than the
+// hitch threshold the last seconds are written to a text file on a worker, together with the board seed, the auto
+// chord setting and every action taken on it, so a stutter can be replayed with the same rules. Builds with WS_PROFILE
+// also write the trace events of the main thread. Writing is off unless a directory is set. Main thread only.
+class FlightRecorder final
+{
+public:
+    FlightRecorder() = delete;
+    FlightRecorder(JobSystem& jobs, const GameClock& clock);
+
+    // An empty directory only records without ever writing
+    void setOutput(std::string directory, double hitchThreshold);
+
+    void recordFrame(const FrameTimings& timings);
+    void recordBoard(int width, int height, int bombCount, unsigned int seed, bool autoChord);
+    void recordAction(FlightAction action, int row, int column, bool autoChord);
+private:
+    struct FrameEntry
+    {
+        double       time;
+        FrameTimings timings;
+    };
+
+    struct ActionEntry
+    {
+        double       time;
+        FlightAction action;
+        int          row;
+        int          column;
+        bool         autoChord;
+    };
+
+    struct BoardEntry
+    {
+        double       time;
+        int          width;
+        int          height;
+        int          bombCount;
+        unsigned int seed;
+        bool         autoChord;
+    };
+
+    void dump(double time, float duration);
+private:
+    JobSystem&       _jobs;
+    const GameClock& _clock;
+
+    std::string _directory;
+    double      _hitchThreshold;
+    double      _lastDump;
+    int         _dumpCount;
+
+    RingBuffer<FrameEntry, 1024>  _frames;
+    RingBuffer<ActionEntry, 4096> _actions;
+    BoardEntry                    _board;
+    std::size_t                   _boardActionStart; // Number of actions recorded before the board started
+    std::size_t                   _actionCount;
+};
+
+#endif
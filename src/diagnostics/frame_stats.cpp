@@ -0,0 +1,256 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "frame_stats.h"
+
+#include <algorithm>
+#include <cassert>
+#include <raylib.h>
+
+#include "app/frame_scheduler.h"
+#include "components/render_backend.h"
+#include "diagnostics/allocation_auditor.h"
+
+constexpr double PERCENTILE_WINDOW   = 5.0; // Seconds of frames the percentiles are computed from
+constexpr double PERCENTILE_INTERVAL = 0.5;
+
+constexpr int   OVERLAY_WIDTH       = 330;
+constexpr int   OVERLAY_PADDING     = 8;
+constexpr int   OVERLAY_FONT_SIZE   = 10;
+constexpr float OVERLAY_SPACING     = 1.F; // Same as DrawText() with the default font
+constexpr int   OVERLAY_LINE_HEIGHT = 14;
+constexpr int   OVERLAY_LINE_COUNT  = 6;
+constexpr int   GRAPH_HEIGHT        = 40;
+constexpr int   GRAPH_BAR_WIDTH     = 2;
+constexpr float GRAPH_MAX_DURATION  = 1.F / 30.F;
+constexpr float TARGET_DURATION     = 1.F / 60.F;
+
+constexpr auto phaseIndex(const FramePhase phase) -> std::size_t
+{
+    return static_cast<std::size_t>(phase);
+}
+
+constexpr auto toMilliseconds(const float seconds) -> float
+{
+    return seconds * 1000.F;
+}
+
+FrameStats::FrameStats()
+    : _visible(false)
+    , _start(Clock::now())
+    , _frameStart(0.0)
+    , _frameAllocationStart(0)
+    , _phaseStarts()
+    , _phaseAllocationStarts()
+    , _current()
+    , _last()
+    , _samples()
+    , _sortBuffer()
+    , _lastPercentileUpdate(0.0)
+    , _p50(0.F)
+    , _p95(0.F)
+    , _p99(0.F)
+{
+    _sortBuffer.reserve(1024);
+}
+
+void FrameStats::toggle()
+{
+    _visible = !_visible;
+}
+
+auto FrameStats::isVisible() const -> bool
+{
+    return _visible;
+}
+
+void FrameStats::beginFrame()
+{
+    _frameStart           = now();
+    _frameAllocationStart = AllocationAuditor::getThreadCounts().count;
+    _current              = {};
+}
+
+void FrameStats::endFrame(const FrameScheduler& frames)
+{
+    const double time = now();
+
+    _current.duration    = static_cast<float>(time - _frameStart);
+    _current.allocations = static_cast<int>(AllocationAuditor::getThreadCounts().count - _frameAllocationStart);
+    _current.idleBudget = static_cast<float>(frames.getBudget());
+    _current.idleUsed   = static_cast<float>(frames.getUsedTime());
+    _last               = _current;
+
+    _samples.push({time, _current.duration});
+    if (time - _lastPercentileUpdate >= PERCENTILE_INTERVAL)
+    {
+        updatePercentiles(time);
+    }
+}
+
+void FrameStats::beginPhase(const FramePhase phase)
+{
+    assert(phase != FramePhase::Count);
+    _phaseStarts[phaseIndex(phase)]           = now();
+    _phaseAllocationStarts[phaseIndex(phase)] = AllocationAuditor::getThreadCounts().count;
+}
+
+void FrameStats::endPhase(const FramePhase phase)
+{
+    assert(phase != FramePhase::Count);
+    _current.phases[phaseIndex(phase)] += static_cast<float>(now() - _phaseStarts[phaseIndex(phase)]);
+    _current.phaseAllocations[phaseIndex(phase)] +=
+        static_cast<int>(AllocationAuditor::getThreadCounts().count - _phaseAllocationStarts[phaseIndex(phase)]);
+}
+
+void FrameStats::setDrawCalls(const int count)
+{
+    _current.drawCalls = count;
+}
+
+void FrameStats::addTilesDrawn(const int count)
+{
+    _current.tilesDrawn += count;
+}
+
+void FrameStats::render(IRenderBackend& renderer) const
+{
+    if (!_visible)
+    {
+        return;
+    }
+
+    const auto phase = [this](const FramePhase framePhase) {
+        return toMilliseconds(_last.phases[phaseIndex(framePhase)]);
+    };
+
+    const int posX = renderer.getScreenWidth() - OVERLAY_WIDTH - OVERLAY_PADDING;
+    int       posY = OVERLAY_PADDING;
+
+    const int lineCount = OVERLAY_LINE_COUNT + (AllocationAuditor::isEnabled() ? 1 : 0);
+    const int height    = lineCount * OVERLAY_LINE_HEIGHT + GRAPH_HEIGHT + 3 * OVERLAY_PADDING;
+    renderer.drawRectangle({static_cast<float>(posX - OVERLAY_PADDING), 0.F,
+                            static_cast<float>(OVERLAY_WIDTH + 2 * OVERLAY_PADDING), static_cast<float>(height)},
+                           Fade(BLACK, 0.7F));
+
+    const auto line = [&renderer, posX, &posY](const char* text) {
+        const Vector2 position{static_cast<float>(posX), static_cast<float>(posY)};
+        renderer.drawText(GetFontDefault(), text, position, OVERLAY_FONT_SIZE, OVERLAY_SPACING, RAYWHITE);
+        posY += OVERLAY_LINE_HEIGHT;
+    };
+
+    line(TextFormat("Frame %.2f ms   p50 %.2f   p95 %.2f   p99 %.2f", toMilliseconds(_last.duration),
+                    toMilliseconds(_p50), toMilliseconds(_p95), toMilliseconds(_p99)));
+    line(TextFormat("Update %.2f ms", phase(FramePhase::Update)));
+    line(TextFormat("Render %.2f ms   field %.2f   gui %.2f", phase(FramePhase::Render), phase(FramePhase::Field),
+                    phase(FramePhase::Gui)));
+    line(TextFormat("Present %.2f ms", phase(FramePhase::Present)));
+    line(TextFormat("Idle work %.2f / %.2f ms", toMilliseconds(_last.idleUsed), toMilliseconds(_last.idleBudget)));
+    line(TextFormat("Draw calls %i   tiles %i", _last.drawCalls, _last.tilesDrawn));
+    if (AllocationAuditor::isEnabled())
+    {
+        const auto allocations = [this](const FramePhase framePhase) {
+            return _last.phaseAllocations[phaseIndex(framePhase)];
+        };
+        line(TextFormat("Allocations %i   update %i   render %i   present %i", _last.allocations,
+                        allocations(FramePhase::Update), allocations(FramePhase::Render),
+                        allocations(FramePhase::Present)));
+    }
+
+    renderGraph(renderer, posX, posY + OVERLAY_PADDING);
+}
+
+auto FrameStats::getLastFrame() const -> const FrameTimings&
+{
+    return _last;
+}
+
+auto FrameStats::now() const -> double
+{
+    return std::chrono::duration<double>(Clock::now() - _start).count();
+}
+
+void FrameStats::updatePercentiles(const double time)
+{
+    _lastPercentileUpdate = time;
+
+    _sortBuffer.clear();
+    for (std::size_t age = 0; age < _samples.getSize(); age++)
+    {
+        const FrameSample& sample = _samples.getRecent(age);
+        if (time - sample.time > PERCENTILE_WINDOW)
+        {
+            break;
+        }
+        _sortBuffer.push_back(sample.duration);
+    }
+    if (_sortBuffer.empty())
+    {
+        return;
+    }
+
+    // Only three ranks are needed, so partial selection is enough instead of sorting the whole window
+    const auto percentile = [this](const float rank) {
+        const auto nth = _sortBuffer.begin() + static_cast<std::ptrdiff_t>(
+                                                   rank * static_cast<float>(_sortBuffer.size() - 1));
+        std::nth_element(_sortBuffer.begin(), nth, _sortBuffer.end());
+        return *nth;
+    };
+    _p50 = percentile(0.50F);
+    _p95 = percentile(0.95F);
+    _p99 = percentile(0.99F);
+}
+
+void FrameStats::renderGraph(IRenderBackend& renderer, const int posX, const int posY) const
+{
+    // Newest frame on the right, the line marks a 60 Hz frame
+    const std::size_t barCount = std::min<std::size_t>(_samples.getSize(), OVERLAY_WIDTH / GRAPH_BAR_WIDTH);
+    for (std::size_t age = 0; age < barCount; age++)
+    {
+        const float duration = _samples.getRecent(age).duration;
+        const int   height   = static_cast<int>(std::min(duration / GRAPH_MAX_DURATION, 1.F) * GRAPH_HEIGHT);
+        const int   barX     = posX + OVERLAY_WIDTH - static_cast<int>(age + 1) * GRAPH_BAR_WIDTH;
+
+        const Rectangle bar{static_cast<float>(barX), static_cast<float>(posY + GRAPH_HEIGHT - height),
+                            static_cast<float>(GRAPH_BAR_WIDTH), static_cast<float>(height)};
+        renderer.drawRectangle(bar, duration > TARGET_DURATION ? ORANGE : LIME);
+    }
+
+    const int targetY = posY + GRAPH_HEIGHT - static_cast<int>(TARGET_DURATION / GRAPH_MAX_DURATION * GRAPH_HEIGHT);
+
+    const Vector2 start{static_cast<float>(posX), static_cast<float>(targetY)};
+    renderer.drawLine(start, {start.x + OVERLAY_WIDTH, start.y}, Fade(RAYWHITE, 0.5F));
+}
+
+ScopedFramePhase::ScopedFramePhase(FrameStats& stats, const FramePhase phase)
+    : _stats(stats)
+    , _phase(phase)
+{
+    _stats.beginPhase(_phase);
+}
+
+ScopedFramePhase::~ScopedFramePhase()
+{
+    _stats.endPhase(_phase);
+}
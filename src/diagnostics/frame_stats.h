@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_FRAME_STATS_H
+#define WS_DIAGNOSTICS_FRAME_STATS_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "diagnostics/ring_buffer.h"
+
+class FrameScheduler;
+class IRenderBackend;
+
+// Field and GUI are measured inside Render
+enum class FramePhase : uint8_t
+{
+    Update = 0,
+    Render,
+    Field,
+    Gui,
+    Present,
+    Count
+};
+
+// Timings in seconds and counters of a single frame
+struct FrameTimings
+{
+    std::array<float, static_cast<std::size_t>(FramePhase::Count)> phases{};
+    // Main thread heap allocations, only counted in debug builds
+    std::array<int, static_cast<std::size_t>(FramePhase::Count)> phaseAllocations{};
+
+    int   allocations = 0;
+    int   drawCalls   = 0;
+    int   tilesDrawn  = 0;
+    float duration    = 0.F;
+    float idleBudget  = 0.F;
+    float idleUsed    = 0.F;
+};
+
+// Per frame timings and counters of the main loop, drawn as an overlay on top of everything when visible. Frame times
+// are kept in a ring buffer and the percentiles are only recomputed a few times per second, so recording costs a few
+// clock reads per frame and the overlay itself a handful of draw calls.
+class FrameStats final
+{
+public:
+    FrameStats();
+
+    void toggle();
+    [[nodiscard]] auto isVisible() const -> bool;
+
+    // Called by the main loop
+    void beginFrame();
+    void endFrame(const FrameScheduler& frames);
+
+    void beginPhase(FramePhase phase);
+    void endPhase(FramePhase phase);
+
+    // Draw calls issued this frame, taken from the render backend after everything is drawn
+    void setDrawCalls(int count);
+    void addTilesDrawn(int count);
+
+    // Draws the overlay, uses the timings of the previous frame
+    void render(IRenderBackend& renderer) const;
+
+    [[nodiscard]] auto getLastFrame() const -> const FrameTimings&;
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct FrameSample
+    {
+        double time;     // Seconds since the stats were created
+        float  duration; // Seconds
+    };
+
+    [[nodiscard]] auto now() const -> double;
+    void               updatePercentiles(double time);
+
+    void renderGraph(IRenderBackend& renderer, int posX, int posY) const;
+private:
+    bool _visible;
+
+    Clock::time_point _start;
+    double            _frameStart;
+    uint64_t          _frameAllocationStart;
+    std::array<double, static_cast<std::size_t>(FramePhase::Count)>   _phaseStarts;
+    std::array<uint64_t, static_cast<std::size_t>(FramePhase::Count)> _phaseAllocationStarts;
+
+    FrameTimings _current;
+    FrameTimings _last;
+
+    RingBuffer<FrameSample, 1024> _samples;
+    std::vector<float>            _sortBuffer; // Reused for the percentiles
+    double                        _lastPercentileUpdate;
+    float                         _p50;
+    float                         _p95;
+    float                         _p99;
+};
+
+// Measures a phase for the lifetime of the scope
+class ScopedFramePhase final
+{
+public:
+    ScopedFramePhase(FrameStats& stats, FramePhase phase);
+    ~ScopedFramePhase();
+
+    ScopedFramePhase(const ScopedFramePhase&)                    = delete;
+    auto operator=(const ScopedFramePhase&) -> ScopedFramePhase& = delete;
+private:
+    FrameStats& _stats;
+    FramePhase  _phase;
+};
+
+#endif
@@ -0,0 +1,376 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <raylib.h>
+#include <thread>
+
+namespace {
+
+constexpr std::size_t QUEUE_SIZE   = 1024; // Power of two
+constexpr std::size_t MESSAGE_SIZE = 256;
+
+enum class RecordType : uint8_t
+{
+    Formatted = 0, // text holds the message
+    Deferred,      // formatter turns format and arguments into the message
+    Large          // large holds the message
+};
+
+struct Record
+{
+    std::atomic<std::size_t> sequence;
+
+    RecordType             type;
+    int                    level;
+    double                 time;
+    const char*            format;
+    Logger::FormatFunction formatter;
+    Logger::Arguments      arguments;
+    std::string*           large;
+    char                   text[MESSAGE_SIZE];
+};
+
+// Bounded multi producer queue after Dmitry Vyukov, the sequence of a slot tells producers and the consumer whose
+// turn it is. Only the logger thread consumes.
+struct LoggerState
+{
+    std::unique_ptr<Record[]> records;
+    std::atomic<std::size_t>  enqueuePosition{0};
+    std::size_t               dequeuePosition = 0;
+
+    std::thread           thread;
+    std::atomic<bool>     running{false};
+    std::atomic<bool>     stopping{false};
+    std::atomic<bool>     waiting{false};
+    std::atomic<uint32_t> signal{0};
+
+    std::atomic<int>         level{LOG_INFO};
+    std::atomic<std::size_t> dropped{0};
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Logger thread only
+    std::string lastMessage;
+    int         lastLevel = LOG_NONE;
+    int         repeats   = 0;
+};
+
+auto getState() -> LoggerState&
+{
+    static LoggerState state;
+    return state;
+}
+
+auto getTime() -> double
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - getState().start).count();
+}
+
+auto getPrefix(const int level) -> const char*
+{
+    switch (level)
+    {
+    case LOG_TRACE:
+        return "TRACE: ";
+    case LOG_DEBUG:
+        return "DEBUG: ";
+    case LOG_INFO:
+        return "INFO: ";
+    case LOG_WARNING:
+        return "WARNING: ";
+    case LOG_ERROR:
+        return "ERROR: ";
+    case LOG_FATAL:
+        return "FATAL: ";
+    default:
+        return "";
+    }
+}
+
+void print(const int level, const double time, const char* text)
+{
+    std::fprintf(stdout, "[%9.3f] %s%s\n", time, getPrefix(level), text);
+}
+
+template <typename Fill>
+auto push(Fill fill) -> bool
+{
+    LoggerState& state    = getState();
+    std::size_t  position = state.enqueuePosition.load(std::memory_order_relaxed);
+    Record*      record   = nullptr;
+    while (true)
+    {
+        record                     = &state.records[position & (QUEUE_SIZE - 1)];
+        const std::size_t sequence = record->sequence.load(std::memory_order_acquire);
+        const auto        distance = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (distance == 0)
+        {
+            if (state.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        } else if (distance < 0)
+        {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else
+        {
+            position = state.enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    fill(*record);
+    record->sequence.store(position + 1, std::memory_order_release);
+
+    // Pairs with the fence in loggerLoop(), either the logger sees the record or this sees it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (state.waiting.load(std::memory_order_relaxed))
+    {
+        state.signal.fetch_add(1, std::memory_order_relaxed);
+        state.signal.notify_one();
+    }
+    return true;
+}
+
+auto peek() -> Record*
+{
+    LoggerState& state  = getState();
+    Record&      record = state.records[state.dequeuePosition & (QUEUE_SIZE - 1)];
+    return record.sequence.load(std::memory_order_acquire) == state.dequeuePosition + 1 ? &record : nullptr;
+}
+
+void flushRepeats()
+{
+    LoggerState& state = getState();
+    if (state.repeats > 0)
+    {
+        std::fprintf(stdout, "[%9.3f] %sLast message repeated %i times\n", getTime(), getPrefix(state.lastLevel),
+                     state.repeats);
+        state.repeats = 0;
+    }
+}
+
+void consume(Record& record)
+{
+    LoggerState& state = getState();
+
+    char        formatted[MESSAGE_SIZE];
+    const char* text = record.text;
+    if (record.type == RecordType::Deferred)
+    {
+        record.formatter(formatted, sizeof(formatted), record.format, record.arguments);
+        text = formatted;
+    } else if (record.type == RecordType::Large)
+    {
+        // Never collapsed, large messages are dumps that are wanted in full
+        flushRepeats();
+        print(record.level, record.time, record.large->c_str());
+        delete record.large;
+        state.lastMessage.clear();
+        return;
+    }
+
+    if (record.level == state.lastLevel && state.lastMessage == text)
+    {
+        state.repeats++;
+        return;
+    }
+    flushRepeats();
+    print(record.level, record.time, text);
+    state.lastMessage = text;
+    state.lastLevel   = record.level;
+}
+
+void loggerLoop()
+{
+    LoggerState& state = getState();
+    while (true)
+    {
+        if (Record* record = peek())
+        {
+            consume(*record);
+            record->sequence.store(state.dequeuePosition + QUEUE_SIZE, std::memory_order_release);
+            state.dequeuePosition++;
+            continue;
+        }
+
+        if (const std::size_t dropped = state.dropped.exchange(0, std::memory_order_relaxed); dropped > 0)
+        {
+            flushRepeats();
+            std::fprintf(stdout, "[%9.3f] WARNING: Log queue full, dropped %zu messages\n", getTime(), dropped);
+        }
+        std::fflush(stdout);
+
+        const uint32_t signal = state.signal.load(std::memory_order_relaxed);
+        state.waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (peek() == nullptr)
+        {
+            if (state.stopping.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+            state.signal.wait(signal);
+        }
+        state.waiting.store(false, std::memory_order_relaxed);
+    }
+
+    flushRepeats();
+    std::fflush(stdout);
+}
+
+void traceLogCallback(const int level, const char* format, va_list arguments)
+{
+    if (level == LOG_FATAL)
+    {
+        // Raylib only exits on its own without a callback
+        Logger::stop();
+        std::fputs(getPrefix(level), stdout);
+        std::vfprintf(stdout, format, arguments);
+        std::fputc('\n', stdout);
+        std::exit(EXIT_FAILURE);
+    }
+
+    push([level, format, &arguments](Record& record) {
+        record.type  = RecordType::Formatted;
+        record.level = level;
+        record.time  = getTime();
+
+        va_list copy;
+        va_copy(copy, arguments);
+        std::vsnprintf(record.text, sizeof(record.text), format, copy);
+        va_end(copy);
+    });
+}
+
+} // namespace
+
+namespace Logger {
+
+void start()
+{
+    LoggerState& state = getState();
+    if (state.running)
+    {
+        return;
+    }
+
+    state.records = std::make_unique<Record[]>(QUEUE_SIZE);
+    for (std::size_t i = 0; i < QUEUE_SIZE; i++)
+    {
+        state.records[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    state.enqueuePosition = 0;
+    state.dequeuePosition = 0;
+    state.stopping        = false;
+    state.running         = true;
+    state.thread          = std::thread(loggerLoop);
+
+    SetTraceLogCallback(traceLogCallback);
+}
+
+void stop()
+{
+    LoggerState& state = getState();
+    if (!state.running.exchange(false))
+    {
+        return;
+    }
+
+    SetTraceLogCallback(nullptr);
+    state.stopping = true;
+    state.signal.fetch_add(1);
+    state.signal.notify_one();
+    state.thread.join();
+}
+
+void setLevel(const int level)
+{
+    getState().level = level;
+}
+
+auto isEnabled(const int level) -> bool
+{
+    return level >= getState().level.load(std::memory_order_relaxed);
+}
+
+void write(const int level, std::string text)
+{
+    LoggerState& state = getState();
+    if (level < state.level.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    if (!state.running.load(std::memory_order_acquire))
+    {
+        print(level, getTime(), text.c_str());
+        return;
+    }
+
+    auto* large = new std::string(std::move(text));
+    if (!push([level, large](Record& record) {
+            record.type  = RecordType::Large;
+            record.level = level;
+            record.time  = getTime();
+            record.large = large;
+        }))
+    {
+        delete large;
+    }
+}
+
+void post(const int level, const char* format, const FormatFunction formatter, const Arguments& arguments)
+{
+    LoggerState& state = getState();
+    if (level < state.level.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    if (!state.running.load(std::memory_order_acquire))
+    {
+        char text[MESSAGE_SIZE];
+        formatter(text, sizeof(text), format, arguments);
+        print(level, getTime(), text);
+        return;
+    }
+
+    push([level, format, formatter, &arguments](Record& record) {
+        record.type      = RecordType::Deferred;
+        record.level     = level;
+        record.time      = getTime();
+        record.format    = format;
+        record.formatter = formatter;
+        record.arguments = arguments;
+    });
+}
+
+} // namespace Logger
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_LOGGER_H
+#define WS_DIAGNOSTICS_LOGGER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Asynchronous log. Messages go through a bounded lock-free queue to a logger thread, which adds the time and level,
+// collapses repeated messages and does the actual writing. A full queue drops messages instead of blocking.
+//
+// While running, TraceLog() is routed through the queue as well. Its arguments can not outlive the call, so those
+// messages are formatted by the caller. Logger::log() only takes numbers and string literals and leaves even the
+// formatting to the logger thread:
+//
+//     Logger::log(LOG_INFO, "Creating %ix%i mine field", width, height);
+namespace Logger {
+
+union Argument
+{
+    long long          integer;
+    unsigned long long unsignedInteger;
+    double             floating;
+    const void*        pointer;
+};
+
+constexpr std::size_t MAX_ARGUMENTS = 8;
+
+using Arguments      = std::array<Argument, MAX_ARGUMENTS>;
+using FormatFunction = void (*)(char* buffer, std::size_t size, const char* format, const Arguments& arguments);
+
+// Raylib's TraceLog() keeps working before start() and after stop(), it writes synchronously then
+void start();
+// Writes everything still queued and joins the logger thread
+void stop();
+// Messages below the level are dropped, like SetTraceLogLevel()
+void setLevel(int level);
+// False if messages of the level would be dropped anyway, to skip building expensive ones
+[[nodiscard]] auto isEnabled(int level) -> bool;
+
+template <typename... Args>
+void log(int level, const char* format, Args... arguments);
+
+// Large text like board dumps, costs one heap allocation instead of a fixed size queue slot
+void write(int level, std::string text);
+
+void post(int level, const char* format, FormatFunction formatter, const Arguments& arguments);
+
+template <typename T>
+auto packArgument(const T value) -> Argument
+{
+    Argument argument{};
+    if constexpr (std::is_pointer_v<T>)
+    {
+        argument.pointer = value;
+    } else if constexpr (std::is_floating_point_v<T>)
+    {
+        argument.floating = value;
+    } else if constexpr (std::is_signed_v<T>)
+    {
+        argument.integer = value;
+    } else
+    {
+        argument.unsignedInteger = value;
+    }
+    return argument;
+}
+
+template <typename T>
+auto unpackArgument(const Argument& argument) -> T
+{
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return static_cast<T>(argument.pointer);
+    } else if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<T>(argument.floating);
+    } else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<T>(argument.integer);
+    } else
+    {
+        return static_cast<T>(argument.unsignedInteger);
+    }
+}
+
+template <typename... Args, std::size_t... Indices>
+void formatArguments(char* buffer, const std::size_t size, const char* format, const Arguments& arguments,
+                     std::index_sequence<Indices...> /*indices*/)
+{
+    if constexpr (sizeof...(Args) == 0)
+    {
+        std::snprintf(buffer, size, "%s", format);
+    } else
+    {
+        std::snprintf(buffer, size, format, unpackArgument<Args>(arguments[Indices])...);
+    }
+}
+
+template <typename... Args>
+void log(const int level, const char* format, Args... arguments)
+{
+    static_assert(sizeof...(Args) <= MAX_ARGUMENTS);
+    static_assert(((std::is_arithmetic_v<Args> || std::is_same_v<Args, const char*> ||
+                    std::is_same_v<Args, const void*>) && ...),
+                  "Only numbers, pointers and string literals can be formatted later");
+
+    const Arguments packed{packArgument(arguments)...};
+    post(level, format,
+         [](char* buffer, const std::size_t size, const char* text, const Arguments& values) {
+             formatArguments<Args...>(buffer, size, text, values, std::index_sequence_for<Args...>());
+         },
+         packed);
+}
+
+} // namespace Logger
+
+#endif
@@ -0,0 +1,287 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "metrics.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <raylib.h>
+#include <string_view>
+#include <vector>
+
+#include "app/game_clock.h"
+#include "app/job_system.h"
+#include "diagnostics/allocation_auditor.h"
+
+#ifndef WS_PLATFORM_WINDOWS
+#    include <sys/socket.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+constexpr double EXPORT_INTERVAL = 1.0;
+
+constexpr std::string_view SOCKET_PREFIX = "unix:";
+
+#ifndef WS_PLATFORM_WINDOWS
+// A scraper closing its end must not kill the game with SIGPIPE, the send fails with EPIPE instead. Platforms without
+// MSG_NOSIGNAL set SO_NOSIGPIPE on the socket.
+#    ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#    else
+constexpr int SEND_FLAGS = 0;
+#    endif
+#endif
+
+enum class MetricType : uint8_t
+{
+    Counter = 0,
+    Gauge,
+    Maximum
+};
+
+struct MetricInfo
+{
+    const char* name;
+    const char* help;
+    MetricType  type;
+};
+
+constexpr std::array<MetricInfo, static_cast<std::size_t>(Metric::Count)> METRIC_INFOS{{
+    {"wyrmsweeper_frames_rendered", "Frames rendered by the main loop", MetricType::Counter},
+    {"wyrmsweeper_tiles_drawn", "Tiles drawn by the field renderer", MetricType::Counter},
+    {"wyrmsweeper_hit_tests", "Mouse to tile hit tests", MetricType::Counter},
+    {"wyrmsweeper_flood_fill_tiles", "Tiles visited by the empty tile flood fill", MetricType::Counter},
+    {"wyrmsweeper_chord_attempts", "Chord clicks, including automatic ones", MetricType::Counter},
+    {"wyrmsweeper_boards_generated", "Mine fields generated", MetricType::Counter},
+    {"wyrmsweeper_generation_nanoseconds", "Time spent generating mine fields", MetricType::Counter},
+    {"wyrmsweeper_jobs_run", "Jobs run by the worker threads", MetricType::Counter},
+    {"wyrmsweeper_startup_nanoseconds", "Time from launch to the first presented frame", MetricType::Gauge},
+    {"wyrmsweeper_auto_chord_depth", "Deepest auto chord recursion since the last export", MetricType::Maximum},
+}};
+
+// Only the owning thread writes, so a relaxed load and store replace the locked read-modify-write
+struct alignas(64) ThreadCounters
+{
+    std::array<std::atomic<uint64_t>, static_cast<std::size_t>(Metric::Count)> values{};
+};
+
+// Counters outlive their threads, so the totals never go backwards when a worker exits
+struct Registry
+{
+    std::mutex                                   mutex;
+    std::vector<std::unique_ptr<ThreadCounters>> counters;
+};
+
+auto getRegistry() -> Registry&
+{
+    static Registry registry;
+    return registry;
+}
+
+thread_local ThreadCounters* t_counters = nullptr;
+
+auto getThreadCounters() -> ThreadCounters&
+{
+    if (t_counters == nullptr)
+    {
+        const ScopedAllocationPermit permit;
+        Registry&                    registry = getRegistry();
+        const std::scoped_lock       lock(registry.mutex);
+
+        registry.counters.push_back(std::make_unique<ThreadCounters>());
+        t_counters = registry.counters.back().get();
+    }
+    return *t_counters;
+}
+
+auto formatOpenMetrics(const MetricValues& values) -> std::string
+{
+    std::string text;
+    char        line[256];
+    for (std::size_t i = 0; i < METRIC_INFOS.size(); i++)
+    {
+        const MetricInfo& info      = METRIC_INFOS[i];
+        const bool        isCounter = info.type == MetricType::Counter;
+
+        std::snprintf(line, sizeof(line), "# TYPE %s %s\n# HELP %s %s.\n%s%s %llu\n", info.name,
+                      isCounter ? "counter" : "gauge", info.name, info.help, info.name, isCounter ? "_total" : "",
+                      static_cast<unsigned long long>(values[i]));
+        text += line;
+    }
+    text += "# EOF\n";
+    return text;
+}
+
+// Writes next to the target and renames it, so a scraper never reads a half written file
+auto writeFile(const std::string& path, const std::string& text) -> bool
+{
+    const std::string temporary = path + ".tmp";
+    std::FILE*        file      = std::fopen(temporary.c_str(), "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    const bool written = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+    if (std::fclose(file) != 0 || !written)
+    {
+        return false;
+    }
+#ifdef WS_PLATFORM_WINDOWS
+    std::remove(path.c_str());
+#endif
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+auto writeSocket(const std::string& path, const std::string& text) -> bool
+{
+#ifdef WS_PLATFORM_WINDOWS
+    (void)path;
+    (void)text;
+    return false;
+#else
+    sockaddr_un address{};
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, path.size());
+
+    const int socketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socketFd < 0)
+    {
+        return false;
+    }
+#    ifdef SO_NOSIGPIPE
+    const int noSignal = 1;
+    setsockopt(socketFd, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#    endif
+
+    bool success = connect(socketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    for (std::size_t sent = 0; success && sent < text.size();)
+    {
+        const ssize_t result = send(socketFd, text.data() + sent, text.size() - sent, SEND_FLAGS);
+        success              = result > 0;
+        sent += success ? static_cast<std::size_t>(result) : 0;
+    }
+    close(socketFd);
+    return success;
+#endif
+}
+
+} // namespace
+
+namespace Metrics {
+
+void add(const Metric metric, const uint64_t value)
+{
+    std::atomic<uint64_t>& counter = getThreadCounters().values[static_cast<std::size_t>(metric)];
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void set(const Metric metric, const uint64_t value)
+{
+    getThreadCounters().values[static_cast<std::size_t>(metric)].store(value, std::memory_order_relaxed);
+}
+
+void observeMax(const Metric metric, const uint64_t value)
+{
+    // Collecting resets maxima from another thread, so this one needs a compare exchange
+    std::atomic<uint64_t>& maximum = getThreadCounters().values[static_cast<std::size_t>(metric)];
+    uint64_t               current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {}
+}
+
+auto collect() -> MetricValues
+{
+    MetricValues values{};
+
+    Registry&              registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    for (const std::unique_ptr<ThreadCounters>& counters : registry.counters)
+    {
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            // Gauges are only set by one thread, the others keep 0
+            if (METRIC_INFOS[i].type != MetricType::Maximum)
+            {
+                values[i] += counters->values[i].load(std::memory_order_relaxed);
+            } else
+            {
+                values[i] = std::max(values[i], counters->values[i].exchange(0, std::memory_order_relaxed));
+            }
+        }
+    }
+    return values;
+}
+
+} // namespace Metrics
+
+MetricsExporter::MetricsExporter(JobSystem& jobs, const GameClock& clock)
+    : _jobs(jobs)
+    , _clock(clock)
+    , _target()
+    , _lastExport(0.0)
+    , _writing(std::make_shared<std::atomic<bool>>(false))
+{}
+
+void MetricsExporter::setOutput(std::string target)
+{
+    _target = std::move(target);
+    if (!_target.empty())
+    {
+        TraceLog(LOG_INFO, "Exporting metrics to %s", _target.c_str());
+    }
+}
+
+void MetricsExporter::update()
+{
+    const double time = _clock.getTime();
+    if (_target.empty() || time - _lastExport < EXPORT_INTERVAL || _writing->exchange(true))
+    {
+        return;
+    }
+    _lastExport = time;
+
+    _jobs.dispatch([target = _target, writing = _writing, text = formatOpenMetrics(Metrics::collect())] {
+        const bool success = target.starts_with(SOCKET_PREFIX)
+                                 ? writeSocket(target.substr(SOCKET_PREFIX.size()), text)
+                                 : writeFile(target, text);
+        if (!success)
+        {
+            TraceLog(LOG_WARNING, "Failed to export metrics to %s", target.c_str());
+        }
+        writing->store(false);
+    });
+}
+
+auto MetricsExporter::isEnabled() const -> bool
+{
+    return !_target.empty();
+}
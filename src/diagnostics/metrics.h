@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_METRICS_H
+#define WS_DIAGNOSTICS_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class GameClock;
+class JobSystem;
+
+enum class Metric : uint8_t
+{
+    // Counters
+    FramesRendered = 0,
+    TilesDrawn,
+    HitTests,
+    FloodFillTiles,
+    ChordAttempts,
+    BoardsGenerated,
+    GenerationNanoseconds,
+    JobsRun,
+    // Gauges, set once
+    StartupNanoseconds,
+    // Maximum since the last collection
+    AutoChordDepth,
+    Count
+};
+
+using MetricValues = std::array<uint64_t, static_cast<std::size_t>(Metric::Count)>;
+
+// Cheap hot path counters. Every thread counts into its own cache line without atomic read-modify-writes, the values
+// are only summed up when collected.
+namespace Metrics {
+
+void add(Metric metric, uint64_t value = 1);
+void set(Metric metric, uint64_t value);
+void observeMax(Metric metric, uint64_t value);
+
+// Totals of all counters, the gauges and the maxima observed since the last call
+[[nodiscard]] auto collect() -> MetricValues;
+
+} // namespace Metrics
+
+// Collects the metrics once per second and writes them in the OpenMetrics text format to a file or, with a "unix:"
+// prefix, to a Unix socket. Nothing is collected without an output. Writing happens on a worker.
+class MetricsExporter final
+{
+public:
+    MetricsExporter() = delete;
+    MetricsExporter(JobSystem& jobs, const GameClock& clock);
+
+    // Empty disables the export
+    void setOutput(std::string target);
+    // Called once per frame by the main loop, and while it idles
+    void update();
+
+    [[nodiscard]] auto isEnabled() const -> bool;
+private:
+    JobSystem&       _jobs;
+    const GameClock& _clock;
+
+    std::string                        _target;
+    double                             _lastExport;
+    std::shared_ptr<std::atomic<bool>> _writing; // Skips an export while the previous one is still being written
+};
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "profiler.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <raylib.h>
+#include <string>
+#include <vector>
+
+#include "diagnostics/allocation_auditor.h"
+
+namespace {
+
+constexpr std::size_t CHUNK_SIZE = 4096; // Events per chunk
+constexpr std::size_t MAX_CHUNKS = 1024; // Events beyond MAX_CHUNKS * CHUNK_SIZE per thread are dropped
+
+struct ThreadBuffer
+{
+    using Chunk = std::array<Profiler::Event, CHUNK_SIZE>;
+
+    unsigned int id = 0;
+    std::string  name; // Guarded by the registry mutex
+
+    // Chunks are published before the count that covers them, so readers only see complete events
+    std::array<std::atomic<Chunk*>, MAX_CHUNKS> chunks{};
+    std::atomic<std::size_t>                    count{0};
+    std::atomic<std::size_t>                    dropped{0};
+
+    ~ThreadBuffer()
+    {
+        for (std::atomic<Chunk*>& chunk : chunks)
+        {
+            delete chunk.load(std::memory_order_relaxed);
+        }
+    }
+};
+
+// Buffers outlive their threads, so workers that already exited still show up in the capture
+struct Registry
+{
+    std::mutex                                 mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::chrono::steady_clock::time_point      start = std::chrono::steady_clock::now();
+};
+
+auto getRegistry() -> Registry&
+{
+    static Registry registry;
+    return registry;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+auto getThreadBuffer() -> ThreadBuffer&
+{
+    if (t_buffer == nullptr)
+    {
+        const ScopedAllocationPermit permit;
+        Registry&                    registry = getRegistry();
+        const std::scoped_lock       lock(registry.mutex);
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->id  = static_cast<unsigned int>(registry.buffers.size());
+        t_buffer    = buffer.get();
+        registry.buffers.push_back(std::move(buffer));
+    }
+    return *t_buffer;
+}
+
+} // namespace
+
+namespace Profiler {
+
+auto now() -> int64_t
+{
+    const auto elapsed = std::chrono::steady_clock::now() - getRegistry().start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void record(const char* name, const int64_t start, const int64_t end)
+{
+    ThreadBuffer&     buffer = getThreadBuffer();
+    const std::size_t index  = buffer.count.load(std::memory_order_relaxed);
+    const std::size_t chunk  = index / CHUNK_SIZE;
+    if (chunk >= MAX_CHUNKS)
+    {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ThreadBuffer::Chunk* events = buffer.chunks[chunk].load(std::memory_order_relaxed);
+    if (events == nullptr)
+    {
+        // Instrumentation must not trip the allocation guards of the code it measures
+        const ScopedAllocationPermit permit;
+        events = new ThreadBuffer::Chunk;
+        buffer.chunks[chunk].store(events, std::memory_order_release);
+    }
+    (*events)[index % CHUNK_SIZE] = {name, start, end};
+    buffer.count.store(index + 1, std::memory_order_release);
+}
+
+auto getRecentEvents(const int64_t since, const std::size_t maxCount) -> std::vector<Event>
+{
+    // Events are recorded when their scope ends, so the end times of a thread only grow
+    const ThreadBuffer& buffer = getThreadBuffer();
+    const std::size_t   count  = buffer.count.load(std::memory_order_relaxed);
+    const auto          event  = [&buffer](const std::size_t index) -> const Event& {
+        return (*buffer.chunks[index / CHUNK_SIZE].load(std::memory_order_relaxed))[index % CHUNK_SIZE];
+    };
+
+    std::size_t first = count;
+    while (first > 0 && count - first < maxCount && event(first - 1).end >= since)
+    {
+        first--;
+    }
+
+    std::vector<Event> events;
+    events.reserve(count - first);
+    for (std::size_t i = first; i < count; i++)
+    {
+        events.push_back(event(i));
+    }
+    return events;
+}
+
+void setThreadName(const char* name)
+{
+    ThreadBuffer&          buffer   = getThreadBuffer();
+    Registry&              registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    buffer.name = name;
+}
+
+auto writeChromeTrace(const char* path) -> bool
+{
+    std::FILE* file = std::fopen(path, "w");
+    if (file == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Failed to open trace file %s", path);
+        return false;
+    }
+
+    Registry&              registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+
+    std::size_t eventCount = 0;
+    std::size_t dropped    = 0;
+    bool        first      = true;
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    for (const std::unique_ptr<ThreadBuffer>& buffer : registry.buffers)
+    {
+        if (!buffer->name.empty())
+        {
+            std::fprintf(file,
+                         "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                         first ? "" : ",\n", buffer->id, buffer->name.c_str());
+            first = false;
+        }
+
+        const std::size_t count = buffer->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const ThreadBuffer::Chunk* events = buffer->chunks[i / CHUNK_SIZE].load(std::memory_order_acquire);
+            const Event&               event  = (*events)[i % CHUNK_SIZE];
+
+            // Complete events, timestamps in microseconds
+            std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         first ? "" : ",\n", event.name, buffer->id, static_cast<double>(event.start) / 1000.0,
+                         static_cast<double>(event.end - event.start) / 1000.0);
+            first = false;
+        }
+        eventCount += count;
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    std::fputs("\n]}\n", file);
+
+    const bool success = std::fclose(file) == 0;
+    TraceLog(LOG_INFO, "Wrote %zu trace events to %s (%zu dropped)", eventCount, path, dropped);
+    return success;
+}
+
+} // namespace Profiler
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_PROFILER_H
+#define WS_DIAGNOSTICS_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Scoped trace events, compiled out unless the WS_PROFILE CMake option is on. Names have to be string literals.
+//
+//     void GameScreen::renderField()
+//     {
+//         WS_PROFILE_FUNCTION();
+//         ...
+//     }
+#ifdef WS_PROFILE
+#    define WS_PROFILE_CONCAT_IMPL(a, b) a##b
+#    define WS_PROFILE_CONCAT(a, b)      WS_PROFILE_CONCAT_IMPL(a, b)
+
+#    define WS_PROFILE_SCOPE(name)  const ProfileScope WS_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#    define WS_PROFILE_FUNCTION()   WS_PROFILE_SCOPE(__func__)
+#    define WS_PROFILE_THREAD(name) Profiler::setThreadName(name)
+#    define WS_PROFILE_WRITE(path)  static_cast<void>(Profiler::writeChromeTrace(path))
+#else
+#    define WS_PROFILE_SCOPE(name)  static_cast<void>(0)
+#    define WS_PROFILE_FUNCTION()   static_cast<void>(0)
+#    define WS_PROFILE_THREAD(name) static_cast<void>(0)
+#    define WS_PROFILE_WRITE(path)  static_cast<void>(0)
+#endif
+
+// Every thread records into its own buffer without locking. The buffers grow in fixed chunks that are never moved,
+// so a capture can be written while other threads keep recording.
+namespace Profiler {
+
+struct Event
+{
+    const char* name;
+    int64_t     start;
+    int64_t     end;
+};
+
+// Nanoseconds since the first use of the profiler
+[[nodiscard]] auto now() -> int64_t;
+
+void record(const char* name, int64_t start, int64_t end);
+void setThreadName(const char* name);
+
+// Events of the calling thread that ended after since, oldest first. Only the last maxCount are returned.
+[[nodiscard]] auto getRecentEvents(int64_t since, std::size_t maxCount) -> std::vector<Event>;
+
+// Writes everything recorded so far in the Chrome trace event format (chrome://tracing, Perfetto)
+[[nodiscard]] auto writeChromeTrace(const char* path) -> bool;
+
+} // namespace Profiler
+
+class ProfileScope final
+{
+public:
+    explicit ProfileScope(const char* name)
+        : _name(name)
+        , _start(Profiler::now())
+    {}
+    ~ProfileScope()
+    {
+        Profiler::record(_name, _start, Profiler::now());
+    }
+
+    ProfileScope(const ProfileScope&)                    = delete;
+    auto operator=(const ProfileScope&) -> ProfileScope& = delete;
+private:
+    const char* _name;
+    int64_t     _start;
+};
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_RING_BUFFER_H
+#define WS_DIAGNOSTICS_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Fixed size ring that overwrites its oldest values. It never locks or allocates, a single thread writes and readers
+// on the same thread see the newest Capacity values.
+template <typename T, std::size_t Capacity>
+class RingBuffer final
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity has to be a power of two");
+public:
+    RingBuffer() = default;
+
+    void push(const T& value)
+    {
+        const std::size_t written = _written.load(std::memory_order_relaxed);
+        _values[written & (Capacity - 1)] = value;
+        _written.store(written + 1, std::memory_order_release);
+    }
+
+    // Number of values currently stored
+    [[nodiscard]] auto getSize() const -> std::size_t
+    {
+        const std::size_t written = _written.load(std::memory_order_acquire);
+        return written < Capacity ? written : Capacity;
+    }
+
+    // 0 is the newest value
+    [[nodiscard]] auto getRecent(const std::size_t age) const -> const T&
+    {
+        const std::size_t written = _written.load(std::memory_order_acquire);
+        return _values[(written - 1 - age) & (Capacity - 1)];
+    }
+
+    void clear()
+    {
+        _written.store(0, std::memory_order_release);
+    }
+private:
+    std::array<T, Capacity>  _values{};
+    std::atomic<std::size_t> _written{0};
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "startup_timer.h"
+
+#include <cassert>
+#include <cstdint>
+#include <raylib.h>
+
+#include "diagnostics/logger.h"
+#include "diagnostics/metrics.h"
+
+StartupTimer::StartupTimer()
+    : _start(std::chrono::steady_clock::now())
+    , _stages()
+    , _stageCount(0)
+    , _finished(false)
+{}
+
+void StartupTimer::mark(const char* stage)
+{
+    assert(!_finished);
+    if (_stageCount < MAX_STAGES)
+    {
+        const double time      = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+        _stages[_stageCount++] = {stage, time};
+    }
+}
+
+void StartupTimer::finish()
+{
+    mark("First frame");
+    _finished = true;
+
+#ifdef WS_DEBUG_BUILD
+    double previous = 0.0;
+    for (std::size_t i = 0; i < _stageCount; i++)
+    {
+        const Stage& stage = _stages[i];
+        Logger::log(LOG_INFO, "Startup: %-16s %8.2f ms (+%.2f ms)", stage.name, stage.time * 1000.0,
+                    (stage.time - previous) * 1000.0);
+        previous = stage.time;
+    }
+#endif
+    Logger::log(LOG_INFO, "Time to first frame: %.2f ms", getTimeToFirstFrame() * 1000.0);
+    Metrics::set(Metric::StartupNanoseconds, static_cast<uint64_t>(getTimeToFirstFrame() * 1e9));
+}
+
+auto StartupTimer::isFinished() const -> bool
+{
+    return _finished;
+}
+
+auto StartupTimer::getTimeToFirstFrame() const -> double
+{
+    return _finished ? _stages[_stageCount - 1].time : 0.0;
+}
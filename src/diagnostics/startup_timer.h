@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_DIAGNOSTICS_STARTUP_TIMER_H
+#define WS_DIAGNOSTICS_STARTUP_TIMER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+// Timestamps of the startup stages, measured from the construction of the timer. The first presented frame ends the
+// startup, its time is the time to first frame.
+class StartupTimer final
+{
+public:
+    StartupTimer();
+
+    // Marks the end of a stage, the name has to be a string literal
+    void mark(const char* stage);
+    // Marks the first frame, logs the stages in debug builds and counts the time to first frame in the metrics
+    void finish();
+
+    [[nodiscard]] auto isFinished() const -> bool;
+    // Seconds, 0 until finish() was called
+    [[nodiscard]] auto getTimeToFirstFrame() const -> double;
+private:
+    struct Stage
+    {
+        const char* name;
+        double      time;
+    };
+
+    static constexpr std::size_t MAX_STAGES = 16;
+private:
+    std::chrono::steady_clock::time_point _start;
+
+    std::array<Stage, MAX_STAGES> _stages;
+    std::size_t                   _stageCount;
+    bool                          _finished;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "digit_strip.h"
+
+#include <cassert>
+#include <cstddef>
+
+namespace {
+
+// Strips are only laid out on the main thread during theme uploads
+unsigned int nextLayoutId = 0;
+
+} // namespace
+
+DigitStrip::DigitStrip()
+    : _texture()
+    , _glyphs()
+    , _height()
+    , _spacing()
+    , _layoutId()
+{}
+
+DigitStrip::DigitStrip(const Font& font, const float fontSize, const float spacing)
+    : _texture(font.texture)
+    , _glyphs()
+    , _height(fontSize)
+    , _spacing(spacing)
+    , _layoutId(++nextLayoutId)
+{
+    // Same glyph placement as DrawTextEx()
+    const float scale   = fontSize / static_cast<float>(font.baseSize);
+    const auto  padding = static_cast<float>(font.glyphPadding);
+
+    for (std::size_t i = 0; i < DIGIT_STRIP_CHARS.length(); i++)
+    {
+        const int        index     = GetGlyphIndex(font, DIGIT_STRIP_CHARS[i]);
+        const Rectangle& rectangle = font.recs[index];
+        const GlyphInfo& info      = font.glyphs[index];
+
+        Glyph& glyph = _glyphs[i];
+        glyph.source = {rectangle.x - padding, rectangle.y - padding, rectangle.width + 2.F * padding,
+                        rectangle.height + 2.F * padding};
+        glyph.offset = {(static_cast<float>(info.offsetX) - padding) * scale,
+                        (static_cast<float>(info.offsetY) - padding) * scale};
+        glyph.size   = {glyph.source.width * scale, glyph.source.height * scale};
+
+        const int advance = info.advanceX != 0 ? info.advanceX : static_cast<int>(rectangle.width);
+        glyph.advance     = static_cast<float>(advance) * scale;
+    }
+}
+
+auto DigitStrip::getGlyphIndex(const char character) -> int
+{
+    if (character >= '0' && character <= '9')
+    {
+        return character - '0';
+    }
+
+    const std::size_t index = DIGIT_STRIP_CHARS.find(character);
+    assert(index != std::string_view::npos);
+    return static_cast<int>(index);
+}
+
+auto DigitStrip::getGlyph(const int index) const -> const Glyph&
+{
+    return _glyphs[index];
+}
+
+auto DigitStrip::getTexture() const -> const Texture2D&
+{
+    return _texture;
+}
+
+auto DigitStrip::getHeight() const -> float
+{
+    return _height;
+}
+
+auto DigitStrip::getSpacing() const -> float
+{
+    return _spacing;
+}
+
+auto DigitStrip::getLayoutId() const -> unsigned int
+{
+    return _layoutId;
+}
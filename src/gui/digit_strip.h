@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_GUI_DIGIT_STRIP_H
+#define WS_GUI_DIGIT_STRIP_H
+
+#include <array>
+#include <raylib.h>
+#include <string_view>
+
+// Characters needed to draw the HUD counters
+constexpr std::string_view DIGIT_STRIP_CHARS = "0123456789:-";
+
+// Pre-laid-out quads of the HUD characters inside a font atlas. Drawing a counter with it is a handful of
+// DrawTexturePro() calls without any glyph lookup or text measuring.
+class DigitStrip final
+{
+public:
+    struct Glyph
+    {
+        Rectangle source;
+        Vector2   offset;
+        Vector2   size;
+        float     advance;
+    };
+public:
+    DigitStrip();
+    DigitStrip(const Font& font, float fontSize, float spacing);
+
+    // Index into DIGIT_STRIP_CHARS
+    [[nodiscard]] static auto getGlyphIndex(char character) -> int;
+
+    [[nodiscard]] auto getGlyph(int index) const -> const Glyph&;
+    [[nodiscard]] auto getTexture() const -> const Texture2D&;
+    [[nodiscard]] auto getHeight() const -> float;
+    [[nodiscard]] auto getSpacing() const -> float;
+    // Unique per laid out strip. Layout caches key on it since the driver reuses texture ids.
+    [[nodiscard]] auto getLayoutId() const -> unsigned int;
+private:
+    Texture2D                                     _texture;
+    std::array<Glyph, DIGIT_STRIP_CHARS.length()> _glyphs;
+    float                                         _height;
+    float                                         _spacing;
+    unsigned int                                  _layoutId;
+};
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "hud.h"
+
+#include <cassert>
+#include <cstdlib>
+
+#include "gui/layout_constants.h"
+
+HudCounter::HudCounter()
+    : _format(Format::None)
+    , _value()
+    , _glyphs()
+    , _glyphCount()
+    , _measured(false)
+    , _measuredLayout()
+    , _size()
+{}
+
+void HudCounter::setNumber(const int number)
+{
+    if (_format == Format::Number && _value == number)
+    {
+        return;
+    }
+    _format     = Format::Number;
+    _value      = number;
+    _glyphCount = 0;
+    _measured   = false;
+
+    if (number < 0)
+    {
+        append('-');
+    }
+    appendNumber(std::abs(number), 1);
+}
+
+void HudCounter::setTime(const int totalSeconds)
+{
+    if (_format == Format::Time && _value == totalSeconds)
+    {
+        return;
+    }
+    _format     = Format::Time;
+    _value      = totalSeconds;
+    _glyphCount = 0;
+    _measured   = false;
+
+    // Same as "%02d:%02d"
+    appendNumber(totalSeconds / 60, 2);
+    append(':');
+    appendNumber(totalSeconds % 60, 2);
+}
+
+auto HudCounter::getSize(const DigitStrip& strip) -> Vector2
+{
+    if (_measured && _measuredLayout == strip.getLayoutId())
+    {
+        return _size;
+    }
+
+    float width = 0.F;
+    for (int i = 0; i < _glyphCount; i++)
+    {
+        width += strip.getGlyph(_glyphs[i]).advance;
+    }
+    if (_glyphCount > 1)
+    {
+        width += static_cast<float>(_glyphCount - 1) * strip.getSpacing();
+    }
+
+    _size           = {width, strip.getHeight()};
+    _measured       = true;
+    _measuredLayout = strip.getLayoutId();
+    return _size;
+}
+
+void HudCounter::draw(IRenderBackend& renderer, const DigitStrip& strip, const Vector2& position,
+                      const Color& color) const
+{
+    float posX = position.x;
+    for (int i = 0; i < _glyphCount; i++)
+    {
+        const DigitStrip::Glyph& glyph = strip.getGlyph(_glyphs[i]);
+
+        const Rectangle destination{posX + glyph.offset.x, position.y + glyph.offset.y, glyph.size.x, glyph.size.y};
+        renderer.drawTexture(strip.getTexture(), glyph.source, destination, color);
+
+        posX += glyph.advance + strip.getSpacing();
+    }
+}
+
+void HudCounter::appendNumber(int number, const int minDigits)
+{
+    assert(number >= 0);
+
+    std::array<char, MAX_GLYPHS> digits{};
+    int                          digitCount = 0;
+    do
+    {
+        digits[digitCount++] = static_cast<char>('0' + number % 10);
+        number /= 10;
+    } while (number > 0 && digitCount < MAX_GLYPHS);
+
+    while (digitCount < minDigits)
+    {
+        digits[digitCount++] = '0';
+    }
+    while (digitCount > 0)
+    {
+        append(digits[--digitCount]);
+    }
+}
+
+void HudCounter::append(const char character)
+{
+    if (_glyphCount < MAX_GLYPHS)
+    {
+        _glyphs[_glyphCount++] = static_cast<unsigned char>(DigitStrip::getGlyphIndex(character));
+    }
+}
+
+HudLabel::HudLabel()
+    : _text(nullptr)
+    , _themeLayout()
+    , _fontSize()
+    , _size()
+{}
+
+auto HudLabel::measure(const ITheme& theme, const char* text, const float fontSize) -> Vector2
+{
+    // The digit strip is laid out again whenever the theme's font is uploaded
+    const unsigned int themeLayout = theme.getDigitStrip().getLayoutId();
+    if (text != _text || themeLayout != _themeLayout || fontSize != _fontSize)
+    {
+        _text        = text;
+        _themeLayout = themeLayout;
+        _fontSize    = fontSize;
+        _size        = MeasureTextEx(theme.getFont(), text, fontSize, GUI::HUD_TEXT_SPACING);
+    }
+    return _size;
+}
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_GUI_HUD_H
+#define WS_GUI_HUD_H
+
+#include <array>
+#include <raylib.h>
+
+#include "components/render_backend.h"
+#include "components/theme.h"
+#include "gui/digit_strip.h"
+
+// Counter drawn from a DigitStrip. The text is only re-laid-out when the value changes.
+class HudCounter final
+{
+public:
+    HudCounter();
+
+    void setNumber(int number);
+    void setTime(int totalSeconds);
+
+    [[nodiscard]] auto getSize(const DigitStrip& strip) -> Vector2;
+
+    void draw(IRenderBackend& renderer, const DigitStrip& strip, const Vector2& position, const Color& color) const;
+private:
+    void appendNumber(int number, int minDigits);
+    void append(char character);
+private:
+    static constexpr int MAX_GLYPHS = 16;
+
+    enum class Format : unsigned char
+    {
+        None = 0,
+        Number,
+        Time
+    };
+
+    Format _format;
+    int    _value;
+
+    std::array<unsigned char, MAX_GLYPHS> _glyphs;
+    int                                   _glyphCount;
+
+    // Measured layout
+    bool         _measured;
+    unsigned int _measuredLayout;
+    Vector2      _size;
+};
+
+// Caches the measured size of a static text drawn with the theme's font
+class HudLabel final
+{
+public:
+    HudLabel();
+
+    [[nodiscard]] auto measure(const ITheme& theme, const char* text, float fontSize) -> Vector2;
+private:
+    const char*  _text;
+    unsigned int _themeLayout;
+    float        _fontSize;
+    Vector2      _size;
+};
+
+#endif
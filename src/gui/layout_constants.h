@@ -30,6 +30,9 @@ namespace GUI {
 constexpr int ITEM_SPACING   = 10;
 constexpr int WINDOW_PADDING = 10;
 
+constexpr float HUD_FONT_SIZE    = 32.F;
+constexpr float HUD_TEXT_SPACING = 1.F;
+
 } // namespace GUI
 
-#endif WS_GUI_LAYOUT_CONSTATS
\ No newline at end of file
+#endif // WS_GUI_LAYOUT_CONSTATS
\ No newline at end of file
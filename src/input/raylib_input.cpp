@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "raylib_input.h"
+
+#include "input/scripted_input.h"
+
+RaylibInput::RaylibInput()
+    : _recording(nullptr)
+    , _frame(0)
+{}
+
+RaylibInput::~RaylibInput()
+{
+    if (_recording != nullptr)
+    {
+        std::fclose(_recording);
+    }
+}
+
+auto RaylibInput::startRecording(const std::string& path) -> bool
+{
+    if (_recording != nullptr)
+    {
+        std::fclose(_recording);
+    }
+
+    _recording = std::fopen(path.c_str(), "w");
+    _frame     = 0;
+    if (_recording == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Failed to record input to %s", path.c_str());
+        return false;
+    }
+    std::fputs("# Wyrmsweeper input script\n", _recording);
+    return true;
+}
+
+void RaylibInput::update()
+{
+    // Raylib polls the events itself at the end of the last frame
+    if (_recording != nullptr)
+    {
+        record();
+        _frame++;
+    }
+}
+
+auto RaylibInput::isKeyPressed(const int key) const -> bool
+{
+    return IsKeyPressed(key);
+}
+
+auto RaylibInput::isMouseButtonPressed(const int button) const -> bool
+{
+    return IsMouseButtonPressed(button);
+}
+
+auto RaylibInput::isMouseButtonReleased(const int button) const -> bool
+{
+    return IsMouseButtonReleased(button);
+}
+
+auto RaylibInput::getMousePosition() const -> Vector2
+{
+    return GetMousePosition();
+}
+
+auto RaylibInput::getMouseDelta() const -> Vector2
+{
+    return GetMouseDelta();
+}
+
+auto RaylibInput::getMouseWheelMove() const -> float
+{
+    return GetMouseWheelMove();
+}
+
+auto RaylibInput::hasInput() const -> bool
+{
+    // Reads the events polled last, which the main loop also does between frames while idle
+    if (const Vector2 delta = GetMouseDelta(); delta.x != 0.F || delta.y != 0.F)
+    {
+        return true;
+    }
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_BACK; button++)
+    {
+        if (IsMouseButtonPressed(button) || IsMouseButtonReleased(button))
+        {
+            return true;
+        }
+    }
+    return GetMouseWheelMove() != 0.F || GetKeyPressed() != 0;
+}
+
+auto RaylibInput::hasPendingInput() const -> bool
+{
+    return false;
+}
+
+void RaylibInput::record()
+{
+    if (const Vector2 delta = GetMouseDelta(); delta.x != 0.F || delta.y != 0.F || _frame == 0)
+    {
+        const Vector2 position = GetMousePosition();
+        std::fprintf(_recording, "%d move %.1f %.1f\n", _frame, static_cast<double>(position.x),
+                     static_cast<double>(position.y));
+    }
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_MIDDLE; button++)
+    {
+        if (IsMouseButtonPressed(button))
+        {
+            std::fprintf(_recording, "%d press %s\n", _frame, ScriptedInput::getButtonName(button));
+        }
+        if (IsMouseButtonReleased(button))
+        {
+            std::fprintf(_recording, "%d release %s\n", _frame, ScriptedInput::getButtonName(button));
+        }
+    }
+    if (const float wheel = GetMouseWheelMove(); wheel != 0.F)
+    {
+        std::fprintf(_recording, "%d wheel %.2f\n", _frame, static_cast<double>(wheel));
+    }
+    for (int key = 0; key < ScriptedInput::MAX_KEYS; key++)
+    {
+        if (IsKeyPressed(key))
+        {
+            std::fprintf(_recording, "%d key %d\n", _frame, key);
+        }
+    }
+}
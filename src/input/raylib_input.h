@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_INPUT_RAYLIB_INPUT_H
+#define WS_INPUT_RAYLIB_INPUT_H
+
+#include <cstdio>
+#include <string>
+
+#include "components/input_provider.h"
+
+// Live input of the window. Can record it as a script for ScriptedInput.
+class RaylibInput final : public IInputProvider
+{
+public:
+     RaylibInput();
+    ~RaylibInput() override;
+
+    RaylibInput(const RaylibInput&)                    = delete;
+    auto operator=(const RaylibInput&) -> RaylibInput& = delete;
+
+    // Writes the input of every following frame to the file, returns false if it can not be opened
+    [[nodiscard]] auto startRecording(const std::string& path) -> bool;
+
+    void update() override;
+
+    [[nodiscard]] auto isKeyPressed(int key) const -> bool override;
+    [[nodiscard]] auto isMouseButtonPressed(int button) const -> bool override;
+    [[nodiscard]] auto isMouseButtonReleased(int button) const -> bool override;
+    [[nodiscard]] auto getMousePosition() const -> Vector2 override;
+    [[nodiscard]] auto getMouseDelta() const -> Vector2 override;
+    [[nodiscard]] auto getMouseWheelMove() const -> float override;
+
+    [[nodiscard]] auto hasInput() const -> bool override;
+    [[nodiscard]] auto hasPendingInput() const -> bool override;
+private:
+    void record();
+private:
+    std::FILE* _recording;
+    int        _frame;
+};
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "scripted_input.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+ScriptedInput::ScriptedInput()
+    : _events()
+    , _frame(0)
+    , _mousePosition()
+    , _mouseDelta()
+    , _mouseWheelMove(0.F)
+    , _buttonsPressed()
+    , _buttonsReleased()
+    , _keysPressed()
+{}
+
+auto ScriptedInput::loadScript(const std::string& path) -> bool
+{
+    std::FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Failed to open input script %s", path.c_str());
+        return false;
+    }
+
+    // Parsed completely before scheduling anything, a broken script does not play back halfway
+    std::vector<Event> events;
+    char               line[128];
+    int                lineNumber = 0;
+    bool               valid      = true;
+    while (valid && std::fgets(line, sizeof(line), file) != nullptr)
+    {
+        lineNumber++;
+        if (line[0] == '#' || line[0] == '\n')
+        {
+            continue;
+        }
+
+        int   frame  = 0;
+        char  type[16]{};
+        char  name[16]{};
+        float x      = 0.F;
+        float y      = 0.F;
+        int   key    = 0;
+        int   button = -1;
+        if (std::sscanf(line, "%d move %f %f", &frame, &x, &y) == 3)
+        {
+            events.push_back({frame, EventType::Move, 0, {x, y}});
+        } else if (std::sscanf(line, "%d wheel %f", &frame, &x) == 2)
+        {
+            events.push_back({frame, EventType::Wheel, 0, {x, 0.F}});
+        } else if (std::sscanf(line, "%d key %d", &frame, &key) == 2 && key >= 0 && key < MAX_KEYS)
+        {
+            events.push_back({frame, EventType::Key, key, {}});
+        } else if (std::sscanf(line, "%d %15s %15s", &frame, type, name) == 3)
+        {
+            for (int candidate = 0; candidate < BUTTON_COUNT; candidate++)
+            {
+                if (std::string_view(name) == getButtonName(candidate))
+                {
+                    button = candidate;
+                }
+            }
+
+            const std::string_view typeName(type);
+            valid = button >= 0 && (typeName == "press" || typeName == "release");
+            if (valid)
+            {
+                events.push_back({frame, typeName == "press" ? EventType::Press : EventType::Release, button, {}});
+            }
+        } else
+        {
+            valid = false;
+        }
+        valid = valid && frame >= 0;
+    }
+    std::fclose(file);
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "Invalid input script %s, line %i", path.c_str(), lineNumber);
+        return false;
+    }
+    for (const Event& event : events)
+    {
+        schedule(event.type, event.frame, event.code, event.value);
+    }
+    TraceLog(LOG_INFO, "Loaded %i events from input script %s", static_cast<int>(events.size()), path.c_str());
+    return true;
+}
+
+void ScriptedInput::moveMouse(const Vector2 position, const int frame)
+{
+    schedule(EventType::Move, frame, 0, position);
+}
+
+void ScriptedInput::pressMouseButton(const int button, const int frame)
+{
+    assert(getButtonName(button) != nullptr);
+    schedule(EventType::Press, frame, button, {});
+}
+
+void ScriptedInput::releaseMouseButton(const int button, const int frame)
+{
+    assert(getButtonName(button) != nullptr);
+    schedule(EventType::Release, frame, button, {});
+}
+
+void ScriptedInput::click(const Vector2 position, const int button, const int frame)
+{
+    moveMouse(position, frame);
+    pressMouseButton(button, frame);
+    releaseMouseButton(button, frame + 1);
+}
+
+void ScriptedInput::scrollMouseWheel(const float amount, const int frame)
+{
+    schedule(EventType::Wheel, frame, 0, {amount, 0.F});
+}
+
+void ScriptedInput::pressKey(const int key, const int frame)
+{
+    assert(key >= 0 && key < MAX_KEYS);
+    schedule(EventType::Key, frame, key, {});
+}
+
+void ScriptedInput::update()
+{
+    const Vector2 lastPosition = _mousePosition;
+    _mouseWheelMove            = 0.F;
+    _buttonsPressed.fill(false);
+    _buttonsReleased.fill(false);
+    _keysPressed.reset();
+
+    while (!_events.empty() && _events.front().frame <= _frame)
+    {
+        apply(_events.front());
+        _events.pop_front();
+    }
+
+    _mouseDelta = {_mousePosition.x - lastPosition.x, _mousePosition.y - lastPosition.y};
+    _frame++;
+}
+
+auto ScriptedInput::isKeyPressed(const int key) const -> bool
+{
+    return key >= 0 && key < MAX_KEYS && _keysPressed[static_cast<std::size_t>(key)];
+}
+
+auto ScriptedInput::isMouseButtonPressed(const int button) const -> bool
+{
+    return button >= 0 && button < BUTTON_COUNT && _buttonsPressed[static_cast<std::size_t>(button)];
+}
+
+auto ScriptedInput::isMouseButtonReleased(const int button) const -> bool
+{
+    return button >= 0 && button < BUTTON_COUNT && _buttonsReleased[static_cast<std::size_t>(button)];
+}
+
+auto ScriptedInput::getMousePosition() const -> Vector2
+{
+    return _mousePosition;
+}
+
+auto ScriptedInput::getMouseDelta() const -> Vector2
+{
+    return _mouseDelta;
+}
+
+auto ScriptedInput::getMouseWheelMove() const -> float
+{
+    return _mouseWheelMove;
+}
+
+auto ScriptedInput::hasInput() const -> bool
+{
+    const auto isSet = [](const bool value) { return value; };
+    return _mouseDelta.x != 0.F || _mouseDelta.y != 0.F || _mouseWheelMove != 0.F || _keysPressed.any() ||
+           std::any_of(_buttonsPressed.begin(), _buttonsPressed.end(), isSet) ||
+           std::any_of(_buttonsReleased.begin(), _buttonsReleased.end(), isSet);
+}
+
+auto ScriptedInput::hasPendingInput() const -> bool
+{
+    return !_events.empty();
+}
+
+auto ScriptedInput::getButtonName(const int button) -> const char*
+{
+    switch (button)
+    {
+    case MOUSE_BUTTON_LEFT:
+        return "left";
+    case MOUSE_BUTTON_RIGHT:
+        return "right";
+    case MOUSE_BUTTON_MIDDLE:
+        return "middle";
+    default:
+        return nullptr;
+    }
+}
+
+void ScriptedInput::schedule(const EventType type, const int frame, const int code, const Vector2 value)
+{
+    // Events of the same frame keep their order
+    const Event event{_frame + std::max(frame, 0), type, code, value};
+    const auto  position = std::upper_bound(
+        _events.begin(), _events.end(), event.frame,
+        [](const int eventFrame, const Event& other) { return eventFrame < other.frame; });
+    _events.insert(position, event);
+}
+
+void ScriptedInput::apply(const Event& event)
+{
+    switch (event.type)
+    {
+    case EventType::Move:
+        _mousePosition = event.value;
+        break;
+    case EventType::Press:
+        _buttonsPressed[static_cast<std::size_t>(event.code)] = true;
+        break;
+    case EventType::Release:
+        _buttonsReleased[static_cast<std::size_t>(event.code)] = true;
+        break;
+    case EventType::Wheel:
+        _mouseWheelMove += event.value.x;
+        break;
+    case EventType::Key:
+        _keysPressed.set(static_cast<std::size_t>(event.code));
+        break;
+    }
+}
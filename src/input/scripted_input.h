@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_INPUT_SCRIPTED_INPUT_H
+#define WS_INPUT_SCRIPTED_INPUT_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+#include "components/input_provider.h"
+
+// Synthetic input, every event is applied at the start of its frame. Events are scheduled through the functions
+// below, with frames counted from the next update(), or played back from a script with one event per line:
+//
+//     <frame> move <x> <y>
+//     <frame> press|release left|right|middle
+//     <frame> wheel <amount>
+//     <frame> key <raylib key code>
+//
+// Script frames count from the frame the script is loaded in, RaylibInput records scripts of this format.
+class ScriptedInput final : public IInputProvider
+{
+public:
+    static constexpr int MAX_KEYS = 512; // Like raylib
+
+    ScriptedInput();
+
+    // Schedules all events of the script, returns false and schedules nothing if it can not be read
+    [[nodiscard]] auto loadScript(const std::string& path) -> bool;
+
+    void moveMouse(Vector2 position, int frame = 0);
+    void pressMouseButton(int button, int frame = 0);
+    void releaseMouseButton(int button, int frame = 0);
+    // Moves and presses on the frame, releases on the one after
+    void click(Vector2 position, int button, int frame = 0);
+    void scrollMouseWheel(float amount, int frame = 0);
+    void pressKey(int key, int frame = 0);
+
+    void update() override;
+
+    [[nodiscard]] auto isKeyPressed(int key) const -> bool override;
+    [[nodiscard]] auto isMouseButtonPressed(int button) const -> bool override;
+    [[nodiscard]] auto isMouseButtonReleased(int button) const -> bool override;
+    [[nodiscard]] auto getMousePosition() const -> Vector2 override;
+    [[nodiscard]] auto getMouseDelta() const -> Vector2 override;
+    [[nodiscard]] auto getMouseWheelMove() const -> float override;
+
+    [[nodiscard]] auto hasInput() const -> bool override;
+    [[nodiscard]] auto hasPendingInput() const -> bool override;
+
+    // Script names of the buttons, nullptr for buttons scripts do not support
+    [[nodiscard]] static auto getButtonName(int button) -> const char*;
+private:
+    enum class EventType : uint8_t
+    {
+        Move = 0,
+        Press,
+        Release,
+        Wheel,
+        Key
+    };
+
+    struct Event
+    {
+        int       frame;
+        EventType type;
+        int       code; // Button or key
+        Vector2   value;
+    };
+
+    static constexpr int BUTTON_COUNT = MOUSE_BUTTON_MIDDLE + 1;
+private:
+    void schedule(EventType type, int frame, int code, Vector2 value);
+    void apply(const Event& event);
+private:
+    std::deque<Event> _events; // Sorted by frame
+    int               _frame;  // Of the next update()
+
+    Vector2                        _mousePosition;
+    Vector2                        _mouseDelta;
+    float                          _mouseWheelMove;
+    std::array<bool, BUTTON_COUNT> _buttonsPressed;
+    std::array<bool, BUTTON_COUNT> _buttonsReleased;
+    std::bitset<MAX_KEYS>          _keysPressed;
+};
+
+#endif
@@ -22,12 +22,20 @@
  * SOFTWARE.
  */
 
+#include "app/headless.h"
+#include "app/launch_options.h"
 #include "app/wyrmsweeper.h"
 
-auto main(int /*argc*/, char** /*argv*/) -> int
+auto main(int argc, char** argv) -> int
 {
+    const LaunchOptions options = parseLaunchOptions(argc, argv);
+    if (options.command != HeadlessCommand::None)
+    {
+        return runHeadlessCommand(options);
+    }
+
     Wyrmsweeper game;
-    game.run();
+    game.run(options);
     return 0;
 }
 
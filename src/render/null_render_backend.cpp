@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "null_render_backend.h"
+
+#include <array>
+#include <cstdio>
+#include <raygui.h>
+
+constexpr unsigned int DEFAULT_TEXTURE_ID = 1;    // raylib's white texture, shapes are drawn with it
+constexpr uint64_t     BATCH_QUAD_COUNT   = 8192; // RL_DEFAULT_BATCH_BUFFER_ELEMENTS, a full batch is flushed
+constexpr uint64_t     WIDGET_QUAD_COUNT  = 5;    // Raygui fills the bounds and draws four border rectangles
+
+NullRenderBackend::NullRenderBackend(const int screenWidth, const int screenHeight)
+    : _screenWidth(screenWidth)
+    , _screenHeight(screenHeight)
+    , _nextId(DEFAULT_TEXTURE_ID + 1)
+    , _drawCount()
+    , _boundTexture()
+    , _batchQuads()
+    , _frame()
+    , _lastFrame()
+    , _total()
+{}
+
+auto NullRenderBackend::getCounters() const -> const RenderCounters&
+{
+    return _total;
+}
+
+auto NullRenderBackend::getFrameCounters() const -> const RenderCounters&
+{
+    return _lastFrame;
+}
+
+void NullRenderBackend::beginFrame(const Color& /*clearColor*/)
+{
+    _drawCount = 0;
+}
+
+void NullRenderBackend::endFrame()
+{
+    flush();
+    // Every frame starts with nothing bound
+    _boundTexture = 0;
+
+    _lastFrame = _frame;
+    _total.drawCalls += _frame.drawCalls;
+    _total.quads += _frame.quads;
+    _total.textureBinds += _frame.textureBinds;
+    _frame = {};
+}
+
+auto NullRenderBackend::getScreenWidth() const -> int
+{
+    return _screenWidth;
+}
+
+auto NullRenderBackend::getScreenHeight() const -> int
+{
+    return _screenHeight;
+}
+
+auto NullRenderBackend::getRefreshRate() const -> int
+{
+    return 0;
+}
+
+auto NullRenderBackend::isWindowFocused() const -> bool
+{
+    return true;
+}
+
+auto NullRenderBackend::isWindowResized() const -> bool
+{
+    return false;
+}
+
+auto NullRenderBackend::getDrawCount() const -> int
+{
+    return _drawCount;
+}
+
+auto NullRenderBackend::loadTexture(const Image& image) -> Texture2D
+{
+    return {createId(), image.width, image.height, image.mipmaps, image.format};
+}
+
+void NullRenderBackend::updateTexture(const Texture2D& /*texture*/, const Rectangle& /*area*/,
+                                      const void* /*pixels*/)
+{}
+
+void NullRenderBackend::setTextureFilter(const Texture2D& /*texture*/, const int /*filter*/)
+{}
+
+void NullRenderBackend::unloadTexture(const Texture2D& /*texture*/)
+{}
+
+void NullRenderBackend::unloadFont(const Font& font)
+{
+    // Only the CPU side of UnloadFont(), the atlas was never uploaded
+    UnloadFontData(font.glyphs, font.glyphCount);
+    MemFree(font.recs);
+}
+
+auto NullRenderBackend::loadShader(const char* /*fragmentCode*/) -> Shader
+{
+    return {createId(), nullptr};
+}
+
+auto NullRenderBackend::isShaderSupported(const Shader& shader) const -> bool
+{
+    return shader.id != 0;
+}
+
+auto NullRenderBackend::getShaderLocation(const Shader& /*shader*/, const char* /*name*/) const -> int
+{
+    return 0;
+}
+
+void NullRenderBackend::unloadShader(const Shader& /*shader*/)
+{}
+
+void NullRenderBackend::drawTexture(const Texture2D& texture, const Rectangle& /*source*/,
+                                    const Rectangle& /*destination*/, const Color& /*tint*/)
+{
+    _drawCount++;
+    addQuads(texture.id, 1);
+}
+
+void NullRenderBackend::drawText(const Font& font, const char* text, const Vector2& /*position*/,
+                                 const float /*fontSize*/, const float /*spacing*/, const Color& /*color*/)
+{
+    _drawCount++;
+    addText(font.texture.id, text);
+}
+
+void NullRenderBackend::drawRectangle(const Rectangle& /*rectangle*/, const Color& /*color*/)
+{
+    _drawCount++;
+    addQuads(DEFAULT_TEXTURE_ID, 1);
+}
+
+void NullRenderBackend::drawLine(const Vector2& /*start*/, const Vector2& /*end*/, const Color& /*color*/)
+{
+    _drawCount++;
+    addQuads(DEFAULT_TEXTURE_ID, 1);
+}
+
+void NullRenderBackend::beginCamera(const Camera2D& /*camera*/)
+{
+    flush();
+}
+
+void NullRenderBackend::endCamera()
+{
+    flush();
+}
+
+void NullRenderBackend::beginShader(const Shader& /*shader*/)
+{
+    flush();
+}
+
+void NullRenderBackend::endShader()
+{
+    flush();
+}
+
+void NullRenderBackend::setShaderValue(const Shader& /*shader*/, const int /*location*/, const void* /*value*/,
+                                       const int /*uniformType*/)
+{}
+
+void NullRenderBackend::setShaderTexture(const Shader& /*shader*/, const int /*location*/,
+                                         const Texture2D& /*texture*/)
+{
+    // Bound to its own texture unit for the next draw call
+    _frame.textureBinds++;
+}
+
+auto NullRenderBackend::button(const Rectangle& /*bounds*/, const char* text) -> bool
+{
+    _drawCount++;
+    addWidget(text);
+    return false;
+}
+
+void NullRenderBackend::label(const Rectangle& /*bounds*/, const char* text)
+{
+    _drawCount++;
+    addText(GuiGetFont().texture.id, text);
+}
+
+void NullRenderBackend::checkBox(const Rectangle& /*bounds*/, const char* text, bool& checked)
+{
+    _drawCount++;
+    addWidget(nullptr);
+    if (checked)
+    {
+        addQuads(DEFAULT_TEXTURE_ID, 1);
+    }
+    addText(GuiGetFont().texture.id, text);
+}
+
+void NullRenderBackend::progressBar(const Rectangle& /*bounds*/, const float /*progress*/)
+{
+    _drawCount++;
+    addWidget(nullptr);
+    addQuads(DEFAULT_TEXTURE_ID, 1);
+}
+
+auto NullRenderBackend::spinner(const Rectangle& /*bounds*/, const char* text, int& value, const int /*minValue*/,
+                                const int /*maxValue*/, const bool /*editMode*/) -> bool
+{
+    _drawCount++;
+    std::array<char, 16> valueText{};
+    std::snprintf(valueText.data(), valueText.size(), "%i", value);
+
+    // Two arrow buttons around the value box
+    addWidget("<");
+    addWidget(valueText.data());
+    addWidget(">");
+    addText(GuiGetFont().texture.id, text);
+    return false;
+}
+
+auto NullRenderBackend::createId() -> unsigned int
+{
+    return _nextId++;
+}
+
+void NullRenderBackend::addQuads(const unsigned int texture, const uint64_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (texture != _boundTexture)
+    {
+        flush();
+        _boundTexture = texture;
+        _frame.textureBinds++;
+    }
+    if (_batchQuads == 0)
+    {
+        _frame.drawCalls++;
+    }
+
+    // Overflowing quads continue in new batches
+    _batchQuads += count;
+    while (_batchQuads > BATCH_QUAD_COUNT)
+    {
+        _batchQuads -= BATCH_QUAD_COUNT;
+        _frame.drawCalls++;
+    }
+    _frame.quads += count;
+}
+
+void NullRenderBackend::addText(const unsigned int texture, const char* text)
+{
+    // Same glyphs as DrawTextEx(), which skips whitespace
+    uint64_t glyphCount = 0;
+    for (const char* character = text; *character != '\0';)
+    {
+        int       size      = 0;
+        const int codepoint = GetCodepointNext(character, &size);
+        if (codepoint != ' ' && codepoint != '\t' && codepoint != '\n')
+        {
+            glyphCount++;
+        }
+        character += size;
+    }
+    addQuads(texture, glyphCount);
+}
+
+void NullRenderBackend::addWidget(const char* text)
+{
+    addQuads(DEFAULT_TEXTURE_ID, WIDGET_QUAD_COUNT);
+    if (text != nullptr)
+    {
+        addText(GuiGetFont().texture.id, text);
+    }
+}
+
+void NullRenderBackend::flush()
+{
+    _batchQuads = 0;
+}
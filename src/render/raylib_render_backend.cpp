@@ -0,0 +1,204 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "raylib_render_backend.h"
+
+#include <raygui.h>
+#include <rlgl.h>
+
+void RaylibRenderBackend::beginFrame(const Color& clearColor)
+{
+    BeginDrawing();
+    ClearBackground(clearColor);
+    _drawCount = 0;
+}
+
+void RaylibRenderBackend::endFrame()
+{
+    EndDrawing();
+}
+
+auto RaylibRenderBackend::getScreenWidth() const -> int
+{
+    return GetScreenWidth();
+}
+
+auto RaylibRenderBackend::getScreenHeight() const -> int
+{
+    return GetScreenHeight();
+}
+
+auto RaylibRenderBackend::getRefreshRate() const -> int
+{
+    return GetMonitorRefreshRate(GetCurrentMonitor());
+}
+
+auto RaylibRenderBackend::isWindowFocused() const -> bool
+{
+    return IsWindowFocused();
+}
+
+auto RaylibRenderBackend::isWindowResized() const -> bool
+{
+    return IsWindowResized();
+}
+
+auto RaylibRenderBackend::getDrawCount() const -> int
+{
+    return _drawCount;
+}
+
+auto RaylibRenderBackend::loadTexture(const Image& image) -> Texture2D
+{
+    return LoadTextureFromImage(image);
+}
+
+void RaylibRenderBackend::updateTexture(const Texture2D& texture, const Rectangle& area, const void* pixels)
+{
+    UpdateTextureRec(texture, area, pixels);
+}
+
+void RaylibRenderBackend::setTextureFilter(const Texture2D& texture, const int filter)
+{
+    SetTextureFilter(texture, filter);
+}
+
+void RaylibRenderBackend::unloadTexture(const Texture2D& texture)
+{
+    UnloadTexture(texture);
+}
+
+void RaylibRenderBackend::unloadFont(const Font& font)
+{
+    UnloadFont(font);
+}
+
+auto RaylibRenderBackend::loadShader(const char* fragmentCode) -> Shader
+{
+    return LoadShaderFromMemory(nullptr, fragmentCode);
+}
+
+auto RaylibRenderBackend::isShaderSupported(const Shader& shader) const -> bool
+{
+    // raylib falls back to its default shader if compiling fails
+    return shader.id != 0 && shader.id != rlGetShaderIdDefault();
+}
+
+auto RaylibRenderBackend::getShaderLocation(const Shader& shader, const char* name) const -> int
+{
+    return GetShaderLocation(shader, name);
+}
+
+void RaylibRenderBackend::unloadShader(const Shader& shader)
+{
+    UnloadShader(shader);
+}
+
+void RaylibRenderBackend::drawTexture(const Texture2D& texture, const Rectangle& source, const Rectangle& destination,
+                                      const Color& tint)
+{
+    _drawCount++;
+    DrawTexturePro(texture, source, destination, {0.F, 0.F}, 0.F, tint);
+}
+
+void RaylibRenderBackend::drawText(const Font& font, const char* text, const Vector2& position, const float fontSize,
+                                   const float spacing, const Color& color)
+{
+    _drawCount++;
+    DrawTextEx(font, text, position, fontSize, spacing, color);
+}
+
+void RaylibRenderBackend::drawRectangle(const Rectangle& rectangle, const Color& color)
+{
+    _drawCount++;
+    DrawRectangleRec(rectangle, color);
+}
+
+void RaylibRenderBackend::drawLine(const Vector2& start, const Vector2& end, const Color& color)
+{
+    _drawCount++;
+    DrawLineV(start, end, color);
+}
+
+void RaylibRenderBackend::beginCamera(const Camera2D& camera)
+{
+    BeginMode2D(camera);
+}
+
+void RaylibRenderBackend::endCamera()
+{
+    EndMode2D();
+}
+
+void RaylibRenderBackend::beginShader(const Shader& shader)
+{
+    BeginShaderMode(shader);
+}
+
+void RaylibRenderBackend::endShader()
+{
+    EndShaderMode();
+}
+
+void RaylibRenderBackend::setShaderValue(const Shader& shader, const int location, const void* value,
+                                         const int uniformType)
+{
+    SetShaderValue(shader, location, value, uniformType);
+}
+
+void RaylibRenderBackend::setShaderTexture(const Shader& shader, const int location, const Texture2D& texture)
+{
+    SetShaderValueTexture(shader, location, texture);
+}
+
+auto RaylibRenderBackend::button(const Rectangle& bounds, const char* text) -> bool
+{
+    _drawCount++;
+    return GuiButton(bounds, text) != 0;
+}
+
+void RaylibRenderBackend::label(const Rectangle& bounds, const char* text)
+{
+    _drawCount++;
+    GuiLabel(bounds, text);
+}
+
+void RaylibRenderBackend::checkBox(const Rectangle& bounds, const char* text, bool& checked)
+{
+    _drawCount++;
+    GuiCheckBox(bounds, text, &checked);
+}
+
+void RaylibRenderBackend::progressBar(const Rectangle& bounds, float progress)
+{
+    _drawCount++;
+    GuiProgressBar(bounds, nullptr, nullptr, &progress, 0.F, 1.F);
+}
+
+auto RaylibRenderBackend::spinner(const Rectangle& bounds, const char* text, int& value, const int minValue,
+                                  const int maxValue, const bool editMode) -> bool
+{
+    _drawCount++;
+    return GuiSpinner(bounds, text, &value, minValue, maxValue, editMode) != 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_RENDER_RAYLIB_RENDER_BACKEND_H
+#define WS_RENDER_RAYLIB_RENDER_BACKEND_H
+
+#include "components/render_backend.h"
+
+// Draws into the window with raylib and raygui, needs the window to be open for everything but construction
+class RaylibRenderBackend final : public IRenderBackend
+{
+public:
+    void beginFrame(const Color& clearColor) override;
+    void endFrame() override;
+
+    [[nodiscard]] auto getScreenWidth() const -> int override;
+    [[nodiscard]] auto getScreenHeight() const -> int override;
+    [[nodiscard]] auto getRefreshRate() const -> int override;
+    [[nodiscard]] auto isWindowFocused() const -> bool override;
+    [[nodiscard]] auto isWindowResized() const -> bool override;
+    [[nodiscard]] auto getDrawCount() const -> int override;
+
+    [[nodiscard]] auto loadTexture(const Image& image) -> Texture2D override;
+    void updateTexture(const Texture2D& texture, const Rectangle& area, const void* pixels) override;
+    void setTextureFilter(const Texture2D& texture, int filter) override;
+    void unloadTexture(const Texture2D& texture) override;
+    void unloadFont(const Font& font) override;
+
+    [[nodiscard]] auto loadShader(const char* fragmentCode) -> Shader override;
+    [[nodiscard]] auto isShaderSupported(const Shader& shader) const -> bool override;
+    [[nodiscard]] auto getShaderLocation(const Shader& shader, const char* name) const -> int override;
+    void               unloadShader(const Shader& shader) override;
+
+    void drawTexture(const Texture2D& texture, const Rectangle& source, const Rectangle& destination,
+                     const Color& tint) override;
+    void drawText(const Font& font, const char* text, const Vector2& position, float fontSize, float spacing,
+                  const Color& color) override;
+    void drawRectangle(const Rectangle& rectangle, const Color& color) override;
+    void drawLine(const Vector2& start, const Vector2& end, const Color& color) override;
+
+    void beginCamera(const Camera2D& camera) override;
+    void endCamera() override;
+    void beginShader(const Shader& shader) override;
+    void endShader() override;
+
+    void setShaderValue(const Shader& shader, int location, const void* value, int uniformType) override;
+    void setShaderTexture(const Shader& shader, int location, const Texture2D& texture) override;
+
+    [[nodiscard]] auto button(const Rectangle& bounds, const char* text) -> bool override;
+    void               label(const Rectangle& bounds, const char* text) override;
+    void               checkBox(const Rectangle& bounds, const char* text, bool& checked) override;
+    void               progressBar(const Rectangle& bounds, float progress) override;
+    [[nodiscard]] auto spinner(const Rectangle& bounds, const char* text, int& value, int minValue, int maxValue,
+                               bool editMode) -> bool override;
+private:
+    int _drawCount = 0;
+};
+
+#endif
@@ -26,68 +26,179 @@
 
 #include <algorithm>
 #include <chrono>
-#include <raygui.h>
+#include <cmath>
 #include <raymath.h>
 
 #include "app/wyrmsweeper.h"
+#include "diagnostics/allocation_auditor.h"
+#include "diagnostics/logger.h"
+#include "diagnostics/metrics.h"
+#include "diagnostics/profiler.h"
 #include "gui/layout_constants.h"
 #include "screens/main_menu_screen.h"
 
 constexpr float ZOOM_MULTIPLIER    = 0.1F;
 constexpr float MINIMUM_ZOOM_LEVEL = 0.1F;
 
-constexpr float FONT_SIZE_SMALL = 32.F;
-constexpr float FONT_SIZE_BIG   = 48.F;
+constexpr float FONT_SIZE_BIG = 48.F;
 
 constexpr float GUI_BUTTON_WIDTH       = 100.F;
 constexpr float GUI_BUTTON_HEIGHT      = 50.F;
-constexpr float GUI_QUIT_DIALOG_WIDTH  = 500.F;
-constexpr float GUI_QUIT_DIALOG_HEIGHT = 150.F;
+constexpr float GUI_PROGRESS_WIDTH     = 400.F;
+constexpr float GUI_PROGRESS_HEIGHT    = 30.F;
+
+constexpr double PROGRESS_DELAY           = 0.1; // Small fields are ready before the progress bar would show up
+constexpr double PROGRESS_REDRAW_INTERVAL = 1.0 / 30.0;
 
 GameScreen::GameScreen(Wyrmsweeper* game, const int width, const int height, const int mineCount)
     : Screen(game)
-    , _gameState(GameState::Playing)
-    , _bombCount(mineCount)
-    , _normalTileCount(width * height - mineCount)
+    , _rules(game->getFrameArena())
     , _time()
-    , _quitDialog(false)
+    , _lastUpdateTime(game->getClock().getTime())
     , _firstTouch(false)
     , _renderTileSize()
     , _renderFieldSize()
     , _camera()
-    , _field(width, height, mineCount)
+    , _timeCounter()
+    , _bombCounter()
+    , _centeredLabel()
+    , _generationProgress(std::make_shared<std::atomic<float>>(0.F))
+    , _generationToken()
+    , _generationStart(game->getClock().getTime())
+    , _field()
+    , _fieldState(game->getRenderer())
 {
     setupCamera();
-    calculateRenderSizes();
 
-    TraceLog(LOG_INFO, "GameScreen(0x%2x) constructed", this);
+    // Retry and repeated difficulties usually find a board that was generated while the last game was played
+    if (auto field = _game->getBoardPool().take(width, height, mineCount))
+    {
+        setField(std::move(field));
+    } else
+    {
+        _game->getTaskScheduler().spawn(generateField(width, height, mineCount), _generationToken);
+    }
+
+    Logger::log(LOG_INFO, "GameScreen(%p) constructed", static_cast<const void*>(this));
+}
+
+GameScreen::~GameScreen()
+{
+    // Stops the worker and destroys the generation task at the next frame boundary
+    _generationToken.cancel();
+    _game->getBoardPool().recycle(std::move(_field));
 }
 
 void GameScreen::update()
 {
-    if (!_quitDialog)
+    const ScopedAllocationGuard guard("GameScreen::update");
+
+    if (!_field)
+    {
+        if (_game->getInput().isKeyPressed(KEY_ESCAPE))
+        {
+            cancelGeneration();
+        }
+        return;
+    }
+
+    updateCamera();
+
+    if (_game->getInput().isKeyPressed(KEY_ESCAPE))
     {
-        updateCamera();
+        const ScopedAllocationPermit permit;
+        _game->pushScreen(std::make_unique<MainMenuScreen>(_game, true));
     }
 
-    if (IsKeyPressed(KEY_ESCAPE))
+    if (_rules.getState() == GameState::Playing)
     {
-        _quitDialog = !_quitDialog;
+        updateFieldInput();
     }
 
-    if (_gameState == GameState::Playing && _firstTouch)
+    // The main loop might skip frames while idle, so the timer uses real time instead of GetFrameTime()
+    const double now = _game->getClock().getTime();
+    if (_rules.getState() == GameState::Playing && _firstTouch)
     {
-        _time += GetFrameTime();
+        _time += static_cast<float>(now - _lastUpdateTime);
     }
+    _lastUpdateTime = now;
 }
 
 void GameScreen::render()
 {
+    const ScopedAllocationGuard guard("GameScreen::render");
+
     renderBackground();
+    if (!_field)
+    {
+        renderGenerationProgress();
+        return;
+    }
     renderField();
     renderGUI();
 }
 
+void GameScreen::resume()
+{
+    // The timer keeps going while the game is covered otherwise
+    _lastUpdateTime = _game->getClock().getTime();
+}
+
+auto GameScreen::getRedrawTimeout() const -> double
+{
+    if (!_field)
+    {
+        return PROGRESS_REDRAW_INTERVAL;
+    }
+    if (_rules.getState() != GameState::Playing || !_firstTouch)
+    {
+        return -1.0;
+    }
+
+    // Redraw when the displayed second changes
+    const double time = _time + (_game->getClock().getTime() - _lastUpdateTime);
+    return 1.0 - (time - std::floor(time));
+}
+
+auto GameScreen::generateField(const int width, const int height, const int mineCount) -> Task
+{
+    // Only the progress and the token are shared with the worker, the screen might be gone before it finishes
+    auto storage = _game->getBoardPool().takeStorage();
+    // Named instead of a temporary inside co_await, GCC 12 destroys such temporaries twice and would release the
+    // shared progress and token once too often
+    auto generate = [width, height, mineCount, progress = _generationProgress, token = _generationToken,
+                     storage = std::move(storage)]() mutable {
+        return MineField::generate(
+            width, height, mineCount,
+            [&progress, &token](const float value) {
+                progress->store(value, std::memory_order_relaxed);
+                return !token.isCancelled();
+            },
+            std::move(storage));
+    };
+    auto field = co_await background(std::move(generate));
+
+    // A cancelled generation never resumes here, the task is destroyed together with the field instead
+    setField(std::move(field));
+}
+
+void GameScreen::setField(std::unique_ptr<MineField> field)
+{
+    _field = std::move(field);
+    _rules.start(*_field);
+    calculateRenderSizes();
+
+    _game->getFlightRecorder().recordBoard(_field->getWidth(), _field->getHeight(), _field->getBombCount(),
+                                           _field->getSeed(), _game->getAutoChordSetting());
+}
+
+void GameScreen::cancelGeneration()
+{
+    const ScopedAllocationPermit permit;
+    _generationToken.cancel();
+    _game->replaceScreen(std::make_unique<MainMenuScreen>(_game));
+}
+
 void GameScreen::setupCamera()
 {
     _camera.target = {0, 0};
@@ -96,377 +207,265 @@ void GameScreen::setupCamera()
 
 void GameScreen::calculateRenderSizes()
 {
-    const auto tileWidth  = static_cast<float>(GetScreenWidth()) / static_cast<float>(_field.getWidth());
-    const auto tileHeight = static_cast<float>(GetScreenHeight()) / static_cast<float>(_field.getHeight());
+    const IRenderBackend& renderer = _game->getRenderer();
+
+    const auto tileWidth  = static_cast<float>(renderer.getScreenWidth()) / static_cast<float>(_field->getWidth());
+    const auto tileHeight = static_cast<float>(renderer.getScreenHeight()) / static_cast<float>(_field->getHeight());
     _renderTileSize       = std::min(tileWidth, tileHeight);
 
-    _renderFieldSize.x = static_cast<float>(_field.getWidth()) * _renderTileSize;
-    _renderFieldSize.y = static_cast<float>(_field.getHeight()) * _renderTileSize;
+    _renderFieldSize.x = static_cast<float>(_field->getWidth()) * _renderTileSize;
+    _renderFieldSize.y = static_cast<float>(_field->getHeight()) * _renderTileSize;
 }
 
 void GameScreen::updateCamera()
 {
+    const IInputProvider& input = _game->getInput();
+
     // Camera drag
     static bool dragCamera = false;
 
-    if (IsMouseButtonPressed(MOUSE_BUTTON_MIDDLE))
+    if (input.isMouseButtonPressed(MOUSE_BUTTON_MIDDLE))
     {
         dragCamera = true;
     }
-    if (IsMouseButtonReleased(MOUSE_BUTTON_MIDDLE))
+    if (input.isMouseButtonReleased(MOUSE_BUTTON_MIDDLE))
     {
         dragCamera = false;
     }
     if (dragCamera)
     {
-        const Vector2 diff = Vector2Divide(GetMouseDelta(), {_camera.zoom, _camera.zoom});
+        const Vector2 diff = Vector2Divide(input.getMouseDelta(), {_camera.zoom, _camera.zoom});
         _camera.target     = Vector2Subtract(_camera.target, diff);
     }
 
     // Camera zoom
-    _camera.zoom = std::max(_camera.zoom + GetMouseWheelMove() * ZOOM_MULTIPLIER, MINIMUM_ZOOM_LEVEL);
+    _camera.zoom = std::max(_camera.zoom + input.getMouseWheelMove() * ZOOM_MULTIPLIER, MINIMUM_ZOOM_LEVEL);
 
     // Camera offset
-    _camera.offset.x = static_cast<float>(GetScreenWidth()) / 2.F;
-    _camera.offset.y = static_cast<float>(GetScreenHeight()) / 2.F;
-}
-
-void GameScreen::renderBackground() const
-{
-    Rectangle destination{0.F, 0.F, 0.F, 0.F};
-    destination.width  = static_cast<float>(GetScreenWidth());
-    destination.height = static_cast<float>(GetScreenHeight());
-
-    DrawTexturePro(_game->getTheme()->getBackground(), {0.F, 0.F, -1.F, -1.F}, destination, {0.F, 0.F}, 0.F, WHITE);
-}
-
-void GameScreen::renderField()
-{
-    const auto tileSize = static_cast<float>(_game->getTheme()->getTileSize());
-
-    BeginMode2D(_camera);
-    {
-        for (int row = 0; row < _field.getHeight(); row++)
-        {
-            for (int column = 0; column < _field.getWidth(); column++)
-            {
-                renderTile(row, column, tileSize);
-            }
-        }
-    }
-    EndMode2D();
+    _camera.offset.x = static_cast<float>(_game->getRenderer().getScreenWidth()) / 2.F;
+    _camera.offset.y = static_cast<float>(_game->getRenderer().getScreenHeight()) / 2.F;
 }
 
-void GameScreen::renderTile(const int row, const int column, const float tileSize)
+void GameScreen::updateFieldInput()
 {
-    const Tile& tile = _field.getTile(row, column);
-
-    Rectangle source{0.F, 0.F, 0.F, 0.F};
-    switch (tile.state)
+    int row    = 0;
+    int column = 0;
+    if (!getTileUnderMouse(row, column))
     {
-    case TileState::Closed:
-        source.x = CLOSED_NUM * tileSize;
-        break;
-    case TileState::Open:
-        source.x = static_cast<float>(tile.number) * tileSize;
-        break;
-    case TileState::Flagged:
-        source.x = FLAG_NUM * tileSize;
-        break;
+        return;
     }
 
-    source.width  = tileSize;
-    source.height = tileSize;
-
-    Rectangle destination{0.F, 0.F, 0.F, 0.F};
-    destination.x      = static_cast<float>(column) * _renderTileSize - _renderFieldSize.x / 2.F;
-    destination.y      = static_cast<float>(row) * _renderTileSize - _renderFieldSize.y / 2.F;
-    destination.width  = _renderTileSize;
-    destination.height = _renderTileSize;
-
-    switch (tileButton(source, destination))
+    const IInputProvider& input = _game->getInput();
+    if (input.isMouseButtonReleased(MOUSE_BUTTON_LEFT))
     {
-    case MOUSE_BUTTON_LEFT:
         _firstTouch = true;
-        handleTileLeftClick(tile, row, column);
-        break;
-    case MOUSE_BUTTON_RIGHT:
+        _game->getFlightRecorder().recordAction(FlightAction::LeftClick, row, column, _game->getAutoChordSetting());
+        _rules.setAutoChord(_game->getAutoChordSetting());
+        _rules.leftClick(row, column);
+    } else if (input.isMouseButtonPressed(MOUSE_BUTTON_RIGHT))
+    {
         _firstTouch = true;
-        handleTileRightClick(row, column);
-        break;
-    default:
-        break;
+        _game->getFlightRecorder().recordAction(FlightAction::RightClick, row, column, _game->getAutoChordSetting());
+        _rules.setAutoChord(_game->getAutoChordSetting());
+        _rules.rightClick(row, column);
     }
 }
 
-void GameScreen::renderGUI()
+void GameScreen::renderBackground() const
 {
-    if (_gameState == GameState::Exploded)
-    {
-        renderCenteredText("Game Over!", RED);
-    } else if (_gameState == GameState::Won)
-    {
-        renderCenteredText("You Win!", GREEN);
-    }
+    IRenderBackend& renderer = _game->getRenderer();
 
-    renderAndHandleRetryButton();
-    renderAndHandleQuitDialog();
+    Rectangle destination{0.F, 0.F, 0.F, 0.F};
+    destination.width  = static_cast<float>(renderer.getScreenWidth());
+    destination.height = static_cast<float>(renderer.getScreenHeight());
 
-    renderTime();
-    renderBombCount();
+    renderer.drawTexture(_game->getTheme()->getBackground(), {0.F, 0.F, -1.F, -1.F}, destination, WHITE);
 }
 
-void GameScreen::renderCenteredText(const char* text, const Color& color) const
+void GameScreen::renderField()
 {
-    auto [textWidth, textHeight] = MeasureTextEx(_game->getTheme()->getFont(), text, FONT_SIZE_BIG, 1.F);
-
-    const auto    screenWidth  = static_cast<float>(GetScreenWidth());
-    const auto    screenHeight = static_cast<float>(GetScreenHeight());
-    const Vector2 position{screenWidth / 2 - textWidth / 2, screenHeight - 2 * textHeight};
-
-    DrawTextEx(_game->getTheme()->getFont(), text, position, FONT_SIZE_BIG, 1.F, color);
-}
+    WS_PROFILE_FUNCTION();
+    FrameStats&            stats = _game->getFrameStats();
+    const ScopedFramePhase phase(stats, FramePhase::Field);
 
-void GameScreen::renderTime() const
-{
-    const int totalSeconds = static_cast<int>(_time);
-    const int minutes      = totalSeconds / 60;
-    const int seconds      = totalSeconds % 60;
+    const TileRenderDescriptor& tiles     = _game->getTheme()->getTileRenderDescriptor();
+    const int                   tileCount = _field->getWidth() * _field->getHeight();
 
-    const char* text = TextFormat("%02d:%02d", minutes, seconds);
+    IRenderBackend& renderer = _game->getRenderer();
+    renderer.beginCamera(_camera);
+    const FieldShader& fieldShader = _game->getFieldShader();
+    if (_game->getShaderRenderingSetting() && fieldShader.isSupported())
+    {
+        _fieldState.update(*_field, _game->getFrameArena());
 
-    const auto [x, y] = MeasureTextEx(_game->getTheme()->getFont(), text, FONT_SIZE_SMALL, 1.F);
+        const Rectangle destination{-_renderFieldSize.x / 2.F, -_renderFieldSize.y / 2.F, _renderFieldSize.x,
+                                    _renderFieldSize.y};
+        fieldShader.render(_fieldState, tiles.texture, tiles.tileSize, destination);
+    } else
+    {
+        renderTiles(tiles);
+    }
+    renderer.endCamera();
 
-    DrawTextEx(_game->getTheme()->getFont(), text,
-               {static_cast<float>(GetScreenWidth()) - x - GUI::WINDOW_PADDING, GUI::WINDOW_PADDING}, FONT_SIZE_SMALL,
-               1.F, _game->getTheme()->getFontColor());
+    stats.addTilesDrawn(tileCount);
+    Metrics::add(Metric::TilesDrawn, static_cast<uint64_t>(tileCount));
 }
 
-void GameScreen::renderBombCount() const
+void GameScreen::renderTiles(const TileRenderDescriptor& tiles) const
 {
-    const char* text = TextFormat("%i", _bombCount);
-
-    const auto [x, y] = MeasureTextEx(_game->getTheme()->getFont(), text, FONT_SIZE_SMALL, 1.F);
-
-    const float posX = static_cast<float>(GetScreenWidth()) - x - GUI::WINDOW_PADDING;
-    const float posY = GUI::WINDOW_PADDING + GUI::ITEM_SPACING + y;
-
-    DrawTextEx(_game->getTheme()->getFont(), text, {posX, posY}, FONT_SIZE_SMALL, 1.F,
-               _game->getTheme()->getFontColor());
-}
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     left     = -_renderFieldSize.x / 2.F;
+    const float     top      = -_renderFieldSize.y / 2.F;
 
-void GameScreen::renderAndHandleQuitDialog()
-{
-    if (GuiButton({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_WIDTH, GUI_BUTTON_HEIGHT}, "Back") != 0)
-    {
-        _quitDialog = true;
-    }
-    if (_quitDialog)
+    Rectangle destination{0.F, 0.F, _renderTileSize, _renderTileSize};
+    for (int row = 0; row < _field->getHeight(); row++)
     {
-        const Vector2 pos{static_cast<float>(GetScreenWidth()) / 2 - GUI_QUIT_DIALOG_WIDTH / 2,
-                          static_cast<float>(GetScreenHeight()) / 2 - GUI_QUIT_DIALOG_HEIGHT / 2};
-
-        switch (GuiMessageBox({pos.x, pos.y, GUI_QUIT_DIALOG_WIDTH, GUI_QUIT_DIALOG_HEIGHT}, "#191#",
-                              "Are you sure you want to return to the main menu?", "Cancel;Yes"))
+        destination.y = top + static_cast<float>(row) * _renderTileSize;
+        for (int column = 0; column < _field->getWidth(); column++)
         {
-        case 0:
-        case 1:
-            _quitDialog = false;
-            break;
-        case 2:
-            _game->setScreen(std::make_unique<MainMenuScreen>(_game));
-        default:
-            break;
+            destination.x = left + static_cast<float>(column) * _renderTileSize;
+
+            const Rectangle& source = tiles.sources[packTile(_field->getTile(row, column))];
+            renderer.drawTexture(tiles.texture, source, destination, WHITE);
         }
     }
 }
 
-void GameScreen::renderAndHandleRetryButton()
+void GameScreen::renderGenerationProgress()
 {
-    if (_gameState != GameState::Playing)
+    if (_game->getClock().getTime() - _generationStart < PROGRESS_DELAY)
     {
-        if (GuiButton({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING + GUI::ITEM_SPACING + GUI_BUTTON_HEIGHT,
-                       GUI_BUTTON_WIDTH, GUI_BUTTON_HEIGHT},
-                      "Retry") != 0)
-        {
-            _game->setScreen(
-                std::make_unique<GameScreen>(_game, _field.getWidth(), _field.getHeight(), _field.getBombCount()));
-        }
+        return;
     }
-}
 
-void GameScreen::handleTileLeftClick(const Tile& tile, const int row, const int column)
-{
-    if (tile.state == TileState::Open && tile.number != 0)
-    {
-        doChordClick(row, column);
-    } else
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     posX     = static_cast<float>(renderer.getScreenWidth()) / 2 - GUI_PROGRESS_WIDTH / 2;
+    const float     posY     = static_cast<float>(renderer.getScreenHeight()) / 2 - GUI_PROGRESS_HEIGHT / 2;
+
+    renderer.label({posX, posY - GUI_BUTTON_HEIGHT - GUI::ITEM_SPACING, GUI_PROGRESS_WIDTH, GUI_BUTTON_HEIGHT},
+                   "Generating field...");
+    renderer.progressBar({posX, posY, GUI_PROGRESS_WIDTH, GUI_PROGRESS_HEIGHT},
+                         _generationProgress->load(std::memory_order_relaxed));
+
+    const float buttonX = static_cast<float>(renderer.getScreenWidth()) / 2 - GUI_BUTTON_WIDTH / 2;
+    if (renderer.button({buttonX, posY + GUI_PROGRESS_HEIGHT + GUI::ITEM_SPACING, GUI_BUTTON_WIDTH, GUI_BUTTON_HEIGHT},
+                        "Cancel"))
     {
-        doSingleTileClick(row, column);
+        cancelGeneration();
     }
 }
 
-void GameScreen::doSingleTileClick(const int row, const int column)
+void GameScreen::renderGUI()
 {
-    auto& [number, state] = _field.getTile(row, column);
-    if (state == TileState::Open || state == TileState::Flagged)
-    {
-        return;
-    }
+    const ScopedFramePhase phase(_game->getFrameStats(), FramePhase::Gui);
+    const ITheme&          theme    = *_game->getTheme();
+    IRenderBackend&        renderer = _game->getRenderer();
 
-    if (number == 0)
+    // All theme font text in one shader block, raygui draws with its own font afterwards
+    renderer.beginShader(theme.getFontShader());
     {
-        openEmtpyTilesRecursive(row, column);
-    } else
-    {
-        if (number != BOMB_NUM)
+        if (_rules.getState() == GameState::Exploded)
         {
-            _normalTileCount--;
-        }
-        state = TileState::Open;
-        if (_game->getAutoChordSetting())
+            renderCenteredText(theme, "Game Over!", RED);
+        } else if (_rules.getState() == GameState::Won)
         {
-            doChordClick(row, column);
+            renderCenteredText(theme, "You Win!", GREEN);
         }
-    }
 
-    if (number == BOMB_NUM)
-    {
-        explode();
+        renderTime(theme);
+        renderBombCount(theme);
     }
+    renderer.endShader();
 
-    if (_normalTileCount == 0)
-    {
-        _gameState = GameState::Won;
-    }
+    renderAndHandleRetryButton();
+    renderAndHandleBackButton();
 }
 
-void GameScreen::doChordClick(const int row, const int column)
+void GameScreen::renderCenteredText(const ITheme& theme, const char* text, const Color& color)
 {
-    // Count flags
-    int flagCount = 0;
-    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field.getHeight() - 1); blockRow++)
-    {
-        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field.getWidth() - 1);
-             blockColumn++)
-        {
-            if (_field.getTile(blockRow, blockColumn).state == TileState::Flagged)
-            {
-                flagCount++;
-            }
-        }
-    }
+    const Font& font                   = theme.getFont();
+    const auto [textWidth, textHeight] = _centeredLabel.measure(theme, text, FONT_SIZE_BIG);
 
-    if (flagCount != _field.getTile(row, column).number)
-    {
-        return;
-    }
+    IRenderBackend& renderer     = _game->getRenderer();
+    const auto      screenWidth  = static_cast<float>(renderer.getScreenWidth());
+    const auto      screenHeight = static_cast<float>(renderer.getScreenHeight());
+    const Vector2   position{screenWidth / 2 - textWidth / 2, screenHeight - 2 * textHeight};
 
-    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field.getHeight() - 1); blockRow++)
-    {
-        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field.getWidth() - 1);
-             blockColumn++)
-        {
-            doSingleTileClick(blockRow, blockColumn);
-        }
-    }
+    renderer.drawText(font, text, position, FONT_SIZE_BIG, GUI::HUD_TEXT_SPACING, color);
 }
 
-void GameScreen::handleTileRightClick(const int row, const int column)
+void GameScreen::renderTime(const ITheme& theme)
 {
-    auto& [number, state] = _field.getTile(row, column);
-    if (state == TileState::Open)
-    {
-        return;
-    }
-    if (state == TileState::Closed)
-    {
-        state = TileState::Flagged;
-        _bombCount--;
-    } else
-    {
-        state = TileState::Closed;
-        _bombCount++;
-    }
+    const DigitStrip& strip = theme.getDigitStrip();
 
-    if (_game->getAutoChordSetting())
-    {
-        doAutoChord(row, column);
-    }
+    _timeCounter.setTime(static_cast<int>(_time));
+    const auto [x, y] = _timeCounter.getSize(strip);
+
+    IRenderBackend& renderer = _game->getRenderer();
+    const Vector2   position{static_cast<float>(renderer.getScreenWidth()) - x - GUI::WINDOW_PADDING,
+                           GUI::WINDOW_PADDING};
+    _timeCounter.draw(renderer, strip, position, theme.getFontColor());
 }
 
-void GameScreen::openEmtpyTilesRecursive(const int row, const int column) // NOLINT
+void GameScreen::renderBombCount(const ITheme& theme)
 {
-    auto& [number, state] = _field.getTile(row, column);
-    if (state == TileState::Open)
-    {
-        return;
-    }
+    const DigitStrip& strip = theme.getDigitStrip();
 
-    state = TileState::Open;
-    _normalTileCount--;
-    if (number == 0)
-    {
-        for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field.getHeight() - 1); blockRow++)
-        {
-            for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field.getWidth() - 1);
-                 blockColumn++)
-            {
-                openEmtpyTilesRecursive(blockRow, blockColumn);
-            }
-        }
-    }
+    _bombCounter.setNumber(_rules.getBombCount());
+    const auto [x, y] = _bombCounter.getSize(strip);
+
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     posX     = static_cast<float>(renderer.getScreenWidth()) - x - GUI::WINDOW_PADDING;
+    const float     posY     = GUI::WINDOW_PADDING + GUI::ITEM_SPACING + y;
+
+    _bombCounter.draw(renderer, strip, {posX, posY}, theme.getFontColor());
 }
 
-auto GameScreen::tileButton(const Rectangle& source, const Rectangle& destination) const -> int
+void GameScreen::renderAndHandleBackButton()
 {
-    int button = -1;
-
-    const float   size  = destination.width * _camera.zoom; // height is not important since its always a perfect square
-    const Vector2 mouse = GetMousePosition();
-    if (const auto [x, y] = Vector2Transform({destination.x, destination.y}, GetCameraMatrix2D(_camera));
-        _gameState == GameState::Playing && !_quitDialog && CheckCollisionPointRec(mouse, {x, y, size, size}))
+    // The game is only suspended while the menu covers it, so there is nothing to confirm
+    if (_game->getRenderer().button({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_WIDTH, GUI_BUTTON_HEIGHT},
+                                    "Back"))
     {
-        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-        {
-            button = MOUSE_BUTTON_LEFT;
-        } else if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))
-        {
-            button = MOUSE_BUTTON_RIGHT;
-        }
+        const ScopedAllocationPermit permit;
+        _game->pushScreen(std::make_unique<MainMenuScreen>(_game, true));
     }
-
-    DrawTexturePro(_game->getTheme()->getSpriteSheet(), source, destination, {0.F, 0.F}, 0.F, WHITE);
-    return button;
 }
 
-void GameScreen::doAutoChord(const int row, const int column)
+void GameScreen::renderAndHandleRetryButton()
 {
-    for (int blockRow = std::max(row - 1, 0); blockRow <= std::min(row + 1, _field.getHeight() - 1); blockRow++)
+    if (_rules.getState() != GameState::Playing)
     {
-        for (int blockColumn = std::max(column - 1, 0); blockColumn <= std::min(column + 1, _field.getWidth() - 1);
-             blockColumn++)
+        const Rectangle bounds{GUI::WINDOW_PADDING, GUI::WINDOW_PADDING + GUI::ITEM_SPACING + GUI_BUTTON_HEIGHT,
+                               GUI_BUTTON_WIDTH, GUI_BUTTON_HEIGHT};
+        if (_game->getRenderer().button(bounds, "Retry"))
         {
-            if (const auto [number, state] = _field.getTile(blockRow, blockColumn);
-                state == TileState::Open && number != 0)
-            {
-                doChordClick(blockRow, blockColumn);
-            }
+            const ScopedAllocationPermit permit;
+            const int                    width     = _field->getWidth();
+            const int                    height    = _field->getHeight();
+            const int                    bombCount = _field->getBombCount();
+
+            // The finished field becomes the storage of the next board, so it has to be recycled before the
+            // replacement takes one. Nothing touches the field anymore until this screen is gone.
+            _game->getBoardPool().recycle(std::move(_field));
+            _game->replaceScreen(std::make_unique<GameScreen>(_game, width, height, bombCount));
         }
     }
 }
 
-void GameScreen::explode()
+auto GameScreen::getTileUnderMouse(int& row, int& column) const -> bool
 {
-    _gameState = GameState::Exploded;
-    for (int row = 0; row < _field.getHeight(); row++)
+    Metrics::add(Metric::HitTests);
+    const Vector2 mouse = GetScreenToWorld2D(_game->getInput().getMousePosition(), _camera);
+
+    const float fieldX = mouse.x + _renderFieldSize.x / 2.F;
+    const float fieldY = mouse.y + _renderFieldSize.y / 2.F;
+    if (fieldX < 0.F || fieldY < 0.F)
     {
-        for (int column = 0; column < _field.getWidth(); column++)
-        {
-            if (auto& [number, state] = _field.getTile(row, column); number == BOMB_NUM && state != TileState::Flagged)
-            {
-                state = TileState::Open;
-            }
-        }
+        return false;
     }
+
+    row    = static_cast<int>(fieldY / _renderTileSize);
+    column = static_cast<int>(fieldX / _renderTileSize);
+    return row < _field->getHeight() && column < _field->getWidth();
 }
\ No newline at end of file
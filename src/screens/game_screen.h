@@ -25,63 +25,68 @@
 #ifndef WS_SCREENS_GAME_SCREEN_H
 #define WS_SCREENS_GAME_SCREEN_H
 
+#include <atomic>
+#include <memory>
 #include <raylib.h>
 
+#include "app/task.h"
+#include "components/field_shader.h"
+#include "components/game_rules.h"
 #include "components/mine_field.h"
 #include "components/screen.h"
+#include "components/tile_render_descriptor.h"
+#include "gui/hud.h"
+
+class ITheme;
 
 class GameScreen final : public Screen
 {
-    enum class GameState : uint8_t
-    {
-        Playing = 0,
-        Won,
-        Exploded
-    };
 public:
+    // The field is generated in the background, a progress bar is shown until it is ready
     GameScreen(Wyrmsweeper* game, int width, int height, int mineCount);
+    ~GameScreen() override;
+
+    GameScreen(const GameScreen&)                    = delete;
+    auto operator=(const GameScreen&) -> GameScreen& = delete;
 
     void update() override;
     void render() override;
+    void resume() override;
+
+    [[nodiscard]] auto getRedrawTimeout() const -> double override;
 private:
     // Setup functions
-    void setupCamera();
-    void calculateRenderSizes();
+    [[nodiscard]] auto generateField(int width, int height, int mineCount) -> Task;
+    void               setField(std::unique_ptr<MineField> field);
+    void               cancelGeneration();
+    void               setupCamera();
+    void               calculateRenderSizes();
 
     // Update functions
     void updateCamera();
+    void updateFieldInput();
 
     // Rendering functions
     void renderBackground() const;
+    void renderGenerationProgress();
     void renderField();
-    void renderTile(int row, int column, float tileSize);
+    void renderTiles(const TileRenderDescriptor& tiles) const;
     void renderGUI();
-    void renderCenteredText(const char* text, const Color& color) const;
-    void renderTime() const;
-    void renderBombCount() const;
+    void renderCenteredText(const ITheme& theme, const char* text, const Color& color);
+    void renderTime(const ITheme& theme);
+    void renderBombCount(const ITheme& theme);
 
     // GUI
-    void renderAndHandleQuitDialog();
+    void renderAndHandleBackButton();
     void renderAndHandleRetryButton();
 
-    // Game logic functions
-    void handleTileLeftClick(const Tile& tile, int row, int column);
-    void doSingleTileClick(int row, int column);
-    void doChordClick(int row, int column);
-    void handleTileRightClick(int row, int column);
-    void openEmtpyTilesRecursive(int row, int column);
-    void doAutoChord(int row, int column);
-    void explode();
-
     // Helper functions
-    [[nodiscard]] auto tileButton(const Rectangle& source, const Rectangle& destination) const -> int;
+    [[nodiscard]] auto getTileUnderMouse(int& row, int& column) const -> bool;
 private:
     // Game state
-    GameState _gameState;
-    int       _bombCount;
-    int       _normalTileCount;
+    GameRules _rules;
     float     _time;
-    bool      _quitDialog;
+    double    _lastUpdateTime;
     bool      _firstTouch;
 
     // Rendering properties
@@ -89,8 +94,19 @@ private:
     Vector2  _renderFieldSize;
     Camera2D _camera;
 
+    // HUD
+    HudCounter _timeCounter;
+    HudCounter _bombCounter;
+    HudLabel   _centeredLabel;
+
+    // Field generation
+    std::shared_ptr<std::atomic<float>> _generationProgress;
+    CancellationToken                   _generationToken;
+    double                              _generationStart;
+
     // Game elements
-    MineField _field;
+    std::unique_ptr<MineField> _field; // Null while generating
+    FieldStateTexture          _fieldState;
 };
 
 #endif
\ No newline at end of file
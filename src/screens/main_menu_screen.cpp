@@ -53,15 +53,22 @@ constexpr int FIELD_HARD_BOMB_COUNT = 99;
 
 constexpr int CUSTOM_DEFAULT_VALUE = 10;
 
-MainMenuScreen::MainMenuScreen(Wyrmsweeper* game)
+MainMenuScreen::MainMenuScreen(Wyrmsweeper* game, const bool resumable)
     : Screen(game)
     , _menuState(MenuState::Title)
+    , _resumable(resumable)
     , _customWidth(CUSTOM_DEFAULT_VALUE)
     , _customHeight(CUSTOM_DEFAULT_VALUE)
     , _customBombCount(CUSTOM_DEFAULT_VALUE)
 {}
 
-void MainMenuScreen::update() {}
+void MainMenuScreen::update()
+{
+    if (_resumable && _menuState == MenuState::Title && _game->getInput().isKeyPressed(KEY_ESCAPE))
+    {
+        _game->popScreen();
+    }
+}
 
 void MainMenuScreen::render()
 {
@@ -84,32 +91,50 @@ void MainMenuScreen::render()
 void MainMenuScreen::renderTitleState()
 {
     // Title
-    const auto [titleWidth, titleHeight] =
-        MeasureTextEx(_game->getTheme()->getFont(), "Wyrmsweeper", FONT_SIZE_TITLE, 1.F);
+    const ITheme&   theme                = *_game->getTheme();
+    IRenderBackend& renderer             = _game->getRenderer();
+    const auto [titleWidth, titleHeight] = MeasureTextEx(theme.getFont(), "Wyrmsweeper", FONT_SIZE_TITLE, 1.F);
 
-    const float posX = static_cast<float>(GetScreenWidth()) / 2.F - titleWidth / 2.F;
-    const float posY = static_cast<float>(GetScreenHeight()) / 4.F;
+    const float posX = static_cast<float>(renderer.getScreenWidth()) / 2.F - titleWidth / 2.F;
+    const float posY = static_cast<float>(renderer.getScreenHeight()) / 4.F;
 
-    DrawTextEx(_game->getTheme()->getFont(), "Wyrmsweeper", {posX, posY}, FONT_SIZE_TITLE, 1.F,
-               _game->getTheme()->getFontColor());
+    renderer.beginShader(theme.getFontShader());
+    renderer.drawText(theme.getFont(), "Wyrmsweeper", {posX, posY}, FONT_SIZE_TITLE, 1.F, theme.getFontColor());
+    renderer.endShader();
 
     // Buttons
-    const float buttonY = static_cast<float>(GetScreenHeight()) - static_cast<float>(GetScreenHeight()) / 2.F;
+    const float buttonY = static_cast<float>(renderer.getScreenHeight()) -
+                          static_cast<float>(renderer.getScreenHeight()) / 2.F;
 
-    if (centeredButton("Play", buttonY))
+    float       buttonOffset = 0.F;
+
+    if (_resumable)
+    {
+        if (centeredButton("Resume", buttonY))
+        {
+            _game->popScreen();
+        }
+        buttonOffset = GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING;
+    }
+    if (centeredButton("Play", buttonY + buttonOffset))
     {
         _menuState = MenuState::Difficulty;
     }
-    if (centeredButton("Quit", buttonY + GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING))
+    if (centeredButton("Quit", buttonY + buttonOffset + GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING))
     {
         _game->quit();
     }
 
     // Auto chording checkbox
-    const float checkPosY = static_cast<float>(GetScreenHeight()) - GUI_CHECKBOX_SIZE - GUI::WINDOW_PADDING;
+    const float checkPosY = static_cast<float>(renderer.getScreenHeight()) - GUI_CHECKBOX_SIZE - GUI::WINDOW_PADDING;
+
+    renderer.checkBox({GUI::WINDOW_PADDING, checkPosY, GUI_CHECKBOX_SIZE, GUI_CHECKBOX_SIZE}, "Auto Chording",
+                      _game->getAutoChordSetting());
 
-    GuiCheckBox({GUI::WINDOW_PADDING, checkPosY, GUI_CHECKBOX_SIZE, GUI_CHECKBOX_SIZE}, "Auto Chording",
-                &_game->getAutoChordSetting());
+    // Shader rendering checkbox
+    renderer.checkBox({GUI::WINDOW_PADDING, checkPosY - GUI_CHECKBOX_SIZE - GUI::ITEM_SPACING, GUI_CHECKBOX_SIZE,
+                       GUI_CHECKBOX_SIZE},
+                      "Shader Rendering", _game->getShaderRenderingSetting());
 }
 
 void MainMenuScreen::renderDifficultyState()
@@ -117,23 +142,21 @@ void MainMenuScreen::renderDifficultyState()
     // Difficulty buttons
     constexpr float buttonCount = 4;
 
+    IRenderBackend& renderer      = _game->getRenderer();
     constexpr float buttonsHeight = buttonCount * GUI_BUTTON_SIZE.y + (buttonCount - 1) * GUI::ITEM_SPACING;
-    const float     buttonY       = static_cast<float>(GetScreenHeight()) / 2.F - buttonsHeight / 2.F;
+    const float     buttonY       = static_cast<float>(renderer.getScreenHeight()) / 2.F - buttonsHeight / 2.F;
 
     if (centeredButton("Easy", buttonY))
     {
-        _game->setScreen(
-            std::make_unique<GameScreen>(_game, FIELD_EASY_WIDTH, FIELD_EASY_HEIGHT, FIELD_EASY_BOMB_COUNT));
+        startGame(FIELD_EASY_WIDTH, FIELD_EASY_HEIGHT, FIELD_EASY_BOMB_COUNT);
     }
     if (centeredButton("Advanced", buttonY + GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING))
     {
-        _game->setScreen(std::make_unique<GameScreen>(_game, FIELD_INTERMEDIATE_WIDTH, FIELD_INTERMEDIATE_HEIGHT,
-                                                      FIELD_INTERMEDIATE_BOMB_COUNT));
+        startGame(FIELD_INTERMEDIATE_WIDTH, FIELD_INTERMEDIATE_HEIGHT, FIELD_INTERMEDIATE_BOMB_COUNT);
     }
     if (centeredButton("Hard", buttonY + 2 * GUI_BUTTON_SIZE.y + 2 * GUI::ITEM_SPACING))
     {
-        _game->setScreen(
-            std::make_unique<GameScreen>(_game, FIELD_HARD_WIDTH, FIELD_HARD_HEIGHT, FIELD_HARD_BOMB_COUNT));
+        startGame(FIELD_HARD_WIDTH, FIELD_HARD_HEIGHT, FIELD_HARD_BOMB_COUNT);
     }
     if (centeredButton("Custom", buttonY + 3 * GUI_BUTTON_SIZE.y + 3 * GUI::ITEM_SPACING))
     {
@@ -141,7 +164,7 @@ void MainMenuScreen::renderDifficultyState()
     }
 
     // Back button
-    if (GuiButton({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, "Back") != 0)
+    if (renderer.button({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, "Back"))
     {
         _menuState = MenuState::Title;
     }
@@ -153,21 +176,22 @@ void MainMenuScreen::renderCustomState()
     constexpr float widgetCount  = 4;
     constexpr float widgetHeight = widgetCount * GUI_BUTTON_SIZE.y + (widgetCount - 1) * GUI::ITEM_SPACING;
 
-    const float widgetY = static_cast<float>(GetScreenHeight()) / 2.F - widgetHeight / 2.F;
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     widgetY  = static_cast<float>(renderer.getScreenHeight()) / 2.F - widgetHeight / 2.F;
 
     static bool widthEditMode = false;
-    if (centeredSpinner("Width", widgetY, &_customWidth, widthEditMode) != 0)
+    if (centeredSpinner("Width", widgetY, _customWidth, widthEditMode))
     {
         widthEditMode = !widthEditMode;
     }
     static bool heightEditMode = false;
-    if (centeredSpinner("Height", widgetY + GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING, &_customHeight, heightEditMode) != 0)
+    if (centeredSpinner("Height", widgetY + GUI_BUTTON_SIZE.y + GUI::ITEM_SPACING, _customHeight, heightEditMode))
     {
         heightEditMode = !heightEditMode;
     }
     static bool bombEditMode = false;
-    if (centeredSpinner("Bombs", widgetY + 2 * GUI_BUTTON_SIZE.y + 2 * GUI::ITEM_SPACING, &_customBombCount,
-                        bombEditMode) != 0)
+    if (centeredSpinner("Bombs", widgetY + 2 * GUI_BUTTON_SIZE.y + 2 * GUI::ITEM_SPACING, _customBombCount,
+                        bombEditMode))
     {
         bombEditMode = !bombEditMode;
     }
@@ -175,7 +199,7 @@ void MainMenuScreen::renderCustomState()
     // Play button
     if (centeredButton("Play", widgetY + 3 * GUI_BUTTON_SIZE.y + 3 * GUI::ITEM_SPACING) && checkCustomValues())
     {
-        _game->setScreen(std::make_unique<GameScreen>(_game, _customWidth, _customHeight, _customBombCount));
+        startGame(_customWidth, _customHeight, _customBombCount);
     }
 
     // Error text
@@ -185,12 +209,13 @@ void MainMenuScreen::renderCustomState()
 
         const int textCol = GuiGetStyle(LABEL, TEXT_COLOR_NORMAL);
         GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, 0xFF0000FF);
-        GuiLabel({0.F, posY, static_cast<float>(GetScreenWidth()), GUI_BUTTON_SIZE.y}, "Field not possible!");
+        renderer.label({0.F, posY, static_cast<float>(renderer.getScreenWidth()), GUI_BUTTON_SIZE.y},
+                       "Field not possible!");
         GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, textCol);
     }
 
     // Back button
-    if (GuiButton({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, "Back") != 0)
+    if (renderer.button({GUI::WINDOW_PADDING, GUI::WINDOW_PADDING, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, "Back"))
     {
         _menuState = MenuState::Title;
     }
@@ -198,11 +223,13 @@ void MainMenuScreen::renderCustomState()
 
 void MainMenuScreen::renderBackground() const
 {
+    IRenderBackend& renderer = _game->getRenderer();
+
     Rectangle destination{0.F, 0.F, 0.F, 0.F};
-    destination.width  = static_cast<float>(GetScreenWidth());
-    destination.height = static_cast<float>(GetScreenHeight());
+    destination.width  = static_cast<float>(renderer.getScreenWidth());
+    destination.height = static_cast<float>(renderer.getScreenHeight());
 
-    DrawTexturePro(_game->getTheme()->getBackground(), {0.F, 0.F, -1.F, -1.F}, destination, {0.F, 0.F}, 0.F, WHITE);
+    renderer.drawTexture(_game->getTheme()->getBackground(), {0.F, 0.F, -1.F, -1.F}, destination, WHITE);
 }
 
 auto MainMenuScreen::checkCustomValues() const -> bool
@@ -210,17 +237,32 @@ auto MainMenuScreen::checkCustomValues() const -> bool
     return _customBombCount < _customWidth * _customHeight;
 }
 
-auto MainMenuScreen::centeredButton(const char* text, const float posY) -> bool
+void MainMenuScreen::startGame(const int width, const int height, const int bombCount) const
+{
+    // The pause menu covers the running game, which the new one replaces. Otherwise the menu is the bottom screen.
+    auto screen = std::make_unique<GameScreen>(_game, width, height, bombCount);
+    if (_resumable)
+    {
+        _game->popAndReplaceScreen(std::move(screen));
+    } else
+    {
+        _game->replaceScreen(std::move(screen));
+    }
+}
+
+auto MainMenuScreen::centeredButton(const char* text, const float posY) const -> bool
 {
-    const float posX = static_cast<float>(GetScreenWidth()) / 2.F - GUI_BUTTON_SIZE.x / 2.F;
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     posX     = static_cast<float>(renderer.getScreenWidth()) / 2.F - GUI_BUTTON_SIZE.x / 2.F;
 
-    return GuiButton({posX, posY, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, text) != 0;
+    return renderer.button({posX, posY, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, text);
 }
 
-auto MainMenuScreen::centeredSpinner(const char* text, const float posY, int* val, const bool editMode) -> int
+auto MainMenuScreen::centeredSpinner(const char* text, const float posY, int& val, const bool editMode) const -> bool
 {
-    const float posX = static_cast<float>(GetScreenWidth()) / 2.F - GUI_BUTTON_SIZE.x / 2.F;
+    IRenderBackend& renderer = _game->getRenderer();
+    const float     posX     = static_cast<float>(renderer.getScreenWidth()) / 2.F - GUI_BUTTON_SIZE.x / 2.F;
 
-    return GuiSpinner({posX, posY, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, text, val, GUI_MIN_SPINNER_VAL,
-                      GUI_MAX_SPINNER_VAL, editMode);
+    return renderer.spinner({posX, posY, GUI_BUTTON_SIZE.x, GUI_BUTTON_SIZE.y}, text, val, GUI_MIN_SPINNER_VAL,
+                            GUI_MAX_SPINNER_VAL, editMode);
 }
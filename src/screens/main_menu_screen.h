@@ -38,7 +38,8 @@ class MainMenuScreen final : public Screen
         Custom
     };
 public:
-    explicit MainMenuScreen(Wyrmsweeper* game);
+    // A resumable menu is pushed on top of a game and offers to return to it
+    explicit MainMenuScreen(Wyrmsweeper* game, bool resumable = false);
 
     void update() override;
     void render() override;
@@ -52,13 +53,15 @@ private:
 
     // State functions
     auto checkCustomValues() const -> bool;
+    void startGame(int width, int height, int bombCount) const;
 
     // GUI helper functions
-    static auto centeredButton(const char* text, float posY) -> bool;
-    static auto centeredSpinner(const char* text, float posY, int* val, bool editMode) -> int;
+    auto centeredButton(const char* text, float posY) const -> bool;
+    auto centeredSpinner(const char* text, float posY, int& val, bool editMode) const -> bool;
 private:
     // State
     MenuState _menuState;
+    bool      _resumable;
     int       _customWidth;
     int       _customHeight;
     int       _customBombCount;
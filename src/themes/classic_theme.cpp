@@ -29,6 +29,7 @@
 
 #include "assets/classic_theme/font.h"
 #include "assets/classic_theme/sprite_sheet.h"
+#include "gui/layout_constants.h"
 #include "thirdparties/raylib_utils.h"
 
 static constexpr int GUI_FONT_SIZE = 16;
@@ -37,24 +38,89 @@ static constexpr Color GUI_FONT_COLOR = {50, 106, 66, 255};
 
 static constexpr unsigned int BACKGROUND_DATA[] = {0xffc0c0c0};
 
-ClassicTheme::ClassicTheme()
-    : _spriteSheet()
+ClassicTheme::ClassicTheme(IRenderBackend& renderer)
+    : ThemeBase(renderer)
+    , _sheetImage()
+    , _guiFontAtlas()
+    , _sdfFontAtlas()
+    , _uploadStep(UploadStep::SpriteSheet)
+    , _spriteSheet()
     , _background()
-    , _font()
+    , _guiFont()
+    , _sdfFont()
+    , _fontShader()
+    , _digitStrip()
+{}
+
+ClassicTheme::~ClassicTheme()
 {
-    loadAssets();
-    setGuiStyle();
+    unloadAssets();
 
-    TraceLog(LOG_INFO, "Classic theme loaded!");
+    TraceLog(LOG_INFO, "Classic theme unloaded!");
 }
 
-ClassicTheme::~ClassicTheme()
+auto ClassicTheme::decode() -> bool
 {
-    unloadAssets();
+    _sheetImage = RaylibUtils::decodeImage(Assets::Classic::SHEET_DATA, Assets::Classic::SHEET_WIDTH,
+                                           Assets::Classic::SHEET_HEIGHT);
 
-    GuiSetFont(GetFontDefault());
+    // Both font atlases are baked at build time, no TTF gets rasterized here
+    _guiFontAtlas = RaylibUtils::decodeBakedFont(Assets::Classic::FONT);
+    _sdfFontAtlas = RaylibUtils::decodeBakedFont(Assets::Classic::FONT_SDF);
 
-    TraceLog(LOG_INFO, "Classic theme unloaded!");
+    // Whatever did decode is freed by unloadAssets() with the theme
+    return _sheetImage.data != nullptr && _guiFontAtlas.data != nullptr && _sdfFontAtlas.data != nullptr;
+}
+
+auto ClassicTheme::uploadNext() -> bool
+{
+    switch (_uploadStep)
+    {
+    case UploadStep::SpriteSheet:
+        _spriteSheet = getRenderer().loadTexture(_sheetImage);
+        publishTileRenderDescriptor();
+        UnloadImage(_sheetImage);
+        _sheetImage = {};
+        _uploadStep = UploadStep::Background;
+        break;
+    case UploadStep::Background:
+        createAndLoadBackground();
+        _uploadStep = UploadStep::GuiFont;
+        break;
+    case UploadStep::GuiFont:
+        _guiFont = RaylibUtils::loadBakedFont(getRenderer(), Assets::Classic::FONT, _guiFontAtlas);
+        UnloadImage(_guiFontAtlas);
+        _guiFontAtlas = {};
+        _uploadStep   = UploadStep::SdfFont;
+        break;
+    case UploadStep::SdfFont:
+        _sdfFont = RaylibUtils::loadBakedFont(getRenderer(), Assets::Classic::FONT_SDF, _sdfFontAtlas);
+        UnloadImage(_sdfFontAtlas);
+        _sdfFontAtlas = {};
+
+        _fontShader = RaylibUtils::loadSdfShader(getRenderer());
+        if (!getRenderer().isShaderSupported(_fontShader))
+        {
+            TraceLog(LOG_WARNING, "SDF font shader not supported, falling back to the bitmap font");
+        }
+        _digitStrip = DigitStrip(getFont(), GUI::HUD_FONT_SIZE, GUI::HUD_TEXT_SPACING);
+        _uploadStep = UploadStep::Done;
+
+        TraceLog(LOG_INFO, "Classic theme loaded!");
+        break;
+    case UploadStep::Done:
+        break;
+    }
+    return _uploadStep != UploadStep::Done;
+}
+
+void ClassicTheme::apply() const
+{
+    GuiSetFont(_guiFont);
+    GuiSetStyle(DEFAULT, TEXT_SIZE, GUI_FONT_SIZE);
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);
+
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 }
 
 auto ClassicTheme::getTileSize() const -> int
@@ -74,30 +140,39 @@ auto ClassicTheme::getBackground() const -> const Texture2D&
 
 auto ClassicTheme::getFont() const -> const Font&
 {
-    return _font;
+    // Without SDF shader support the SDF atlas would render blurry, the raygui font is used instead
+    return getRenderer().isShaderSupported(_fontShader) ? _sdfFont : _guiFont;
 }
 
-auto ClassicTheme::getFontColor() const -> const Color
+auto ClassicTheme::getDigitStrip() const -> const DigitStrip&
 {
-    return GUI_FONT_COLOR;
+    return _digitStrip;
 }
 
-void ClassicTheme::loadAssets()
+auto ClassicTheme::getFontShader() const -> const Shader&
 {
-    _spriteSheet = RaylibUtils::loadTextureFromMemory(Assets::Classic::SHEET_WIDTH, Assets::Classic::SHEET_HEIGHT,
-                                                      Assets::Classic::SHEET_DATA);
-
-    _font = RaylibUtils::loadFontFromMemory(Assets::Classic::FONT_DATA, sizeof(Assets::Classic::FONT_DATA));
+    return _fontShader;
+}
 
-    createAndLoadBackground();
+auto ClassicTheme::getFontColor() const -> const Color
+{
+    return GUI_FONT_COLOR;
 }
 
 void ClassicTheme::unloadAssets() const
 {
-    UnloadTexture(_spriteSheet);
-    UnloadTexture(_background);
-
-    UnloadFont(_font);
+    // Whatever has not been uploaded yet, unloading empty images and textures does nothing
+    UnloadImage(_sheetImage);
+    UnloadImage(_guiFontAtlas);
+    UnloadImage(_sdfFontAtlas);
+
+    IRenderBackend& renderer = getRenderer();
+    renderer.unloadTexture(_spriteSheet);
+    renderer.unloadTexture(_background);
+
+    renderer.unloadFont(_guiFont);
+    renderer.unloadFont(_sdfFont);
+    renderer.unloadShader(_fontShader);
 }
 
 void ClassicTheme::createAndLoadBackground()
@@ -106,14 +181,5 @@ void ClassicTheme::createAndLoadBackground()
     constexpr int width  = 1;
     constexpr int height = 1;
 
-    _background = RaylibUtils::loadTextureFromMemory(width, height, BACKGROUND_DATA);
-}
-
-void ClassicTheme::setGuiStyle() const
-{
-    GuiSetFont(_font);
-    GuiSetStyle(DEFAULT, TEXT_SIZE, GUI_FONT_SIZE);
-    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);
-
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    _background = RaylibUtils::loadTextureFromMemory(getRenderer(), width, height, BACKGROUND_DATA);
 }
@@ -25,32 +25,54 @@
 #ifndef WS_THEMES_CLASSIC_THEME_H
 #define WS_THEMES_CLASSIC_THEME_H
 
-#include "components/theme.h"
+#include "themes/theme_base.h"
 
-class ClassicTheme final : public ITheme
+class ClassicTheme final : public ThemeBase<ClassicTheme>
 {
 public:
-     ClassicTheme();
-    ~ClassicTheme() override;
+    explicit ClassicTheme(IRenderBackend& renderer);
+            ~ClassicTheme() override;
+
+    [[nodiscard]] auto decode() -> bool override;
+    [[nodiscard]] auto uploadNext() -> bool override;
+    void               apply() const override;
 
     [[nodiscard]] auto getTileSize() const -> int override;
 
     [[nodiscard]] auto getSpriteSheet() const -> const Texture2D& override;
     [[nodiscard]] auto getBackground() const -> const Texture2D& override;
     [[nodiscard]] auto getFont() const -> const Font& override;
+    [[nodiscard]] auto getDigitStrip() const -> const DigitStrip& override;
+
+    [[nodiscard]] auto getFontShader() const -> const Shader& override;
 
     [[nodiscard]] auto getFontColor() const -> const Color override;
 private:
-    void loadAssets();
     void unloadAssets() const;
 
     void createAndLoadBackground();
-
-    void setGuiStyle() const;
 private:
-    Texture2D _spriteSheet;
-    Texture2D _background;
-    Font      _font;
+    enum class UploadStep : unsigned char
+    {
+        SpriteSheet = 0,
+        Background,
+        GuiFont,
+        SdfFont,
+        Done
+    };
+
+    // Decoded assets waiting for their upload
+    Image      _sheetImage;
+    Image      _guiFontAtlas;
+    Image      _sdfFontAtlas;
+    UploadStep _uploadStep;
+
+    Texture2D  _spriteSheet;
+    Texture2D  _background;
+    Font       _guiFont;
+    Font       _sdfFont;
+    Shader     _fontShader;
+    DigitStrip _digitStrip;
 };
 
 #endif
\ No newline at end of file
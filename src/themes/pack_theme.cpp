@@ -0,0 +1,222 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pack_theme.h"
+
+#include <cstddef>
+#include <cstring>
+#include <raygui.h>
+#include <raylib.h>
+#include <utility>
+
+#include "gui/layout_constants.h"
+#include "thirdparties/raylib_utils.h"
+
+static constexpr int GUI_FONT_SIZE = 16;
+
+PackTheme::PackTheme(IRenderBackend& renderer, std::string path)
+    : ThemeBase(renderer)
+    , _path(std::move(path))
+    , _file()
+    , _header()
+    , _uploadStep(UploadStep::SpriteSheet)
+    , _spriteSheet()
+    , _background()
+    , _guiFont()
+    , _sdfFont()
+    , _fontShader()
+    , _digitStrip()
+{}
+
+PackTheme::~PackTheme()
+{
+    IRenderBackend& renderer = getRenderer();
+    renderer.unloadTexture(_spriteSheet);
+    renderer.unloadTexture(_background);
+
+    renderer.unloadFont(_guiFont);
+    renderer.unloadFont(_sdfFont);
+    renderer.unloadShader(_fontShader);
+
+    TraceLog(LOG_INFO, "Theme pack %s unloaded!", _path.c_str());
+}
+
+auto PackTheme::decode() -> bool
+{
+    if (!_file.open(_path.c_str()))
+    {
+        return false;
+    }
+
+    if (_file.getSize() < sizeof(ThemePack::Header))
+    {
+        TraceLog(LOG_WARNING, "Theme pack %s is too small", _path.c_str());
+        return false;
+    }
+    std::memcpy(&_header, _file.getData(), sizeof(ThemePack::Header));
+
+    if (_header.magic != ThemePack::MAGIC || _header.version != ThemePack::VERSION)
+    {
+        TraceLog(LOG_WARNING, "%s is not a supported theme pack", _path.c_str());
+        return false;
+    }
+
+    const ThemePack::ImageEntry& sheet = _header.spriteSheet;
+    if (!isValid(sheet) || sheet.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || _header.tileSize <= 0 ||
+        sheet.height != _header.tileSize || sheet.width != _header.tileSize * TILE_SPRITE_COUNT)
+    {
+        TraceLog(LOG_WARNING, "Theme pack %s has an invalid sprite sheet", _path.c_str());
+        return false;
+    }
+    if (!isValid(_header.guiFont) || !isValid(_header.sdfFont))
+    {
+        TraceLog(LOG_WARNING, "Theme pack %s has an invalid font", _path.c_str());
+        return false;
+    }
+    return true;
+}
+
+auto PackTheme::uploadNext() -> bool
+{
+    switch (_uploadStep)
+    {
+    case UploadStep::SpriteSheet:
+        _spriteSheet = getRenderer().loadTexture(getImage(_header.spriteSheet));
+        publishTileRenderDescriptor();
+        _uploadStep  = UploadStep::Background;
+        break;
+    case UploadStep::Background:
+        _background = RaylibUtils::loadTextureFromMemory(getRenderer(), 1, 1, &_header.backgroundColor);
+        _uploadStep = UploadStep::GuiFont;
+        break;
+    case UploadStep::GuiFont:
+        _guiFont    = loadFont(_header.guiFont);
+        _uploadStep = UploadStep::SdfFont;
+        break;
+    case UploadStep::SdfFont:
+        _sdfFont    = loadFont(_header.sdfFont);
+        _fontShader = RaylibUtils::loadSdfShader(getRenderer());
+        _digitStrip = DigitStrip(getFont(), GUI::HUD_FONT_SIZE, GUI::HUD_TEXT_SPACING);
+        _uploadStep = UploadStep::Done;
+
+        // Everything lives on the GPU now
+        _file.close();
+
+        TraceLog(LOG_INFO, "Theme pack %s loaded!", _path.c_str());
+        break;
+    case UploadStep::Done:
+        break;
+    }
+    return _uploadStep != UploadStep::Done;
+}
+
+void PackTheme::apply() const
+{
+    GuiSetFont(_guiFont);
+    GuiSetStyle(DEFAULT, TEXT_SIZE, GUI_FONT_SIZE);
+    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);
+
+    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+}
+
+auto PackTheme::getTileSize() const -> int
+{
+    return _header.tileSize;
+}
+
+auto PackTheme::getSpriteSheet() const -> const Texture2D&
+{
+    return _spriteSheet;
+}
+
+auto PackTheme::getBackground() const -> const Texture2D&
+{
+    return _background;
+}
+
+auto PackTheme::getFont() const -> const Font&
+{
+    return getRenderer().isShaderSupported(_fontShader) && _header.sdfFont.sdf != 0 ? _sdfFont : _guiFont;
+}
+
+auto PackTheme::getDigitStrip() const -> const DigitStrip&
+{
+    return _digitStrip;
+}
+
+auto PackTheme::getFontShader() const -> const Shader&
+{
+    return _fontShader;
+}
+
+auto PackTheme::getFontColor() const -> const Color
+{
+    return _header.fontColor;
+}
+
+auto PackTheme::isValid(const ThemePack::ImageEntry& image) const -> bool
+{
+    if (image.width <= 0 || image.height <= 0 || image.offset % ThemePack::ALIGNMENT != 0)
+    {
+        return false;
+    }
+    const auto size = static_cast<std::size_t>(GetPixelDataSize(image.width, image.height, image.format));
+    return size > 0 && image.offset <= _file.getSize() && size <= _file.getSize() - image.offset;
+}
+
+auto PackTheme::isValid(const ThemePack::FontEntry& font) const -> bool
+{
+    if (font.baseSize <= 0 || font.glyphCount <= 0 || font.glyphOffset % ThemePack::ALIGNMENT != 0 ||
+        font.atlas.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA || !isValid(font.atlas))
+    {
+        return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(font.glyphCount) * sizeof(BakedGlyph);
+    return font.glyphOffset <= _file.getSize() && size <= _file.getSize() - font.glyphOffset;
+}
+
+auto PackTheme::getImage(const ThemePack::ImageEntry& image) const -> Image
+{
+    Image result;
+    result.width   = image.width;
+    result.height  = image.height;
+    result.data    = const_cast<unsigned char*>(_file.getData() + image.offset); // NOLINT
+    result.format  = image.format;
+    result.mipmaps = 1;
+    return result;
+}
+
+auto PackTheme::loadFont(const ThemePack::FontEntry& font) const -> Font
+{
+    BakedFont baked{};
+    baked.baseSize     = font.baseSize;
+    baked.glyphCount   = font.glyphCount;
+    baked.glyphPadding = font.glyphPadding;
+    baked.sdf          = font.sdf != 0;
+    baked.atlasWidth   = font.atlas.width;
+    baked.atlasHeight  = font.atlas.height;
+    baked.glyphs       = reinterpret_cast<const BakedGlyph*>(_file.getData() + font.glyphOffset); // NOLINT
+
+    return RaylibUtils::loadBakedFont(getRenderer(), baked, getImage(font.atlas));
+}
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_THEMES_PACK_THEME_H
+#define WS_THEMES_PACK_THEME_H
+
+#include <string>
+
+#include "components/mapped_file.h"
+#include "themes/theme_base.h"
+#include "themes/theme_pack_format.h"
+
+// Theme loaded at runtime from a theme pack file (see theme_pack_format.h). The file is memory mapped and the
+// textures are uploaded directly from the mapping.
+class PackTheme final : public ThemeBase<PackTheme>
+{
+public:
+             PackTheme() = delete;
+             PackTheme(IRenderBackend& renderer, std::string path);
+            ~PackTheme() override;
+
+    [[nodiscard]] auto decode() -> bool override;
+    [[nodiscard]] auto uploadNext() -> bool override;
+    void               apply() const override;
+
+    [[nodiscard]] auto getTileSize() const -> int override;
+
+    [[nodiscard]] auto getSpriteSheet() const -> const Texture2D& override;
+    [[nodiscard]] auto getBackground() const -> const Texture2D& override;
+    [[nodiscard]] auto getFont() const -> const Font& override;
+    [[nodiscard]] auto getDigitStrip() const -> const DigitStrip& override;
+
+    [[nodiscard]] auto getFontShader() const -> const Shader& override;
+
+    [[nodiscard]] auto getFontColor() const -> const Color override;
+private:
+    [[nodiscard]] auto isValid(const ThemePack::ImageEntry& image) const -> bool;
+    [[nodiscard]] auto isValid(const ThemePack::FontEntry& font) const -> bool;
+
+    [[nodiscard]] auto getImage(const ThemePack::ImageEntry& image) const -> Image;
+    [[nodiscard]] auto loadFont(const ThemePack::FontEntry& font) const -> Font;
+private:
+    enum class UploadStep : unsigned char
+    {
+        SpriteSheet = 0,
+        Background,
+        GuiFont,
+        SdfFont,
+        Done
+    };
+
+    std::string       _path;
+    MappedFile        _file;
+    ThemePack::Header _header;
+    UploadStep        _uploadStep;
+
+    Texture2D  _spriteSheet;
+    Texture2D  _background;
+    Font       _guiFont;
+    Font       _sdfFont;
+    Shader     _fontShader;
+    DigitStrip _digitStrip;
+};
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_THEMES_THEME_BASE_H
+#define WS_THEMES_THEME_BASE_H
+
+#include "components/render_backend.h"
+#include "components/theme.h"
+#include "components/tile_render_descriptor.h"
+
+// Shared part of the themes. Derived is the final theme class, so the calls into it are resolved at compile time.
+template <typename Derived>
+class ThemeBase : public ITheme
+{
+public:
+    [[nodiscard]] auto getTileRenderDescriptor() const -> const TileRenderDescriptor& final
+    {
+        return _tileDescriptor;
+    }
+protected:
+    // Assets are uploaded to and drawn by the renderer, it has to outlive the theme
+    explicit ThemeBase(IRenderBackend& renderer)
+        : _renderer(renderer)
+        , _tileDescriptor()
+    {}
+
+    [[nodiscard]] auto getRenderer() const -> IRenderBackend&
+    {
+        return _renderer;
+    }
+
+    // Has to be called once the sprite sheet is uploaded
+    void publishTileRenderDescriptor()
+    {
+        const Derived& theme = static_cast<const Derived&>(*this);
+        _tileDescriptor      = makeTileRenderDescriptor(theme.getSpriteSheet(), theme.getTileSize());
+    }
+private:
+    IRenderBackend&      _renderer;
+    TileRenderDescriptor _tileDescriptor;
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Yan01h
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WS_THEMES_THEME_PACK_FORMAT_H
+#define WS_THEMES_THEME_PACK_FORMAT_H
+
+#include <cstdint>
+#include <raylib.h>
+
+#include "components/embedded_asset.h"
+
+// Binary layout of a theme pack, written by tools/asset_compiler and read by PackTheme. All pixel data is stored
+// uncompressed in raylib's pixel formats so textures can be uploaded straight from the memory mapped file. Values are
+// little endian.
+namespace ThemePack {
+
+constexpr std::uint32_t MAGIC     = 0x50545357; // "WSTP"
+constexpr std::uint32_t VERSION   = 1;
+constexpr std::uint32_t ALIGNMENT = 16; // Alignment of every data block inside the file
+
+struct ImageEntry
+{
+    std::uint32_t offset;
+    std::int32_t  width;
+    std::int32_t  height;
+    std::int32_t  format; // PixelFormat
+};
+
+// The glyph table is an array of BakedGlyph
+struct FontEntry
+{
+    std::int32_t  baseSize;
+    std::int32_t  glyphCount;
+    std::int32_t  glyphPadding;
+    std::uint32_t sdf;
+    std::uint32_t glyphOffset;
+    ImageEntry    atlas;
+};
+
+struct Header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::int32_t  tileSize;
+    Color         fontColor;
+    Color         backgroundColor;
+    ImageEntry    spriteSheet;
+    FontEntry     guiFont;
+    FontEntry     sdfFont;
+};
+
+} // namespace ThemePack
+
+#endif
@@ -24,26 +24,113 @@
 
 #include "raylib_utils.h"
 
-constexpr int FONT_BASE_SIZE            = 32;
-constexpr int FONT_TTF_DEFAULT_NUMCHARS = 95;
+// Anti-aliased edge of a signed distance field glyph, 0.5 is exactly on the outline
+static constexpr const char* SDF_FRAGMENT_SHADER = R"(#version 330
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform vec4      colDiffuse;
+
+out vec4 finalColor;
+
+void main()
+{
+    float distance  = texture(texture0, fragTexCoord).a - 0.5;
+    float smoothing = length(vec2(dFdx(distance), dFdy(distance)));
+    float alpha     = smoothstep(-smoothing, smoothing, distance);
+
+    finalColor = vec4(fragColor.rgb, fragColor.a * alpha) * colDiffuse;
+}
+)";
 
 namespace RaylibUtils {
 
-auto loadTextureFromMemory(const int width, const int height, const unsigned int* data) -> Texture2D
+auto loadTextureFromMemory(IRenderBackend& renderer, const int width, const int height,
+                           const void* data) -> Texture2D
 {
     Image image;
     image.width   = width;
     image.height  = height;
-    image.data    = (void*)data; // NOLINT
+    image.data    = const_cast<void*>(data); // NOLINT
     image.format  = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     image.mipmaps = 1;
 
-    return LoadTextureFromImage(image);
+    return renderer.loadTexture(image);
+}
+
+auto decodeImage(const EmbeddedAsset& asset, const int width, const int height) -> Image
+{
+    AssetData data(asset);
+    if (!data.isValid())
+    {
+        return {};
+    }
+
+    Image image;
+    image.width   = width;
+    image.height  = height;
+    image.data    = data.release();
+    image.format  = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.mipmaps = 1;
+    return image;
+}
+
+auto decodeBakedFont(const BakedFont& baked) -> Image
+{
+    const AssetData alpha(baked.atlas);
+    if (!alpha.isValid())
+    {
+        return {};
+    }
+
+    // raylib's font atlases are white gray alpha images
+    auto* pixels = static_cast<unsigned char*>(MemAlloc(alpha.getSize() * 2));
+    for (int i = 0; i < alpha.getSize(); i++)
+    {
+        pixels[i * 2]     = 255;
+        pixels[i * 2 + 1] = alpha.getData()[i];
+    }
+
+    Image atlas;
+    atlas.width   = baked.atlasWidth;
+    atlas.height  = baked.atlasHeight;
+    atlas.data    = pixels;
+    atlas.format  = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    atlas.mipmaps = 1;
+    return atlas;
+}
+
+auto loadBakedFont(IRenderBackend& renderer, const BakedFont& baked, const Image& atlas) -> Font
+{
+    // Same allocations as LoadFontFromMemory() so UnloadFont() can free them
+    Font font;
+    font.baseSize     = baked.baseSize;
+    font.glyphCount   = baked.glyphCount;
+    font.glyphPadding = baked.glyphPadding;
+    font.texture      = renderer.loadTexture(atlas);
+    font.recs         = static_cast<Rectangle*>(MemAlloc(baked.glyphCount * sizeof(Rectangle)));
+    font.glyphs       = static_cast<GlyphInfo*>(MemAlloc(baked.glyphCount * sizeof(GlyphInfo)));
+
+    for (int i = 0; i < baked.glyphCount; i++)
+    {
+        const BakedGlyph& glyph = baked.glyphs[i];
+
+        font.recs[i]   = {glyph.x, glyph.y, glyph.width, glyph.height};
+        font.glyphs[i] = {glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX, Image{}};
+    }
+
+    if (baked.sdf)
+    {
+        renderer.setTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    }
+    return font;
 }
 
-auto loadFontFromMemory(const unsigned char* data, const int size) -> Font
+auto loadSdfShader(IRenderBackend& renderer) -> Shader
 {
-    return LoadFontFromMemory(".ttf", data, size, FONT_BASE_SIZE, nullptr, FONT_TTF_DEFAULT_NUMCHARS);
+    return renderer.loadShader(SDF_FRAGMENT_SHADER);
 }
 
 } // namespace RaylibUtils
@@ -27,10 +27,22 @@
 
 #include <raylib.h>
 
+#include "components/embedded_asset.h"
+#include "components/render_backend.h"
+
 namespace RaylibUtils {
 
-auto loadTextureFromMemory(int width, int height, const unsigned int* data) -> Texture2D;
-auto loadFontFromMemory(const unsigned char* data, int size) -> Font;
+auto loadTextureFromMemory(IRenderBackend& renderer, int width, int height, const void* data) -> Texture2D;
+
+// Decoding only touches CPU memory and may run on any thread, the returned images are freed with UnloadImage().
+// A corrupted asset returns an image without data.
+auto decodeImage(const EmbeddedAsset& asset, int width, int height) -> Image;
+auto decodeBakedFont(const BakedFont& baked) -> Image;
+
+// Fonts are freed with IRenderBackend::unloadFont()
+auto loadBakedFont(IRenderBackend& renderer, const BakedFont& baked, const Image& atlas) -> Font;
+
+auto loadSdfShader(IRenderBackend& renderer) -> Shader;
 
 } // namespace RaylibUtils
 
@@ -0,0 +1,462 @@
+// Converts the files in assets/ into compressed C++ headers that get embedded into the executable.
+//
+// Usage: asset_compiler <image|font|file> <input> <output.h> <namespace> <NAME>
+//   image: Decodes an image and stores its RGBA pixels as <NAME>_DATA, <NAME>_WIDTH and <NAME>_HEIGHT
+//   font:  Bakes the glyph atlas and metrics of a TTF font as <NAME> and a signed distance field variant as <NAME>_SDF
+//   file:  Stores the raw file content as <NAME>_DATA
+//
+// Usage: asset_compiler pack <theme.txt> <output.wstheme>
+//   Builds a theme pack that can be loaded at runtime with --theme (see src/themes/theme_pack_format.h). theme.txt
+//   holds 'key = value' lines: sprite_sheet and font are paths relative to it, font_color and background_color are
+//   RRGGBB or RRGGBBAA hex colors.
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <raylib.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "themes/theme_pack_format.h"
+
+constexpr int BYTES_PER_LINE = 19;
+
+// Same values raylib's LoadFontFromMemory() uses
+constexpr int FONT_BASE_SIZE     = 32;
+constexpr int FONT_GLYPH_COUNT   = 95;
+constexpr int FONT_GLYPH_PADDING = 4;
+
+namespace {
+
+struct FontAtlas
+{
+    GlyphInfo* glyphs;
+    Rectangle* recs;
+    Image      atlas;
+    int        padding;
+    bool       sdf;
+};
+
+auto bakeFont(const unsigned char* data, const int size, const bool sdf, FontAtlas& font) -> bool
+{
+    // Same atlas layout as LoadFontFromMemory() and raylib's SDF example
+    font.padding = sdf ? 0 : FONT_GLYPH_PADDING;
+    font.sdf     = sdf;
+    font.recs    = nullptr;
+
+    font.glyphs = LoadFontData(data, size, FONT_BASE_SIZE, nullptr, FONT_GLYPH_COUNT, sdf ? FONT_SDF : FONT_DEFAULT);
+    if (font.glyphs == nullptr)
+    {
+        return false;
+    }
+    font.atlas =
+        GenImageFontAtlas(font.glyphs, &font.recs, FONT_GLYPH_COUNT, FONT_BASE_SIZE, font.padding, sdf ? 1 : 0);
+    return true;
+}
+
+void unloadFontAtlas(const FontAtlas& font)
+{
+    UnloadImage(font.atlas);
+    MemFree(font.recs);
+    UnloadFontData(font.glyphs, FONT_GLYPH_COUNT);
+}
+
+auto makeIncludeGuard(const std::filesystem::path& output) -> std::string
+{
+    // e.g. .../generated/assets/classic_theme/sprite_sheet.h -> WS_ASSETS_CLASSIC_THEME_SPRITE_SHEET_H
+    std::string guard = "WS_ASSETS_" + output.parent_path().filename().string() + "_" + output.filename().string();
+    for (char& character : guard)
+    {
+        character = std::isalnum(static_cast<unsigned char>(character)) != 0
+                        ? static_cast<char>(std::toupper(static_cast<unsigned char>(character)))
+                        : '_';
+    }
+    return guard;
+}
+
+auto openHeader(const std::filesystem::path& input, const std::filesystem::path& output, const std::string& nameSpace)
+    -> std::FILE*
+{
+    std::filesystem::create_directories(output.parent_path());
+    std::FILE* file = std::fopen(output.string().c_str(), "w");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "asset_compiler: Failed to open %s\n", output.string().c_str());
+        return nullptr;
+    }
+
+    const std::string guard = makeIncludeGuard(output);
+
+    std::fprintf(file, "// Generated by asset_compiler from %s, do not edit\n\n", input.filename().string().c_str());
+    std::fprintf(file, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    std::fprintf(file, "#include \"components/embedded_asset.h\"\n\n");
+    std::fprintf(file, "namespace %s {\n\n", nameSpace.c_str());
+    return file;
+}
+
+void closeHeader(std::FILE* file, const std::string& nameSpace)
+{
+    std::fprintf(file, "} // namespace %s\n\n#endif\n", nameSpace.c_str());
+    std::fclose(file);
+}
+
+// Writes <name>_COMPRESSED_DATA and returns the EmbeddedAsset initializer for it
+auto writeCompressedData(std::FILE* file, const std::string& name, const unsigned char* data, const int size)
+    -> std::string
+{
+    int            compressedSize = 0;
+    unsigned char* compressed     = CompressData(data, size, &compressedSize);
+    if (compressed == nullptr)
+    {
+        return {};
+    }
+
+    std::fprintf(file, "// NOLINTBEGIN\nconstexpr unsigned char %s_COMPRESSED_DATA[] = {", name.c_str());
+    for (int i = 0; i < compressedSize; i++)
+    {
+        std::fprintf(file, i % BYTES_PER_LINE == 0 ? "\n    0x%02x," : " 0x%02x,", compressed[i]);
+    }
+    std::fprintf(file, "\n};\n// NOLINTEND\n\n");
+
+    std::printf("asset_compiler: %s: %d -> %d bytes\n", name.c_str(), size, compressedSize);
+    MemFree(compressed);
+
+    return "{" + name + "_COMPRESSED_DATA, sizeof(" + name + "_COMPRESSED_DATA), " + std::to_string(size) + "}";
+}
+
+auto writeEmbeddedAsset(std::FILE* file, const std::string& name, const unsigned char* data, const int size) -> bool
+{
+    const std::string asset = writeCompressedData(file, name, data, size);
+    if (asset.empty())
+    {
+        return false;
+    }
+    std::fprintf(file, "constexpr EmbeddedAsset %s_DATA%s;\n\n", name.c_str(), asset.c_str());
+    return true;
+}
+
+auto writeBakedFont(std::FILE* file, const std::string& name, const unsigned char* data, const int size,
+                    const bool sdf) -> bool
+{
+    FontAtlas font{};
+    if (!bakeFont(data, size, sdf, font))
+    {
+        return false;
+    }
+
+    std::fprintf(file, "constexpr BakedGlyph %s_GLYPHS[] = {\n", name.c_str());
+    for (int i = 0; i < FONT_GLYPH_COUNT; i++)
+    {
+        const GlyphInfo& glyph = font.glyphs[i];
+        const Rectangle& rec   = font.recs[i];
+        std::fprintf(file, "    {%d, %d, %d, %d, %g, %g, %g, %g},\n", glyph.value, glyph.offsetX, glyph.offsetY,
+                     glyph.advanceX, rec.x, rec.y, rec.width, rec.height);
+    }
+    std::fprintf(file, "};\n\n");
+
+    // The atlas is white gray alpha, so only the alpha channel needs to be stored
+    const int                  pixelCount = font.atlas.width * font.atlas.height;
+    std::vector<unsigned char> alpha(pixelCount);
+    for (int i = 0; i < pixelCount; i++)
+    {
+        alpha[i] = static_cast<const unsigned char*>(font.atlas.data)[i * 2 + 1];
+    }
+
+    const std::string asset = writeCompressedData(file, name + "_ATLAS", alpha.data(), pixelCount);
+    if (!asset.empty())
+    {
+        std::fprintf(file, "constexpr BakedFont %s{%d, %d, %d, %s, %d, %d, %s_GLYPHS, %s};\n\n", name.c_str(),
+                     FONT_BASE_SIZE, FONT_GLYPH_COUNT, font.padding, sdf ? "true" : "false", font.atlas.width,
+                     font.atlas.height, name.c_str(), asset.c_str());
+    }
+
+    unloadFontAtlas(font);
+    return !asset.empty();
+}
+
+auto compileImage(const std::filesystem::path& input, std::FILE* file, const std::string& name) -> bool
+{
+    Image image = LoadImage(input.string().c_str());
+    if (image.data == nullptr)
+    {
+        return false;
+    }
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    std::fprintf(file, "constexpr int %s_WIDTH  = %d;\n", name.c_str(), image.width);
+    std::fprintf(file, "constexpr int %s_HEIGHT = %d;\n\n", name.c_str(), image.height);
+
+    const bool result =
+        writeEmbeddedAsset(file, name, static_cast<const unsigned char*>(image.data), image.width * image.height * 4);
+    UnloadImage(image);
+    return result;
+}
+
+auto compileFont(const std::filesystem::path& input, std::FILE* file, const std::string& name) -> bool
+{
+    int            size = 0;
+    unsigned char* data = LoadFileData(input.string().c_str(), &size);
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    const bool result =
+        writeBakedFont(file, name, data, size, false) && writeBakedFont(file, name + "_SDF", data, size, true);
+    UnloadFileData(data);
+    return result;
+}
+
+auto compileFile(const std::filesystem::path& input, std::FILE* file, const std::string& name) -> bool
+{
+    int            size = 0;
+    unsigned char* data = LoadFileData(input.string().c_str(), &size);
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    const bool result = writeEmbeddedAsset(file, name, data, size);
+    UnloadFileData(data);
+    return result;
+}
+
+// Theme pack file content, every block starts at a multiple of ThemePack::ALIGNMENT
+class PackWriter final
+{
+public:
+    PackWriter()
+        : _data(sizeof(ThemePack::Header))
+    {}
+
+    auto append(const void* data, const std::size_t size) -> std::uint32_t
+    {
+        _data.resize((_data.size() + ThemePack::ALIGNMENT - 1) / ThemePack::ALIGNMENT * ThemePack::ALIGNMENT);
+
+        const auto offset = static_cast<std::uint32_t>(_data.size());
+        _data.insert(_data.end(), static_cast<const unsigned char*>(data),
+                     static_cast<const unsigned char*>(data) + size);
+        return offset;
+    }
+
+    auto appendImage(const Image& image) -> ThemePack::ImageEntry
+    {
+        const auto size = static_cast<std::size_t>(GetPixelDataSize(image.width, image.height, image.format));
+        return {append(image.data, size), image.width, image.height, image.format};
+    }
+
+    auto appendFont(const FontAtlas& font) -> ThemePack::FontEntry
+    {
+        std::vector<BakedGlyph> glyphs(FONT_GLYPH_COUNT);
+        for (int i = 0; i < FONT_GLYPH_COUNT; i++)
+        {
+            const GlyphInfo& glyph = font.glyphs[i];
+            const Rectangle& rec   = font.recs[i];
+            glyphs[i] = {glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX,
+                         rec.x,       rec.y,         rec.width,     rec.height};
+        }
+
+        ThemePack::FontEntry entry{};
+        entry.baseSize     = FONT_BASE_SIZE;
+        entry.glyphCount   = FONT_GLYPH_COUNT;
+        entry.glyphPadding = font.padding;
+        entry.sdf          = font.sdf ? 1 : 0;
+        entry.glyphOffset  = append(glyphs.data(), glyphs.size() * sizeof(BakedGlyph));
+        entry.atlas        = appendImage(font.atlas);
+        return entry;
+    }
+
+    auto write(const std::filesystem::path& output, const ThemePack::Header& header) -> bool
+    {
+        std::memcpy(_data.data(), &header, sizeof(header));
+
+        std::filesystem::create_directories(output.parent_path());
+        std::FILE* file = std::fopen(output.string().c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        const bool result = std::fwrite(_data.data(), 1, _data.size(), file) == _data.size();
+        std::fclose(file);
+        return result;
+    }
+private:
+    std::vector<unsigned char> _data;
+};
+
+auto parseColor(const std::string& hex, Color& color) -> bool
+{
+    if ((hex.length() != 6 && hex.length() != 8) ||
+        hex.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+    {
+        return false;
+    }
+    // GetColor() expects 0xRRGGBBAA
+    color = GetColor(static_cast<unsigned int>(std::stoul(hex.length() == 6 ? hex + "ff" : hex, nullptr, 16)));
+    return true;
+}
+
+auto parseThemeDescription(const std::filesystem::path& input, std::map<std::string, std::string>& values) -> bool
+{
+    char* text = LoadFileText(input.string().c_str());
+    if (text == nullptr)
+    {
+        return false;
+    }
+
+    const auto trim = [](std::string_view view) {
+        while (!view.empty() && std::isspace(static_cast<unsigned char>(view.front())) != 0)
+        {
+            view.remove_prefix(1);
+        }
+        while (!view.empty() && std::isspace(static_cast<unsigned char>(view.back())) != 0)
+        {
+            view.remove_suffix(1);
+        }
+        return std::string(view);
+    };
+
+    std::string_view remaining(text);
+    while (!remaining.empty())
+    {
+        const std::size_t lineEnd = remaining.find('\n');
+        const std::string line    = trim(remaining.substr(0, lineEnd));
+        remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+
+        const std::size_t separator = line.find('=');
+        if (line.empty() || line[0] == '#' || separator == std::string::npos)
+        {
+            continue;
+        }
+        values[trim(std::string_view(line).substr(0, separator))] = trim(std::string_view(line).substr(separator + 1));
+    }
+
+    UnloadFileText(text);
+    return true;
+}
+
+auto compilePack(const std::filesystem::path& input, const std::filesystem::path& output) -> bool
+{
+    std::map<std::string, std::string> values;
+    if (!parseThemeDescription(input, values))
+    {
+        return false;
+    }
+
+    ThemePack::Header header{};
+    header.magic   = ThemePack::MAGIC;
+    header.version = ThemePack::VERSION;
+    if (!parseColor(values["font_color"], header.fontColor) ||
+        !parseColor(values["background_color"], header.backgroundColor))
+    {
+        std::fprintf(stderr, "asset_compiler: font_color and background_color need to be hex colors\n");
+        return false;
+    }
+
+    const std::filesystem::path directory = input.parent_path();
+
+    Image sheet = LoadImage((directory / values["sprite_sheet"]).string().c_str());
+    if (sheet.data == nullptr)
+    {
+        return false;
+    }
+    ImageFormat(&sheet, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    header.tileSize = sheet.height;
+
+    int            fontSize = 0;
+    unsigned char* fontData = LoadFileData((directory / values["font"]).string().c_str(), &fontSize);
+    FontAtlas      guiFont{};
+    FontAtlas      sdfFont{};
+    const bool     baked = fontData != nullptr && bakeFont(fontData, fontSize, false, guiFont) &&
+                       bakeFont(fontData, fontSize, true, sdfFont);
+
+    bool result = false;
+    if (baked)
+    {
+        PackWriter writer;
+        header.spriteSheet = writer.appendImage(sheet);
+        header.guiFont     = writer.appendFont(guiFont);
+        header.sdfFont     = writer.appendFont(sdfFont);
+
+        result = writer.write(output, header);
+    }
+
+    if (guiFont.glyphs != nullptr)
+    {
+        unloadFontAtlas(guiFont);
+    }
+    if (sdfFont.glyphs != nullptr)
+    {
+        unloadFontAtlas(sdfFont);
+    }
+    UnloadFileData(fontData);
+    UnloadImage(sheet);
+    return result;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    if (argc == 4 && std::string_view(argv[1]) == "pack")
+    {
+        if (!compilePack(argv[2], argv[3]))
+        {
+            std::fprintf(stderr, "asset_compiler: Failed to build theme pack %s\n", argv[3]);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc != 6)
+    {
+        std::fprintf(stderr, "Usage: asset_compiler <image|font|file> <input> <output.h> <namespace> <NAME>\n"
+                             "       asset_compiler pack <theme.txt> <output.wstheme>\n");
+        return 1;
+    }
+
+    const std::string_view      type = argv[1];
+    const std::filesystem::path input(argv[2]);
+    const std::filesystem::path output(argv[3]);
+    const std::string           nameSpace(argv[4]);
+    const std::string           name(argv[5]);
+
+    if (type != "image" && type != "font" && type != "file")
+    {
+        std::fprintf(stderr, "asset_compiler: Unknown asset type '%s'\n", argv[1]);
+        return 1;
+    }
+
+    std::FILE* file = openHeader(input, output, nameSpace);
+    if (file == nullptr)
+    {
+        return 1;
+    }
+
+    bool result = false;
+    if (type == "image")
+    {
+        result = compileImage(input, file, name);
+    } else if (type == "font")
+    {
+        result = compileFont(input, file, name);
+    } else
+    {
+        result = compileFile(input, file, name);
+    }
+    closeHeader(file, nameSpace);
+
+    if (!result)
+    {
+        std::fprintf(stderr, "asset_compiler: Failed to compile %s\n", input.string().c_str());
+        std::filesystem::remove(output);
+        return 1;
+    }
+    return 0;
+}